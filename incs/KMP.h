@@ -3,18 +3,56 @@
 #define KMP_H
 
 #include <stddef.h>
+#include <stdint.h>
+#include "search_mode.h"
 
 //preprocesa la función lps (fallback) para kmp
 void computeLPSArray(const char *pat, size_t M, int *lps);
 
-//busqueda KMP clasica (lps)
-void searchKMP(const char *pattern, const char *text);
+//patron kmp precompilado; solo lectura durante la busqueda, por lo que
+//puede reutilizarse sobre muchos textos y compartirse entre hilos
+typedef struct {
+    char *pat;  //copia del patron
+    size_t M;   //largo en bytes
+    int *lps;   //funcion de fallos
+} KmpPattern;
 
-//construye el autómata determinista para kmp
-//dfa debe apuntar a un bloque de int de tamaño (r * (m+1))
-void buildDFA(const char *pat, size_t M, int R, int *dfa);
+//compila el patron (NULL si esta vacio o falla malloc)
+KmpPattern* compileKMP(const char *pattern);
+
+//ejecuta el patron sobre text[0..N) sin imprimir; llama cb por match
+//(salvo en SEARCH_COUNT) y devuelve el numero de coincidencias
+size_t execKMP(const KmpPattern *p, const char *text, size_t N,
+               SearchMode mode, MatchCallback cb, void *ctx);
+
+void freeKMP(KmpPattern *p);
+
+//busqueda KMP clasica (lps), devuelve el numero de coincidencias
+size_t searchKMP(const char *pattern, const char *text, SearchMode mode);
+
+//largo maximo para el dfa (estados de 16 bits)
+#define KMP_DFA_MAX_PATTERN 65535
+
+//automata kmp compacto: el alfabeto se reduce a las clases de bytes del
+//patron (mas una clase "otro") y la tabla va por filas de estado, con
+//estados de 8 bits si M <= 255 y de 16 bits si no
+typedef struct {
+    size_t M;             //largo del patron (estado de aceptacion)
+    size_t K;             //numero de clases
+    uint8_t classOf[256]; //byte -> clase
+    int wide;             //1 si trans es uint16_t, 0 si uint8_t
+    void *trans;          //(M+1) * K transiciones, trans[estado * K + clase]
+} KmpDfaPattern;
+
+//construye el automata en p (p->trans se reserva aqui); 0 si ok
+int buildDFA(const char *pat, size_t M, KmpDfaPattern *p);
+
+KmpDfaPattern* compileKMPDFA(const char *pattern);
+size_t execKMPDFA(const KmpDfaPattern *p, const char *text, size_t N,
+                  SearchMode mode, MatchCallback cb, void *ctx);
+void freeKMPDFA(KmpDfaPattern *p);
 
 //busqueda usando el dfa precalculado
-void searchKMP_DFA(const char *pattern, const char *text);
+size_t searchKMP_DFA(const char *pattern, const char *text, SearchMode mode);
 
 #endif
\ No newline at end of file
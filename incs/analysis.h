@@ -0,0 +1,35 @@
+// Diego Galindo, Francisco Mercado
+#ifndef ANALYSIS_H
+#define ANALYSIS_H
+// Cadena de análisis tras la tokenización: quitar palabras vacías (por
+// idioma) y reducir cada término a su raíz. La configuración se elige al
+// crear el índice y queda en su header, así las consultas se analizan igual
+// que los documentos.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define ANALYSIS_LANG_ES 1u
+#define ANALYSIS_LANG_EN 2u
+
+typedef struct {
+    uint32_t stopwords;   // Máscara de idiomas cuyas palabras vacías se quitan
+    uint32_t stemmer;     // Idioma del stemmer (0 = sin stemming)
+} AnalysisConfig;
+
+// En el header: máscara de palabras vacías en el byte bajo y el idioma del
+// stemmer en el siguiente
+uint32_t encodeAnalysis(const AnalysisConfig *config);
+void decodeAnalysis(uint32_t raw, AnalysisConfig *config);
+
+// "es", "en" o "es,en"; 0 si se reconocieron todos
+int parseAnalysisLanguages(const char *text, uint32_t *mask);
+// Texto legible, p. ej. "palabras vacías: es,en; stemming: es"
+void describeAnalysis(const AnalysisConfig *config, char *out, size_t size);
+
+int isStopWord(uint32_t languages, const char *term);
+// Aplica la cadena a un término ya normalizado, en su lugar. Devuelve 0 si
+// el término se descarta (palabra vacía o raíz vacía).
+int analyzeTerm(const AnalysisConfig *config, char *term);
+
+#endif
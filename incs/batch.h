@@ -0,0 +1,36 @@
+// Diego Galindo, Francisco Mercado
+#ifndef BATCH_H
+#define BATCH_H
+// Consultas en lote: carga el índice o el texto una sola vez, evalúa todas
+// las consultas de un archivo (una por línea) en paralelo y emite los
+// resultados en el orden de entrada, por tandas, como JSON Lines o TSV.
+
+#include "normalization.h"
+#include "search_mode.h"
+
+typedef enum {
+    BATCH_JSONL,
+    BATCH_TSV
+} BatchFormat;
+
+// Consultas evaluadas por tanda antes de volcar su salida
+#define BATCH_CHUNK 1024
+
+// "jsonl" o "tsv"; -1 si no se reconoce
+int parseBatchFormat(const char *name, BatchFormat *format);
+
+// Un término por línea contra el índice (base + segmentos).
+// JSONL: {"query","term","hits":[{"doc_id","file","occurrences","positions"}]}
+// TSV:   consulta \t doc_id \t archivo \t ocurrencias \t pos,pos,...
+int searchIndexBatch(const char *index_file, const char *queries_file,
+                     BatchFormat format, int num_threads);
+
+// Un patrón por línea contra un archivo (texto o HTML) con el algoritmo
+// dado (auto elige por patrón). Offsets en bytes del texto normalizado.
+// JSONL: {"pattern","algorithm","count","offsets":[...]}
+// TSV:   patrón \t offset (o patrón \t conteo con --count)
+int searchPatternsBatch(const char *alg, const char *patterns_file, const char *filename,
+                        const NormalizationOptions *norm_opts, SearchMode mode,
+                        BatchFormat format, int num_threads);
+
+#endif
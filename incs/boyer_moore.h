@@ -4,10 +4,15 @@
 
 #include <stddef.h>
 #include <stdint.h>
+#include "search_mode.h"
 
 //decodifica utf-8 en un array de code-points (liberar con free)
 uint32_t* decodeUTF8(const char *utf8, size_t *outLen);
 
+//avanza count code-points (con las mismas reglas que decodeUTF8) y devuelve
+//el puntero al siguiente; sirve para pasar posiciones de bm a bytes
+const char* advanceUTF8(const char *utf8, size_t count);
+
 //bad-character mapa dinámico de code-points a ultimo indice
 typedef struct {
     uint32_t cp;    //code-point Unicode
@@ -20,7 +25,28 @@ BMMapEntry* preprocessBadCharUnicode(const uint32_t *pat, size_t M, size_t *mapS
 //good-suffix sobre code-points
 void preprocessGoodSuffixUnicode(const uint32_t *pat, size_t M, size_t *shiftGS);
 
-//busqueda boyer–moore UTF-8
-void searchBoyerMooreUnicode(const char *patternUTF8, const char *textUTF8);
+//patron boyer-moore precompilado sobre code-points; solo lectura durante
+//la busqueda, reutilizable entre textos e hilos
+typedef struct {
+    uint32_t *pat;             //patron decodificado
+    size_t M;                  //largo en code-points
+    ptrdiff_t lastLatin1[256]; //bad-character directo para cp < 256
+    BMMapEntry *bcMap;         //bad-character para cp >= 256 (ordenado por cp)
+    size_t mapSize;
+    size_t *shiftGS;           //good-suffix (M+1 entradas)
+} BMPattern;
+
+//compila el patron utf-8 (NULL si esta vacio o falla malloc)
+BMPattern* compileBM(const char *patternUTF8);
+
+//ejecuta sobre un texto ya decodificado txt[0..N); posiciones en code-points
+size_t execBM(const BMPattern *p, const uint32_t *txt, size_t N,
+              SearchMode mode, MatchCallback cb, void *ctx);
+
+void freeBM(BMPattern *p);
+
+//busqueda boyer–moore UTF-8 (posiciones en code-points)
+size_t searchBoyerMooreUnicode(const char *patternUTF8, const char *textUTF8,
+                               SearchMode mode);
 
 #endif
\ No newline at end of file
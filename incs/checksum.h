@@ -0,0 +1,13 @@
+// Diego Galindo, Francisco Mercado
+#ifndef CHECKSUM_H
+#define CHECKSUM_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// CRC32C (Castagnoli). Con SSE4.2 (make ARCH_FLAGS=-march=native) usa la
+// instrucción crc32; si no, tablas slice-by-8. Se encadena pasando el CRC
+// anterior: crc32c(crc32c(0, a, n), b, m) == crc32c(0, a||b, n+m).
+uint32_t crc32c(uint32_t crc, const void *data, size_t len);
+
+#endif
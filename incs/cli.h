@@ -16,6 +16,9 @@ void printTableFooter(int nCols);
 //imprime un match resaltado en verde si stdout es tty
 void printMatch(size_t position, const char *algorithm);
 
+//imprime el total de coincidencias (modos --count / --first sin match)
+void printMatchCount(size_t count, const char *algorithm);
+
 //imprime un mensaje de error en rojo si stdout es tty
 void printError(const char *msg);
 
@@ -0,0 +1,74 @@
+// Diego Galindo, Francisco Mercado
+#ifndef FM_INDEX_H
+#define FM_INDEX_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "search_mode.h"
+
+//FM-index: BWT del texto guardada en un wavelet tree con forma de Huffman
+//(cada byte ocupa los bits de su codigo, asi que la BWT queda comprimida a
+//~H0 bits por byte) y SA muestreado cada FM_DEFAULT_SAMPLE posiciones del
+//texto. Cuenta con busqueda hacia atras en O(M * largo del codigo) y
+//localiza cada coincidencia en a lo sumo sample pasos de LF, sin el texto
+//original (es un autoindice). Se guarda junto al texto en <archivo>.fm,
+//protegido con un CRC32C.
+
+#define FM_FILE_SUFFIX ".fm"
+#define FM_FILE_MAGIC 0x58494D46     //"FMIX"
+#define FM_FILE_VERSION 2            //2: CRC32C en el header
+#define FM_DEFAULT_SAMPLE 32
+
+//bitvector con rank en O(1): acumulados de 64 bits cada 65536 bits y
+//relativos de 16 bits cada 512 (~3% extra)
+typedef struct {
+    uint64_t *bits;
+    size_t words;
+    size_t length;              //bits
+    uint64_t *super;
+    uint16_t *blocks;
+} RankBitvector;
+
+//nodo interno del wavelet tree; child < 0 es la hoja del byte -child - 1
+typedef struct {
+    int32_t child[2];
+    uint64_t offset;            //inicio de sus bits en el bitvector comun (alineado a 512)
+    uint64_t ones_before;       //rank1(offset)
+} WaveletNode;
+
+typedef struct {
+    uint64_t n;                 //largo del texto (la BWT tiene n + 1 filas)
+    int64_t mtime;              //del texto al construir
+    uint32_t sample;
+    uint64_t primary;           //fila de la BWT que tiene el centinela
+    uint64_t C[257];            //filas cuyo sufijo empieza por un byte < c (incluye el centinela)
+    uint64_t codes[256];        //codigo de Huffman de cada byte (bit 0 = primer nivel)
+    uint8_t code_length[256];   //0: el byte no aparece
+    int32_t root;
+    WaveletNode *nodes;
+    size_t node_count;
+    RankBitvector tree;         //bits de todos los nodos
+    RankBitvector marks;        //filas muestreadas (SA[fila] % sample == 0)
+    uint32_t *samples;          //SA de las filas marcadas, en orden de fila
+    size_t sample_count;
+} FMIndex;
+
+//construye y guarda <archivo>.fm (sample 0 = FM_DEFAULT_SAMPLE)
+int buildFMIndexFile(const char *filename, uint32_t sample);
+
+int loadFMIndex(const char *filename, FMIndex *fm);
+void freeFMIndex(FMIndex *fm);
+//bytes en memoria de la BWT comprimida, las marcas y las muestras
+size_t fmIndexBytes(const FMIndex *fm);
+
+//rango [sp, ep) de filas cuyos sufijos empiezan por pat (busqueda hacia atras)
+void fmBackwardSearch(const FMIndex *fm, const char *pat, size_t M,
+                      uint64_t *sp, uint64_t *ep);
+//posicion en el texto del sufijo de la fila
+uint64_t fmLocate(const FMIndex *fm, uint64_t row);
+
+//igual que los demas search*: posiciones en orden creciente, conteo o la
+//primera coincidencia del texto
+size_t searchFMIndex(const FMIndex *fm, const char *pattern, SearchMode mode);
+
+#endif
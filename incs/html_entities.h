@@ -0,0 +1,44 @@
+// Diego Galindo, Francisco Mercado
+#ifndef HTML_ENTITIES_H
+#define HTML_ENTITIES_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Tabla de entidades nombradas de HTML5 generada al compilar por
+// tools/gen_html_entities (obj/html_entities.c). Es un hash perfecto de
+// tipo hash-and-displace: el hash con semilla 0 elige un bucket, y su
+// desplazamiento es la semilla del segundo hash, que da la ranura final.
+
+// Longitud máxima del nombre de una entidad, incluido el ';'
+#define HTML_ENTITY_MAX_NAME 32
+
+typedef struct {
+    const char *name;   // Nombre con ';' o forma heredada sin él; NULL si la ranura está vacía
+    const char *utf8;   // Texto decodificado en UTF-8
+    uint8_t name_len;
+    uint8_t utf8_len;
+} HtmlEntity;
+
+extern const HtmlEntity html_entity_slots[];
+extern const size_t html_entity_slot_count;
+extern const uint16_t html_entity_disp[];
+extern const size_t html_entity_bucket_count;
+
+// FNV-1a con semilla y mezcla final; compartido con el generador
+static inline uint32_t htmlEntityHash(const char *s, size_t len, uint32_t seed) {
+    uint32_t h = 2166136261u ^ (seed * 0x9E3779B9u);
+    for (size_t i = 0; i < len; i++) {
+        h ^= (unsigned char)s[i];
+        h *= 16777619u;
+    }
+    h ^= h >> 16;
+    h *= 0x85EBCA6Bu;
+    h ^= h >> 13;
+    return h;
+}
+
+// Busca una entidad por nombre exacto (con ';' si lo lleva); NULL si no existe
+const HtmlEntity* lookupHtmlEntity(const char *name, size_t len);
+
+#endif
@@ -0,0 +1,44 @@
+// Diego Galindo, Francisco Mercado
+#ifndef HTML_STRIPPER_H
+#define HTML_STRIPPER_H
+
+#include <stddef.h>
+#include "html_entities.h"
+
+// Conversión HTML -> texto en streaming: el documento se entrega en trozos
+// de cualquier tamaño y el texto resultante sale por un callback, sin
+// materializar la copia limpia. Se omiten etiquetas, comentarios y el
+// contenido de <script>/<style>; CDATA se conserva y las entidades
+// (nombradas HTML5 y numéricas) se decodifican a UTF-8.
+
+#define HTML_STRIPPER_BUFFER 4096
+
+// Recibe cada tramo de texto limpio (no terminado en '\0')
+typedef void (*HtmlTextSink)(const char *text, size_t len, void *ctx);
+
+typedef struct {
+    HtmlTextSink sink;
+    void *ctx;
+    int state;
+    char name[HTML_ENTITY_MAX_NAME + 1];  // Nombre de etiqueta o entidad en curso
+    size_t name_len;
+    int closing;              // La etiqueta en curso es de cierre
+    char quote;               // Comilla del atributo abierto, 0 si no hay
+    int after_equals;         // Último byte significativo de la etiqueta fue '='
+    size_t match;             // Avance sobre "-->", "]]>", "[CDATA[" o "</script"
+    const char *expect;       // Secuencia esperada tras "<!" ("--" o "[CDATA[")
+    const char *raw_end;      // "script" o "style" mientras se omite su contenido
+    char out[HTML_STRIPPER_BUFFER];
+    size_t out_len;
+    char last;                // Último byte emitido
+} HtmlStripper;
+
+void initHTMLStripper(HtmlStripper *s, HtmlTextSink sink, void *ctx);
+void feedHTMLStripper(HtmlStripper *s, const char *data, size_t len);
+// Cierra una entidad pendiente y vacía el búfer de salida
+void finishHTMLStripper(HtmlStripper *s);
+
+// Lee el archivo por bloques y lo pasa por el stripper; 0 si tuvo éxito
+int stripHTMLFile(const char *path, HtmlTextSink sink, void *ctx);
+
+#endif
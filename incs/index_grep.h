@@ -0,0 +1,11 @@
+// Diego Galindo, Francisco Mercado
+#ifndef INDEX_GREP_H
+#define INDEX_GREP_H
+// Búsqueda de patrones (kmp, kmp_dfa, bm, shiftand) sobre todos los documentos de un
+// índice, en paralelo y usando el vocabulario (y los trigramas, si el índice
+// los tiene) para descartar documentos.
+
+// Imprime "archivo:offset" (offset en bytes) por cada coincidencia
+int grepIndex(const char* index_file, const char* alg, const char* pattern);
+
+#endif
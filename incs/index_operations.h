@@ -3,12 +3,17 @@
 #define INDEX_OPERATIONS_H
 // Este módulo contiene todas las funciones relacionadas con la gestión de índices: creación, búsqueda, información, exportación y backup.
 
+#include "term_query.h"
+#include "analysis.h"
+
 int createDirectoryIfNotExists(const char* dir_path);
 char* buildIndexPath(const char* index_file);
 char* buildDocsPath(const char* input_path);
 
-int findSimilarDocuments(const char* index_file, const char* target_doc_id, int top_k);
+int findSimilarDocuments(const char* index_file, const char* target_doc_id, int top_k, int use_cache);
 int calculateDocumentSimilarity(const char* index_file, const char* doc_id1, const char* doc_id2);
+// Términos más frecuentes del documento, desde el índice directo
+int printDocumentVector(const char* index_file, const char* doc_id, int top_n);
 
 // Imprime información de uso para los comandos de índice
 void printIndexUsage(const char* program_name);
@@ -16,10 +21,16 @@ void printIndexUsage(const char* program_name);
 // Verifica si un archivo es de texto basándose en su extensión
 int isTextFile(const char* filename);
 
-// Crea un índice a partir de un directorio
-int indexDirectory(const char* dir_path, const char* index_file);
+// Crea un índice a partir de un directorio; analysis (NULL = sin análisis)
+// elige las palabras vacías y el stemmer, que quedan en su header. Con
+// build_trigrams se escribe también <índice>.trigrams para "index grep".
+int indexDirectory(const char* dir_path, const char* index_file, const AnalysisConfig* analysis,
+                   int build_trigrams);
 
-int searchInIndex(const char* index_file, const char* term);
+// use_cache: consulta y actualiza <índice>.cache (invalidada por generación)
+int searchInIndex(const char* index_file, const char* term, int use_cache);
+// Términos por prefijo, rango o comodines, leyendo solo esa región del diccionario
+int searchTermsInIndex(const char* index_file, const TermQuery* query);
 int handleIndexCommands(int argc, char* argv[]);
 int compare_similarity(const void* a, const void* b);
 
@@ -4,6 +4,8 @@
 
 #include <stdint.h>
 #include <stddef.h>
+#include "term_ids.h"
+#include "analysis.h"
 
 // Estructura para almacenar las posiciones de un término en un documento
 typedef struct {
@@ -19,19 +21,32 @@ typedef struct PostingNode {
     struct PostingNode *next;
 } PostingNode;
 
-// Entrada en la tabla hash del índice invertido
+// Entrada del índice invertido; su posición en entries es el id del término
 typedef struct {
-    char *term;            // El término (clave)
+    char *term;            // El término (del diccionario; NULL = sin postings)
     PostingNode *head;     // Lista enlazada de postings
     uint32_t doc_frequency; // Número de documentos que contienen este término
 } IndexEntry;
 
+// Índice directo: vector de frecuencias de cada documento (ids de término
+// ordenados), indexado por doc_id desde first_doc_id
+typedef struct {
+    TermVector *vectors;   // NULL = no construido
+    uint32_t first_doc_id;
+    size_t count;
+} ForwardIndex;
+
 // Estructura principal del índice invertido
 typedef struct {
-    IndexEntry *entries;   // Tabla hash
+    IndexEntry *entries;   // Indexado por id de término
     size_t size;          // Tamaño actual (número de términos únicos)
-    size_t capacity;      // Capacidad de la tabla hash
+    size_t capacity;      // Entradas reservadas (crece con el diccionario)
+    TermDictionary terms; // Término <-> id
+    ForwardIndex forward; // Se llena al cargar el índice completo
+    AnalysisConfig analysis; // Palabras vacías y stemming (del header al cargar)
     uint32_t next_doc_id; // Próximo ID de documento a asignar
+    uint32_t generation;  // Generación en disco; cambia con cada modificación (cachés)
+    uint32_t build_id;    // Distingue cada "index create" (la generación puede repetirse)
 } InvertedIndex;
 
 // Información de un documento indexado
@@ -40,6 +55,9 @@ typedef struct {
     char *filename;
     size_t word_count;    // Número total de palabras en el documento
     char *title;          // Título del documento (opcional)
+    uint64_t file_size;   // Tamaño, fecha y hash del archivo al indexarlo,
+    int64_t mtime;        // usados para detectar cambios en "index update"
+    uint64_t content_hash;
 } DocumentInfo;
 
 // Colección de documentos indexados
@@ -47,6 +65,10 @@ typedef struct {
     DocumentInfo *docs;
     size_t count;
     size_t capacity;
+    size_t *slot_by_id;        // doc_id -> posición en docs + 1 (0 = ausente)
+    size_t id_capacity;
+    size_t *filename_slots;    // Tabla hash abierta por nombre: posición + 1
+    size_t filename_capacity;  // Potencia de dos
 } DocumentCollection;
 
 // Funciones principales del indexer
@@ -56,24 +78,52 @@ void destroyIndex(InvertedIndex *index);
 // Tokenización
 char** tokenize(const char *text, size_t *token_count);
 void freeTokens(char **tokens, size_t count);
+// Como tokenize, pero cada token pasa por analysis (puede ser NULL) y queda
+// como su id en dict (lo agrega si no estaba); los descartados son
+// TERM_ID_NONE y conservan su posición. Liberar con free.
+uint32_t* tokenizeIds(TermDictionary *dict, const AnalysisConfig *analysis,
+                      const char *text, size_t *token_count);
 
 // Indexación
 uint32_t addDocument(InvertedIndex *index, DocumentCollection *collection, 
                      const char *filename, const char *content, const char *title);
 void addTermToIndex(InvertedIndex *index, const char *term, uint32_t doc_id, size_t position);
+// term_id debe venir de index->terms
+void addTermIdToIndex(InvertedIndex *index, uint32_t term_id, uint32_t doc_id, size_t position);
+// Indexa un .html/.htm en streaming, quitando etiquetas y entidades
+uint32_t addHTMLDocument(InvertedIndex *index, DocumentCollection *collection,
+                         const char *filepath, const char *title);
+int isHTMLFile(const char *filename);
 
-// Búsqueda
+// Búsqueda: el término se normaliza y analiza como al indexar (NULL si es
+// una palabra vacía del índice)
 PostingNode* searchTerm(InvertedIndex *index, const char *term);
 
+// Índice directo
+// Construye los vectores a partir de los postings. Con order, el término
+// order[k] recibe el id k en los vectores; sin order conserva su id.
+int buildForwardIndex(const InvertedIndex *index, const uint32_t *order, size_t order_count,
+                      ForwardIndex *forward);
+void freeForwardIndex(ForwardIndex *forward);
+// Vector del documento (vacío si no tiene términos); NULL si no está
+const TermVector* forwardVector(const ForwardIndex *forward, uint32_t doc_id);
+// Reserva el vector de doc_id (vacío) ampliando el rango; NULL si falla
+TermVector* forwardSlot(ForwardIndex *forward, uint32_t doc_id);
+
 // Utilidades
 uint32_t hash_function(const char *str, size_t table_size);
 
 // Gestión de documentos
 DocumentCollection* createDocumentCollection(size_t initial_capacity);
 void destroyDocumentCollection(DocumentCollection *collection);
+// Añade una copia de doc (la colección pasa a ser dueña de filename y title)
+DocumentInfo* appendDocumentInfo(DocumentCollection *collection, const DocumentInfo *doc);
 DocumentInfo* getDocumentById(DocumentCollection *collection, uint32_t doc_id);
+DocumentInfo* getDocumentByFilename(DocumentCollection *collection, const char *filename);
 
 int updateIndex(const char* index_file, const char* new_docs);
+// Marca como borrados (tombstone) el archivo o los archivos de un directorio
+int removeFromIndex(const char* index_file, const char* target);
 int processSingleFile(InvertedIndex* index, DocumentCollection* collection, const char* filepath);
 int isDirectory(const char* path);
 
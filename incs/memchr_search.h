@@ -0,0 +1,15 @@
+// Diego Galindo, Francisco Mercado
+#ifndef MEMCHR_SEARCH_H
+#define MEMCHR_SEARCH_H
+
+#include <stddef.h>
+#include "search_mode.h"
+
+//busqueda de patrones de 1 o 2 bytes apoyada en memchr (vectorizado en libc)
+size_t execMemchr(const char *pat, size_t M, const char *text, size_t N,
+                  SearchMode mode, MatchCallback cb, void *ctx);
+
+//igual que los demas search*: imprime filas, conteo o primera coincidencia
+size_t searchMemchr(const char *pattern, const char *text, SearchMode mode);
+
+#endif
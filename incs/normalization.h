@@ -15,7 +15,13 @@ typedef struct {
 // Para parsear las opciones de normalización desde argumentos de línea de comandos
 NormalizationOptions parseNormalizationOptions(int argc, char* argv[]);
 
-// Para aplicar la normalización al texto y patrón según las opciones
-void applyNormalization(char* text, char* pattern, const NormalizationOptions* opts);
+// Para aplicar la normalización al texto y patrón según las opciones.
+// La normalización avanzada puede alargar las cadenas, por lo que *text y
+// *pattern pueden reemplazarse por búferes nuevos (el original se libera).
+void applyNormalization(char** text, char** pattern, const NormalizationOptions* opts);
+
+// Igual que applyNormalization pero sobre una sola cadena y sin mensajes
+// (lo usan las búsquedas en lote, cuya salida debe ser solo datos)
+void normalizeString(char** str, const NormalizationOptions* opts);
 
 #endif 
\ No newline at end of file
@@ -0,0 +1,18 @@
+// Diego Galindo, Francisco Mercado
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <stddef.h>
+
+// Tarea ejecutada por cada índice del rango [0, n)
+typedef void (*ParallelTask)(size_t i, void *ctx);
+
+// Número de hilos a usar por defecto (núcleos en línea, mínimo 1)
+int defaultThreadCount(void);
+
+// Ejecuta task(i, ctx) para i en [0, n) repartiendo los índices dinámicamente
+// entre num_threads hilos (pool con contador atómico). Bloquea hasta terminar.
+// Con num_threads <= 1 o n <= 1 se ejecuta en el hilo actual.
+void parallelFor(size_t n, int num_threads, ParallelTask task, void *ctx);
+
+#endif
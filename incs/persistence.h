@@ -3,50 +3,134 @@
 #define PERSISTENCE_H
 
 #include "indexer.h"
+#include "term_query.h"
 
 // Constantes para el formato del archivo
 #define INDEX_FILE_MAGIC 0x494E4458  // "INDX" en little endian
-#define INDEX_FILE_VERSION 1
+#define INDEX_FILE_VERSION 7
+#define INDEX_FILE_VERSION_MIN 1     // Versión 1: DocumentHeader sin datos del archivo
+#define INDEX_CHECKSUM_VERSION 3     // Desde esta versión hay CRC32C por bloques
+#define INDEX_PORTABLE_VERSION 4     // Desde esta versión: registros empaquetados y posiciones de 32 bits
+#define INDEX_DICTIONARY_VERSION 5   // Desde esta versión: diccionario ordenado con front coding
+#define INDEX_FORWARD_VERSION 6      // Desde esta versión: índice directo tras los documentos
+#define INDEX_ANALYSIS_VERSION 7     // Desde esta versión: header de 40 bytes con la cadena de análisis
 
-// Estructura del header del archivo binario
+// Formato en disco: todos los campos son enteros de ancho fijo en
+// little-endian, sin relleno. Tamaños de cada registro:
+#define INDEX_HEADER_SIZE 40         // magic, version, términos, documentos, próximo ID, generación (u32), offset (u64), análisis, ID de creación (u32)
+#define INDEX_LEGACY_HEADER_SIZE 32  // Hasta la versión 6: sin análisis ni ID de creación
+#define INDEX_TRAILER_SIZE 32
+#define INDEX_TERM_RECORD_SIZE 12    // Hasta la versión 4: longitud, doc_frequency, postings (u32)
+#define INDEX_DICTIONARY_HEADER_SIZE 24 // Intervalo y número de reinicios (u32), bytes de entradas, offset de postings (u64)
+#define INDEX_RESTART_RECORD_SIZE 12 // Offset de la entrada (u32) y de sus postings (u64)
+#define INDEX_POSTING_RECORD_SIZE 8  // doc_id, posiciones (u32); siguen las posiciones
+#define INDEX_DOCUMENT_RECORD_SIZE 44 // doc_id, longitudes (u32) + palabras, tamaño, mtime, hash (u64)
+// Las versiones 1 a 3 volcaban los structs de x86-64 tal cual: posiciones
+// de 8 bytes y registros de documento con relleno (24 o 48 bytes)
+#define INDEX_LEGACY_POSITION_SIZE 8
+#define INDEX_CHECKSUM_MAGIC 0x43524353  // "CRCS"
+#define INDEX_BLOCK_SIZE 65536
+#define INDEX_WRITE_BUFFER (1 << 20)  // Búfer del escritor de índices
+#define INDEX_DICTIONARY_RESTART 16  // Términos por bloque del diccionario
+
+// Sección de términos desde la versión 5: el diccionario y después los
+// postings de cada término en el mismo orden. El diccionario guarda los
+// términos ordenados con strcmp; cada entrada es, en varints LEB128, el
+// largo del prefijo compartido con el término anterior, el largo del sufijo,
+// el sufijo, doc_frequency, el número de postings y los bytes de sus
+// postings. Cada INDEX_DICTIONARY_RESTART entradas el prefijo compartido es
+// 0 y la tabla de reinicios (tras las entradas) apunta a ese término
+// completo, lo que permite buscar en el diccionario sin recorrerlo entero.
+
+// Índice directo desde la versión 6: sigue a la tabla de documentos, en su
+// mismo orden. Por documento, en varints LEB128: el número de términos
+// distintos y luego cada par (posición del término en el diccionario, como
+// diferencia con la anterior; frecuencia en el documento).
+
+// Header del archivo binario (en memoria; en disco ver INDEX_HEADER_SIZE)
 typedef struct {
     uint32_t magic;           // Número mágico para validar el archivo
     uint32_t version;         // Versión del formato
     uint32_t num_terms;       // Número de términos en el índice
     uint32_t num_documents;   // Número de documentos
     uint32_t next_doc_id;     // Próximo ID de documento
-    uint64_t checksum;        // Checksum simple para integridad
+    uint32_t generation;      // Generación del índice al escribirlo (0 antes de la versión 4)
+    uint64_t checksum_offset; // Offset del ChecksumTrailer (versión < 3: tamaño del archivo)
+    uint32_t analysis;        // AnalysisConfig codificada (0 antes de la versión 7: sin análisis)
+    uint32_t build_id;        // Aleatorio en cada "index create" (0 si no se registró)
 } IndexFileHeader;
 
-// Estructura para serializar términos
+// Tras la tabla de documentos: CRC32C de cada bloque de INDEX_BLOCK_SIZE
+// bytes. Cada sección (términos+postings, documentos) empieza en un bloque
+// nuevo; al trailer le sigue la tabla de block_count CRCs.
+typedef struct {
+    uint32_t magic;            // INDEX_CHECKSUM_MAGIC
+    uint32_t block_size;
+    uint64_t documents_offset; // Inicio de la tabla de documentos
+    uint32_t terms_blocks;     // Bloques de la sección de términos y postings
+    uint32_t block_count;      // Total de bloques
+    uint32_t header_crc;       // CRC32C del header
+    uint32_t trailer_crc;      // CRC32C de este trailer (con este campo a 0) y de la tabla
+} ChecksumTrailer;
+
+// Registros decodificados de términos, postings y documentos
 typedef struct {
     uint32_t term_length;     // Longitud del término (incluyendo \0)
     uint32_t doc_frequency;   // Número de documentos que contienen el término
     uint32_t posting_count;   // Número de postings para este término
 } TermHeader;
 
-// Estructura para serializar postings
 typedef struct {
     uint32_t doc_id;          // ID del documento
     uint32_t position_count;  // Número de posiciones
 } PostingHeader;
 
-// Estructura para serializar información de documentos
 typedef struct {
     uint32_t doc_id;          // ID del documento
     uint32_t filename_length; // Longitud del nombre del archivo
     uint32_t title_length;    // Longitud del título (0 si no hay título)
     uint64_t word_count;      // Número de palabras en el documento
+    uint64_t file_size;       // Tamaño del archivo al indexarlo
+    int64_t mtime;            // Fecha de modificación del archivo
+    uint64_t content_hash;    // Hash FNV-1a del contenido
 } DocumentHeader;
 
+// Documentos borrados o reemplazados: un bit por doc ID. Se filtran al
+// cargar y desaparecen físicamente al fusionar o compactar.
+typedef struct {
+    uint8_t *bits;
+    size_t size;              // Bytes del bitmap
+} TombstoneSet;
+
+static inline int isTombstoned(const TombstoneSet *set, uint32_t doc_id) {
+    if (!set || (size_t)(doc_id >> 3) >= set->size) return 0;
+    return (set->bits[doc_id >> 3] >> (doc_id & 7)) & 1;
+}
+
 // Funciones principales de persistencia
 int saveIndexToBinary(const InvertedIndex *index, const DocumentCollection *collection, 
                       const char *filename);
 int loadIndexFromBinary(InvertedIndex **index, DocumentCollection **collection, 
                         const char *filename);
+// Carga y une varios archivos de índice (sin leer manifiestos de segmentos),
+// omitiendo los documentos marcados en deleted (puede ser NULL)
+int loadIndexFiles(InvertedIndex **index, DocumentCollection **collection,
+                   const char *const *paths, size_t count, const TombstoneSet *deleted);
+// Carga solo los términos que cumplen la consulta (con sus postings) y los
+// documentos, de la base y sus segmentos. En los archivos con diccionario
+// ordenado se recorre solo la región de la consulta.
+int loadIndexTerms(const char *filename, const TermQuery *query,
+                   InvertedIndex **index, DocumentCollection **collection);
+// Carga solo la tabla de documentos vivos de la base y sus segmentos
+int loadIndexDocuments(const char *filename, DocumentCollection **collection);
+int readIndexHeader(const char *filename, IndexFileHeader *header);
 
 // Funciones auxiliares
+// qsort de punteros a IndexEntry por término (diccionario, "index terms")
+int compareIndexEntries(const void *a, const void *b);
 int validateIndexFile(const char *filename);
+// Comprueba todos los CRC del archivo e informa del resultado; 0 si está íntegro
+int verifyIndexFile(const char *filename);
 void printIndexFileInfo(const char *filename);
 
 // Funciones de backup y recuperación
@@ -0,0 +1,47 @@
+// Diego Galindo, Francisco Mercado
+#ifndef PLANNER_H
+#define PLANNER_H
+
+#include <stddef.h>
+
+// Archivo de umbrales generado por "buscador calibrate" (tools/benchmark.sh)
+#define PLANNER_CONFIG_FILE "results/planner.conf"
+
+// Motores entre los que elige el planificador
+typedef enum {
+    PLAN_MEMCHR,
+    PLAN_KMP,
+    PLAN_KMP_DFA,
+    PLAN_BM,
+    PLAN_SHIFTAND
+} PlannedAlgorithm;
+
+// Umbrales de selección (calibrables por máquina)
+typedef struct {
+    size_t bm_min_length;        // Largo desde el que bm gana en texto ASCII
+    size_t shiftand_max_length;  // Largo hasta el que shift-and gana al dfa
+    double dense_matches_per_kb; // Densidad de coincidencias desde la que se evita bm
+    PlannedAlgorithm fallback;   // kmp o kmp_dfa, el más rápido en esta máquina
+} PlannerThresholds;
+
+// Decisión del planificador
+typedef struct {
+    PlannedAlgorithm alg;
+    char reason[160];
+} SearchPlan;
+
+PlannerThresholds defaultPlannerThresholds(void);
+
+// Lee umbrales "clave=valor"; deja los valores por defecto si falta el archivo
+int loadPlannerThresholds(const char *path, PlannerThresholds *thresholds);
+
+// Elige motor a partir del patrón y una muestra del inicio del texto
+SearchPlan planSearch(const char *pattern, const char *text,
+                      const PlannerThresholds *thresholds);
+
+const char* plannedAlgorithmName(PlannedAlgorithm alg);
+
+// Mide los motores sobre text y escribe los umbrales en out_path
+int calibratePlanner(const char *text, const char *out_path);
+
+#endif
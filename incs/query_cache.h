@@ -0,0 +1,63 @@
+// Diego Galindo, Francisco Mercado
+#ifndef QUERY_CACHE_H
+#define QUERY_CACHE_H
+// Caché LRU de resultados de consultas, acotada en entradas y en bytes. La
+// clave es la consulta normalizada; todas las entradas pertenecen a una
+// generación del índice (indexGeneration) y se descartan en bloque si la
+// generación cambia. Como la generación vuelve a empezar si se borra el .idx
+// y se crea de nuevo, el archivo guarda también el ID de creación del índice
+// (build_id del header). Es segura entre hilos (modo servidor).
+
+#include <pthread.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define QUERY_CACHE_SUFFIX ".cache"          // <índice>.cache, junto al .idx
+#define QUERY_CACHE_MAGIC 0x32434351         // "QCC2" (con ID de creación)
+#define QUERY_CACHE_MAX_ENTRIES 4096
+#define QUERY_CACHE_MAX_BYTES (16u << 20)
+
+typedef struct QueryCacheEntry {
+    char *key;
+    char *value;
+    size_t value_len;
+    uint64_t hash;
+    struct QueryCacheEntry *newer;   // Lista LRU: head es la más reciente
+    struct QueryCacheEntry *older;
+    struct QueryCacheEntry *chain;   // Siguiente en el mismo bucket
+} QueryCacheEntry;
+
+typedef struct {
+    QueryCacheEntry **buckets;
+    size_t bucket_count;             // Potencia de dos
+    QueryCacheEntry *head;
+    QueryCacheEntry *tail;
+    size_t count;
+    size_t bytes;
+    size_t max_entries;
+    size_t max_bytes;
+    uint32_t generation;
+    uint32_t build_id;
+    size_t hits;
+    size_t misses;
+    int dirty;                       // Cambios sin guardar en disco
+    pthread_mutex_t lock;
+} QueryCache;
+
+QueryCache* createQueryCache(size_t max_entries, size_t max_bytes, uint32_t generation,
+                             uint32_t build_id);
+void destroyQueryCache(QueryCache *cache);
+
+// Copia del resultado guardado (liberar con free) o NULL si no está
+char* queryCacheGet(QueryCache *cache, const char *key, size_t *len);
+// Guarda una copia y desaloja las entradas menos usadas hasta caber
+void queryCachePut(QueryCache *cache, const char *key, const char *value, size_t len);
+
+// <índice>.cache: un archivo de otra generación o de otra creación del índice
+// se ignora al cargar; solo se escribe si hubo cambios (temporal + rename)
+int loadQueryCache(QueryCache *cache, const char *index_path);
+int saveQueryCache(QueryCache *cache, const char *index_path);
+// Borra <índice>.cache (al recrear el índice); 0 si no existía
+int removeQueryCache(const char *index_path);
+
+#endif
@@ -3,14 +3,15 @@
 #define SEARCH_ALGORITHMS_H
 
 #include <stddef.h>
+#include "search_mode.h"
 
 // busca patron en texto usando kmp
-void searchKMP(const char* pattern, const char* text);
+size_t searchKMP(const char* pattern, const char* text, SearchMode mode);
 
-//  busca patron en texto usando boyer-moore
-void searchBoyerMoore(const char* pattern, const char* text);
+//  busca patron en texto usando boyer-moore (utf-8)
+size_t searchBoyerMooreUnicode(const char* pattern, const char* text, SearchMode mode);
 
 // busca patron en texto usando shift-and
-void searchShiftAnd(const char* pattern, const char* text);
+size_t searchShiftAnd(const char* pattern, const char* text, SearchMode mode);
 
 #endif
\ No newline at end of file
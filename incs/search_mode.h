@@ -0,0 +1,23 @@
+// Diego Galindo, Francisco Mercado
+#ifndef SEARCH_MODE_H
+#define SEARCH_MODE_H
+
+#include <stddef.h>
+
+//modo de reporte de los algoritmos de busqueda
+typedef enum {
+    SEARCH_ALL,   //imprime cada coincidencia como fila de tabla
+    SEARCH_COUNT, //solo cuenta coincidencias, sin salida por match
+    SEARCH_FIRST  //se detiene en la primera coincidencia
+} SearchMode;
+
+//callback por coincidencia para los patrones precompilados
+//(pos es la posicion de inicio; ctx es el puntero del llamador)
+typedef void (*MatchCallback)(size_t pos, void *ctx);
+
+//callback comun de --first: guarda la posicion del match en *(size_t*)ctx
+static inline void storeFirstMatch(size_t pos, void *ctx) {
+    *(size_t*)ctx = pos;
+}
+
+#endif
@@ -0,0 +1,85 @@
+// Diego Galindo, Francisco Mercado
+#ifndef SEGMENTS_H
+#define SEGMENTS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "indexer.h"
+#include "persistence.h"
+
+// Índice segmentado: el archivo .idx es el segmento base y cada
+// "index update" escribe solo los documentos nuevos en un segmento pequeño
+// (<índice>.sNNNN) listado en el manifiesto <índice>.segments. Las consultas
+// cargan la base más todos los segmentos; una política por niveles fusiona
+// en segundo plano los segmentos de tamaño parecido. Los documentos borrados
+// o reemplazados se marcan en <índice>.tombstones (bitmap por doc ID).
+
+#define SEGMENT_MANIFEST_SUFFIX ".segments"
+#define TOMBSTONE_SUFFIX ".tombstones"
+#define SEGMENT_MERGE_FACTOR 4      // Segmentos de un mismo nivel que disparan una fusión
+#define SEGMENT_TIER_BASE 65536     // Bytes del nivel 0; cada nivel es SEGMENT_MERGE_FACTOR veces mayor
+#define SEGMENT_NAME_MAX 256
+
+typedef struct {
+    char name[SEGMENT_NAME_MAX];    // Nombre relativo al directorio del índice
+    uint32_t documents;
+    uint64_t bytes;
+} SegmentInfo;
+
+typedef struct {
+    SegmentInfo *segments;
+    size_t count;
+    size_t capacity;
+    uint32_t next_segment;          // Número del próximo segmento a crear
+    uint32_t generation;            // Generación tras el último cambio registrado aquí
+} SegmentManifest;
+
+// Manifiesto (si no existe se devuelve vacío)
+int loadSegmentManifest(const char *index_path, SegmentManifest *manifest);
+int saveSegmentManifest(const char *index_path, const SegmentManifest *manifest);
+void freeSegmentManifest(SegmentManifest *manifest);
+void buildSegmentPath(const char *index_path, const char *name, char *out, size_t size);
+
+// Próximo doc ID global (máximo entre la base y los segmentos)
+uint32_t nextDocIdForIndex(const char *index_path);
+
+// Generación actual del índice: el máximo entre la del header de la base y
+// la del manifiesto. Cada cambio visible en las consultas (crear, añadir un
+// segmento, borrar documentos) la incrementa; fusionar y compactar la
+// conservan. Sirve de clave para invalidar cachés de resultados.
+uint32_t indexGeneration(const char *index_path);
+
+// Lock del índice (<índice>.lock) para toda una actualización: leer los
+// documentos vivos, asignar doc IDs y registrar el segmento o los borrados.
+// Sin él, dos "index update" simultáneos darían los mismos IDs a documentos
+// distintos. Devuelve el descriptor del lock o -1 si no se pudo tomar
+int lockIndex(const char *index_path);
+void unlockIndex(const char *index_path, int lock);
+
+// Escribe los documentos en un segmento nuevo y lo registra en el manifiesto;
+// en la misma operación marca como borrados los doc IDs de deleted. Requiere
+// el lock del índice (lockIndex)
+int appendSegment(const char *index_path, InvertedIndex *index,
+                  const DocumentCollection *collection,
+                  const uint32_t *deleted, size_t deleted_count);
+
+// Tombstones (si el archivo no existe el conjunto queda vacío); addTombstones
+// requiere el lock del índice (lockIndex)
+int loadTombstones(const char *index_path, TombstoneSet *set);
+void freeTombstones(TombstoneSet *set);
+int addTombstones(const char *index_path, const uint32_t *ids, size_t count);
+
+// Fusiona por niveles mientras algún nivel tenga SEGMENT_MERGE_FACTOR segmentos;
+// devuelve el número de fusiones realizadas o -1 si hubo error
+int mergeSegmentTiers(const char *index_path);
+// Lanza mergeSegmentTiers en un proceso hijo si la política lo requiere
+int startBackgroundMerge(const char *index_path);
+// Compacta la base y todos los segmentos en el archivo .idx
+int compactIndex(const char *index_path);
+// Elimina manifiesto y segmentos (al recrear un índice)
+int clearIndexSegments(const char *index_path);
+void printSegmentInfo(const char *index_path);
+// Verifica los checksums de la base y de todos sus segmentos
+int verifyIndexWithSegments(const char *index_path);
+
+#endif
@@ -0,0 +1,30 @@
+// Diego Galindo, Francisco Mercado
+#ifndef SERVER_H
+#define SERVER_H
+// Modo servidor: carga el índice una sola vez y responde consultas por un
+// socket Unix (varias conexiones atendidas por un pool de hilos) o por
+// stdin/stdout.
+//
+// Protocolo de líneas. Petición: "<comando> <argumentos>\n"
+//   search <término>            -> doc_id \t ocurrencias \t archivo \t pos,pos,...
+//   similarity <id1> <id2>      -> jaccard \t coseno
+//   similar <id> [k]            -> doc_id \t coseno \t archivo (mejores k)
+//   export <archivo_salida>     -> (sin filas; escribe el índice como texto)
+//   info                        -> términos \t documentos \t generación \t aciertos \t fallos
+//   ping                        -> (sin filas)
+//   quit                        -> cierra la conexión
+// Respuesta: "OK <n>\n" seguido de n filas separadas por tabuladores, o
+// "ERR <mensaje>\n".
+//
+// Las respuestas OK de search y similar se guardan en una caché LRU (ver
+// query_cache.h) que se carga de <índice>.cache al arrancar y se guarda al
+// terminar; aciertos y fallos se cuentan en info.
+
+// Número máximo de posiciones por documento en la respuesta de search
+#define SERVER_MAX_POSITIONS 10
+
+// socket_path NULL: atiende una sola sesión por stdin/stdout.
+// num_threads <= 0: un hilo por núcleo.
+int runServer(const char *index_file, const char *socket_path, int num_threads);
+
+#endif
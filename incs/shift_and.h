@@ -3,12 +3,35 @@
 #define SHIFT_AND_H
 
 #include <stddef.h>
+#include "search_mode.h"
 
 //construye la mascara de bits para cada caracter del patron
 void buildMask(const char *pat, unsigned long long masks[256]);
 
-//busca todas las ocurrencias con shift-and (solo patrones <= 64)
-//imprime cada posicion encontrada
-void searchShiftAnd(const char *pattern, const char *text);
+//mascaras para patrones de mas de 64 bytes: masks[c * words + w]
+void buildMaskMulti(const char *pat, size_t M, size_t words,
+                    unsigned long long *masks);
+
+//patron shift-and precompilado (solo lectura durante la busqueda)
+//con words == 1 se usa el camino rapido de una palabra
+typedef struct {
+    unsigned long long *masks; //256 * words mascaras
+    size_t words;              //palabras de 64 bits por estado
+    size_t M;                  //largo del patron
+} ShiftAndPattern;
+
+//compila el patron; NULL si esta vacio o falla malloc
+ShiftAndPattern* compileShiftAnd(const char *pattern);
+
+//ejecuta sobre text[0..N) sin imprimir; llama cb por match (salvo en
+//SEARCH_COUNT) y devuelve el numero de coincidencias
+size_t execShiftAnd(const ShiftAndPattern *p, const char *text, size_t N,
+                    SearchMode mode, MatchCallback cb, void *ctx);
+
+void freeShiftAnd(ShiftAndPattern *p);
+
+//busca todas las ocurrencias con shift-and (cualquier largo)
+//imprime cada posicion encontrada (o solo el conteo / la primera segun mode)
+size_t searchShiftAnd(const char *pattern, const char *text, SearchMode mode);
 
 #endif
\ No newline at end of file
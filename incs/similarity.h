@@ -3,6 +3,7 @@
 #define SIMILARITY_H
 
 #include <stdint.h>
+#include "term_ids.h"
 
 typedef struct {
     uint32_t doc_id;
@@ -14,5 +15,11 @@ typedef struct {
 double jaccard_similarity(const char *doc1, const char *doc2);
 double cosine_similarity(const char *doc1, const char *doc2);
 
+// Tokeniza text con los ids de dict y arma su vector de frecuencias. Para
+// comparar un documento contra muchos, su vector se calcula una sola vez.
+int textTermVector(TermDictionary *dict, const char *text, TermVector *vector);
+double jaccardTermVectors(const TermVector *v1, const TermVector *v2);
+double cosineTermVectors(const TermVector *v1, const TermVector *v2);
+
 
 #endif
\ No newline at end of file
@@ -0,0 +1,14 @@
+// Diego Galindo, Francisco Mercado
+#ifndef STEMMER_H
+#define STEMMER_H
+// Stemmers al estilo Snowball para español e inglés. Trabajan sobre los
+// términos ya normalizados del índice (minúsculas ASCII: las tildes y la ñ
+// ya se plegaron), así que las reglas se aplican sobre las formas sin tilde.
+// Reducen el término en su lugar y devuelven su nuevo largo.
+
+#include <stddef.h>
+
+size_t stemSpanish(char *word, size_t length);
+size_t stemEnglish(char *word, size_t length);
+
+#endif
@@ -0,0 +1,60 @@
+// Diego Galindo, Francisco Mercado
+#ifndef SUFFIX_ARRAY_H
+#define SUFFIX_ARRAY_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "search_mode.h"
+
+//arreglo de sufijos (SA-IS, tiempo lineal) y LCP (algoritmo phi) de un
+//texto grande, para responder muchas busquedas sin recorrerlo entero.
+//se guarda junto al texto en <archivo>.sa: header de SA_HEADER_SIZE bytes
+//(magic, version (u32), largo del texto (u64), mtime del texto (i64),
+//reservado (u64)) y luego SA y LCP como u32 little-endian, alineados para
+//mapearlos con mmap. trabaja sobre los bytes crudos del archivo.
+
+#define SA_FILE_SUFFIX ".sa"
+#define SA_FILE_MAGIC 0x41465553     //"SUFA"
+#define SA_FILE_VERSION 1
+#define SA_HEADER_SIZE 32
+#define SA_MAX_TEXT 0x7FFFFFFEu      //indices de 32 bits con signo en SA-IS
+
+//construye SA[0..n) de text[0..n); 0 si todo bien
+int buildSuffixArray(const unsigned char *text, size_t n, int32_t *SA);
+
+//LCP[i] = prefijo comun de los sufijos SA[i-1] y SA[i] (LCP[0] = 0);
+//usa un arreglo auxiliar de n enteros
+int buildLCPArray(const unsigned char *text, size_t n, const int32_t *SA, int32_t *LCP);
+
+//indice mapeado: texto y arreglos en solo lectura
+typedef struct {
+    const unsigned char *text;
+    size_t n;
+    const uint32_t *SA;
+    const uint32_t *LCP;
+    void *text_map;              //regiones de mmap (o copias si el host no es little-endian)
+    size_t text_map_size;
+    void *sa_map;
+    size_t sa_map_size;
+    uint32_t *converted;         //SA y LCP convertidos (host big-endian)
+} SuffixIndex;
+
+//construye y guarda <archivo>.sa; imprime tiempos y estadisticas
+int buildSuffixArrayFile(const char *filename);
+
+//abre el texto y su .sa (falla si el texto cambio desde sa-build)
+int openSuffixIndex(const char *filename, SuffixIndex *index);
+void closeSuffixIndex(SuffixIndex *index);
+
+//rango [lo, hi) de SA con los sufijos que empiezan por pat, O(M log n)
+void suffixRange(const SuffixIndex *index, const char *pat, size_t M,
+                 size_t *lo, size_t *hi);
+
+//igual que los demas search*: posiciones en orden creciente, conteo o la
+//primera coincidencia del texto
+size_t searchSuffixArray(const SuffixIndex *index, const char *pattern, SearchMode mode);
+
+//subcadena repetida mas larga, LCP medio y subcadenas distintas
+void printSuffixStats(const SuffixIndex *index);
+
+#endif
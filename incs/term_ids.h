@@ -0,0 +1,48 @@
+// Diego Galindo, Francisco Mercado
+#ifndef TERM_IDS_H
+#define TERM_IDS_H
+// Diccionario de términos en memoria: cada término normalizado se guarda
+// una sola vez y se identifica por un entero denso (0, 1, 2...). El índice
+// invertido, el tokenizador y la similitud trabajan con estos ids; la
+// cadena solo se consulta para imprimir o guardar.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define TERM_ID_NONE UINT32_MAX
+
+typedef struct {
+    char **terms;            // id -> término (el diccionario es dueño)
+    size_t count;
+    size_t capacity;
+    uint32_t *slots;         // Tabla hash abierta: id + 1 (0 = libre)
+    size_t slot_capacity;    // Potencia de dos, al menos el doble de count
+} TermDictionary;
+
+int initTermDictionary(TermDictionary *dict, size_t initial_capacity);
+void freeTermDictionary(TermDictionary *dict);
+
+// Id del término (lo agrega si no estaba); TERM_ID_NONE si falta memoria
+uint32_t internTerm(TermDictionary *dict, const char *term, size_t len);
+// Id del término o TERM_ID_NONE si no está (no modifica el diccionario)
+uint32_t lookupTerm(const TermDictionary *dict, const char *term);
+
+static inline const char* termString(const TermDictionary *dict, uint32_t id) {
+    return id < dict->count ? dict->terms[id] : NULL;
+}
+
+// Vector de frecuencias de un documento: ids ordenados, sin repetir
+typedef struct {
+    uint32_t *ids;
+    uint32_t *counts;
+    size_t length;
+    size_t total;            // Suma de counts (tokens del documento)
+} TermVector;
+
+// Ordena los ids de los tokens y agrupa los repetidos (ignora TERM_ID_NONE)
+int buildTermVector(const uint32_t *token_ids, size_t count, TermVector *vector);
+// Reordena por id un vector armado a mano (ids sin repetir)
+void sortTermVector(TermVector *vector);
+void freeTermVector(TermVector *vector);
+
+#endif
@@ -0,0 +1,39 @@
+// Diego Galindo, Francisco Mercado
+#ifndef TERM_QUERY_H
+#define TERM_QUERY_H
+// Consultas sobre el diccionario de términos: prefijo, rango y comodines
+// (* = cualquier secuencia, ? = un byte). Los términos se comparan byte a
+// byte (strcmp), el mismo orden en que el diccionario se guarda en disco.
+// Toda consulta cubre una región contigua del diccionario ordenado: se
+// empieza en termQueryStart y se para en el primer término que la supera.
+
+#include <stddef.h>
+
+typedef enum {
+    TERM_QUERY_PREFIX,
+    TERM_QUERY_RANGE,
+    TERM_QUERY_WILDCARD
+} TermQueryKind;
+
+typedef struct {
+    TermQueryKind kind;
+    char *pattern;        // Prefijo, patrón o límite inferior del rango
+    char *high;           // Límite superior del rango (inclusive)
+    char *literal;        // Prefijo sin comodines que acota la región
+    size_t literal_len;
+} TermQuery;
+
+// Patrón con * o ?: un único * final es una consulta de prefijo. Los
+// patrones y límites se normalizan como los términos del índice.
+int parseTermPattern(const char *pattern, TermQuery *query);
+// Rango [low, high], ambos inclusive; high vacío no acota por arriba
+int parseTermRange(const char *low, const char *high, TermQuery *query);
+void freeTermQuery(TermQuery *query);
+
+// Primer término posible de la región
+const char* termQueryStart(const TermQuery *query);
+// 1 si term (en orden) ya está después de la región
+int termQueryPastEnd(const TermQuery *query, const char *term);
+int termQueryMatches(const TermQuery *query, const char *term);
+
+#endif
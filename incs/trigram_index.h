@@ -0,0 +1,70 @@
+// Diego Galindo, Francisco Mercado
+#ifndef TRIGRAM_INDEX_H
+#define TRIGRAM_INDEX_H
+// Índice opcional de trigramas de bytes (<índice>.trigrams, junto al .idx):
+// por cada secuencia de 3 bytes, los documentos cuyo archivo la contiene.
+// Se arma sobre el contenido crudo, el mismo que recorre "index grep", así
+// que un documento que contiene el patrón contiene todos sus trigramas y la
+// intersección de sus listas da los candidatos a verificar.
+//
+// Formato (little-endian): magic, versión, documentos cubiertos y número de
+// trigramas (u32); los doc IDs cubiertos (u32, ordenados); la tabla de
+// trigramas ordenada (trigrama, frecuencia en documentos (u32), offset de
+// su lista (u64)) y las listas de doc IDs como diferencias en varints LEB128.
+
+#include <stdio.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define TRIGRAM_INDEX_SUFFIX ".trigrams"
+#define TRIGRAM_INDEX_MAGIC 0x4D475254    // "TRGM"
+#define TRIGRAM_INDEX_VERSION 1
+#define TRIGRAM_ENTRY_SIZE 16
+
+// Construcción: pares (trigrama, doc_id) que se ordenan al guardar
+typedef struct {
+    uint64_t *pairs;          // (trigrama << 32) | doc_id
+    size_t count;
+    size_t capacity;
+    uint32_t *docs;           // Documentos cubiertos
+    size_t doc_count;
+    size_t doc_capacity;
+    uint8_t *seen;            // Bitmap de 2^24 bits del documento en curso
+} TrigramBuilder;
+
+int initTrigramBuilder(TrigramBuilder *builder);
+void freeTrigramBuilder(TrigramBuilder *builder);
+// Carga el archivo del índice en el builder para ampliarlo; 1 si no existe
+int loadTrigramBuilder(TrigramBuilder *builder, const char *index_path);
+int addTrigramText(TrigramBuilder *builder, uint32_t doc_id, const char *text, size_t len);
+int addTrigramFile(TrigramBuilder *builder, uint32_t doc_id, const char *path);
+int saveTrigramIndex(TrigramBuilder *builder, const char *index_path);
+int removeTrigramIndex(const char *index_path);
+
+// Consulta: la tabla se carga entera y las listas se leen bajo demanda
+typedef struct {
+    uint32_t trigram;
+    uint32_t doc_frequency;
+    uint64_t offset;
+} TrigramEntry;
+
+typedef struct {
+    FILE *file;
+    uint32_t *docs;           // Documentos cubiertos (ordenados)
+    size_t doc_count;
+    TrigramEntry *entries;
+    size_t count;
+    uint64_t postings_offset;
+} TrigramIndex;
+
+// NULL si el índice no tiene trigramas (o el archivo no es válido)
+TrigramIndex* openTrigramIndex(const char *index_path);
+void closeTrigramIndex(TrigramIndex *trigrams);
+// candidate[doc_id] = 1 para los documentos que pueden contener el patrón:
+// los cubiertos que tienen todos sus trigramas y los no cubiertos (añadidos
+// sin trigramas). Devuelve -1 si el patrón no tiene trigramas (menos de 3
+// bytes): entonces no filtra nada.
+int trigramCandidates(TrigramIndex *trigrams, const char *pattern,
+                      unsigned char *candidate, size_t id_limit);
+
+#endif
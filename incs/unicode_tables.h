@@ -0,0 +1,39 @@
+// Diego Galindo, Francisco Mercado
+#ifndef UNICODE_TABLES_H
+#define UNICODE_TABLES_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Tablas de normalización generadas al compilar por tools/gen_unicode_tables
+// (obj/unicode_tables.c). Trie de dos niveles sobre el BMP: el byte alto del
+// code-point selecciona un bloque de 256 entradas y el byte bajo el registro.
+
+#define UNORM_COMBINING 0x01  // Marca combinada (U+0300-U+036F)
+
+// Mapeos de un code-point: offset y longitud dentro de unorm_pool
+typedef struct {
+    uint16_t fold, strip, nfd;
+    uint8_t fold_len, strip_len, nfd_len;
+    uint8_t flags;
+} UnormRecord;
+
+// Composición NFC: base + marca -> precompuesto
+typedef struct {
+    uint32_t base, mark, composed;
+} UnormComposition;
+
+extern const uint16_t unorm_stage1[256];
+extern const uint16_t unorm_stage2[];
+extern const UnormRecord unorm_records[];
+extern const uint32_t unorm_pool[];
+extern const UnormComposition unorm_compositions[];
+extern const size_t unorm_composition_count;
+
+// Registro de un code-point; fuera del BMP no hay mapeos (registro 0)
+static inline const UnormRecord* unorm_lookup(uint32_t cp) {
+    if (cp > 0xFFFF) return &unorm_records[0];
+    return &unorm_records[unorm_stage2[(size_t)unorm_stage1[cp >> 8] * 256 + (cp & 0xFF)]];
+}
+
+#endif
@@ -3,6 +3,7 @@
 #define UTILS_H
 
 #include <stddef.h>
+#include <stdint.h>
 
 // Enumeración para formas de normalización Unicode
 typedef enum {
@@ -10,11 +11,25 @@ typedef enum {
     UNICODE_NFD  // Forma canónica descompuesta
 } unicode_normalization_form;
 
+// Banderas para unicode_normalize_alloc (combinables con |)
+enum {
+    UNORM_NFC = 1 << 0,              // Componer base + marca combinada
+    UNORM_NFD = 1 << 1,              // Descomponer precompuestos
+    UNORM_CASEFOLD = 1 << 2,         // Case-folding Unicode
+    UNORM_STRIP_DIACRITICS = 1 << 3  // Quitar diacríticos y marcas combinadas
+};
+
+// Normaliza len bytes de in en una sola pasada; devuelve un búfer nuevo
+// terminado en '\0' (liberar con free) y su longitud en out_len
+char* unicode_normalize_alloc(const char* in, size_t len, unsigned flags, size_t* out_len);
+
 void unicode_case_fold(char* str);
 void unicode_normalize(char* str, unicode_normalization_form form);
 void remove_diacritics(char* str, int enable_removal);
 void unicode_normalize_full(char* str, int remove_diacritics_flag);
 char* loadFile(const char* filename);
+// Hash FNV-1a del contenido del archivo; 0 si tuvo éxito
+int hashFile(const char* filename, uint64_t* hash);
 void toLowerInPlace(char* s);
 void squeezeSpaces(char* s);
 void convertir_a_minusculas(char *palabra);
@@ -0,0 +1,2513 @@
+// Archivo generado por tools/gen_html_entities; no editar.
+#include "html_entities.h"
+
+const size_t html_entity_bucket_count = 558;
+const size_t html_entity_slot_count = 2455;
+
+const uint16_t html_entity_disp[558] = {
+    109, 16, 49, 1, 1, 21, 15, 2, 8, 32, 14, 15,
+    1, 7, 5, 8, 16, 30, 43, 7, 109, 10, 0, 14,
+    1, 7, 45, 4, 5, 5, 0, 2, 40, 25, 5, 3,
+    2, 2, 12, 6, 7, 14, 6, 1, 21, 11, 13, 90,
+    4, 17, 7, 9, 71, 4, 35, 37, 8, 6, 34, 27,
+    1, 3, 50, 15, 4, 2, 5, 1, 8, 1, 8, 13,
+    4, 8, 71, 3, 0, 3, 3, 0, 37, 96, 1, 32,
+    1, 19, 5, 34, 0, 1, 6, 34, 27, 6, 4, 4,
+    11, 2, 3, 14, 1, 13, 1, 17, 57, 30, 2, 61,
+    27, 124, 9, 10, 46, 98, 14, 5, 0, 22, 154, 4,
+    4, 7, 3, 0, 13, 15, 26, 104, 3, 5, 28, 58,
+    9, 10, 3, 12, 65, 38, 35, 3, 4, 7, 4, 27,
+    4, 7, 7, 1, 39, 21, 41, 140, 2, 28, 8, 77,
+    2, 11, 26, 78, 2, 2, 1, 177, 1, 15, 21, 1,
+    18, 0, 6, 5, 173, 4, 22, 1, 129, 20, 178, 89,
+    1, 143, 2, 12, 2, 95, 56, 32, 31, 20, 16, 8,
+    7, 12, 25, 42, 11, 1, 9, 17, 3, 1, 1, 14,
+    1, 22, 0, 13, 8, 3, 2, 0, 3, 7, 1, 1,
+    1, 3, 1, 9, 4, 105, 45, 1, 9, 3, 10, 2,
+    20, 3, 1, 103, 4, 8, 14, 44, 38, 1, 13, 0,
+    11, 138, 47, 15, 10, 10, 32, 27, 12, 10, 61, 9,
+    21, 43, 38, 10, 1, 2, 75, 23, 1, 14, 30, 88,
+    0, 22, 20, 1, 94, 10, 92, 48, 4, 0, 11, 116,
+    82, 8, 44, 3, 16, 6, 15, 2, 208, 2, 9, 3,
+    28, 9, 1, 42, 11, 182, 20, 136, 116, 2, 22, 237,
+    1, 18, 198, 10, 52, 86, 8, 104, 0, 54, 64, 14,
+    1, 93, 255, 3, 1, 45, 16, 20, 112, 49, 388, 15,
+    9, 93, 24, 19, 4, 1, 19, 2, 99, 8, 117, 30,
+    109, 3, 15, 52, 1, 13, 71, 16, 100, 8, 28, 49,
+    22, 7, 20, 31, 89, 1, 1, 49, 1, 1, 1, 15,
+    1, 10, 101, 53, 13, 22, 11, 12, 155, 22, 7, 10,
+    92, 136, 21, 35, 2, 108, 12, 69, 5, 1, 2, 80,
+    3, 21, 6, 2, 10, 129, 5, 27, 1, 5, 4, 5,
+    30, 18, 4, 0, 99, 288, 14, 40, 41, 3, 41, 56,
+    133, 31, 82, 88, 107, 6, 118, 49, 30, 1, 66, 43,
+    77, 1, 3, 1, 229, 119, 50, 239, 44, 49, 7, 45,
+    112, 88, 1, 5, 44, 8, 7, 2, 5, 24, 19, 13,
+    5, 91, 40, 43, 7, 47, 257, 5, 92, 31, 28, 2,
+    14, 18, 29, 1, 57, 190, 101, 79, 5, 8, 46, 345,
+    55, 331, 2, 88, 158, 12, 6, 3, 15, 202, 164, 12,
+    13, 325, 12, 53, 188, 27, 280, 1, 2, 16, 1, 3,
+    5, 2, 12, 3, 71, 12, 5, 35, 96, 31, 9, 240,
+    9, 28, 65, 53, 2, 234, 55, 0, 69, 15, 87, 289,
+    3, 125, 5, 9, 3, 0, 9, 75, 6, 29, 110, 145,
+    2, 80, 4, 1, 70, 46, 2, 72, 15, 97, 4, 338,
+    41, 44, 17, 10, 119, 102, 16, 8, 0, 6, 3, 3,
+    230, 1, 34, 4, 8, 245,
+};
+
+const HtmlEntity html_entity_slots[2455] = {
+    { "par;", "\342\210\245", 4, 3 },
+    { "Eacute", "\303\211", 6, 2 },
+    { NULL, NULL, 0, 0 },
+    { "supsub;", "\342\253\224", 7, 3 },
+    { "mho;", "\342\204\247", 4, 3 },
+    { "looparrowleft;", "\342\206\253", 14, 3 },
+    { "NotLessLess;", "\342\211\252\314\270", 12, 5 },
+    { "eacute;", "\303\251", 7, 2 },
+    { "cups;", "\342\210\252\357\270\200", 5, 6 },
+    { "oast;", "\342\212\233", 5, 3 },
+    { "starf;", "\342\230\205", 6, 3 },
+    { "GreaterGreater;", "\342\252\242", 15, 3 },
+    { "vcy;", "\320\262", 4, 2 },
+    { "bigotimes;", "\342\250\202", 10, 3 },
+    { "SucceedsSlantEqual;", "\342\211\275", 19, 3 },
+    { "nbumpe;", "\342\211\217\314\270", 7, 5 },
+    { "tridot;", "\342\227\254", 7, 3 },
+    { "hopf;", "\360\235\225\231", 5, 4 },
+    { "ufisht;", "\342\245\276", 7, 3 },
+    { "DiacriticalDoubleAcute;", "\313\235", 23, 2 },
+    { "reg;", "\302\256", 4, 2 },
+    { "cong;", "\342\211\205", 5, 3 },
+    { "rx;", "\342\204\236", 3, 3 },
+    { "nVDash;", "\342\212\257", 7, 3 },
+    { "AMP", "&", 3, 1 },
+    { "PrecedesTilde;", "\342\211\276", 14, 3 },
+    { "Atilde;", "\303\203", 7, 2 },
+    { "OverParenthesis;", "\342\217\234", 16, 3 },
+    { "die;", "\302\250", 4, 2 },
+    { "trade;", "\342\204\242", 6, 3 },
+    { "elsdot;", "\342\252\227", 7, 3 },
+    { "nleq;", "\342\211\260", 5, 3 },
+    { "GreaterEqualLess;", "\342\213\233", 17, 3 },
+    { "iacute;", "\303\255", 7, 2 },
+    { "ncongdot;", "\342\251\255\314\270", 9, 5 },
+    { "realpart;", "\342\204\234", 9, 3 },
+    { "shortparallel;", "\342\210\245", 14, 3 },
+    { "nrarr;", "\342\206\233", 6, 3 },
+    { "LeftUpVector;", "\342\206\277", 13, 3 },
+    { "KJcy;", "\320\214", 5, 2 },
+    { "Upsilon;", "\316\245", 8, 2 },
+    { "Sacute;", "\305\232", 7, 2 },
+    { "Eta;", "\316\227", 4, 2 },
+    { "mapstoup;", "\342\206\245", 9, 3 },
+    { NULL, NULL, 0, 0 },
+    { "complexes;", "\342\204\202", 10, 3 },
+    { "laquo;", "\302\253", 6, 2 },
+    { "NotLeftTriangleBar;", "\342\247\217\314\270", 19, 5 },
+    { "in;", "\342\210\210", 3, 3 },
+    { "thicksim;", "\342\210\274", 9, 3 },
+    { "topfork;", "\342\253\232", 8, 3 },
+    { "rbrke;", "\342\246\214", 6, 3 },
+    { "kappa;", "\316\272", 6, 2 },
+    { "diam;", "\342\213\204", 5, 3 },
+    { "bigtriangledown;", "\342\226\275", 16, 3 },
+    { "NotCongruent;", "\342\211\242", 13, 3 },
+    { "YAcy;", "\320\257", 5, 2 },
+    { "nearr;", "\342\206\227", 6, 3 },
+    { "notinva;", "\342\210\211", 8, 3 },
+    { "bprime;", "\342\200\265", 7, 3 },
+    { "part;", "\342\210\202", 5, 3 },
+    { "NotLeftTriangleEqual;", "\342\213\254", 21, 3 },
+    { "delta;", "\316\264", 6, 2 },
+    { "CloseCurlyDoubleQuote;", "\342\200\235", 22, 3 },
+    { "Dscr;", "\360\235\222\237", 5, 4 },
+    { "bottom;", "\342\212\245", 7, 3 },
+    { "Rscr;", "\342\204\233", 5, 3 },
+    { "minusdu;", "\342\250\252", 8, 3 },
+    { "heartsuit;", "\342\231\245", 10, 3 },
+    { "Fopf;", "\360\235\224\275", 5, 4 },
+    { "xoplus;", "\342\250\201", 7, 3 },
+    { "boxh;", "\342\224\200", 5, 3 },
+    { "nrarrc;", "\342\244\263\314\270", 7, 5 },
+    { "doteq;", "\342\211\220", 6, 3 },
+    { "scpolint;", "\342\250\223", 9, 3 },
+    { "qfr;", "\360\235\224\256", 4, 4 },
+    { "DoubleRightArrow;", "\342\207\222", 17, 3 },
+    { "ensp;", "\342\200\202", 5, 3 },
+    { "Tcy;", "\320\242", 4, 2 },
+    { "Jopf;", "\360\235\225\201", 5, 4 },
+    { "ndash;", "\342\200\223", 6, 3 },
+    { NULL, NULL, 0, 0 },
+    { NULL, NULL, 0, 0 },
+    { "pound;", "\302\243", 6, 2 },
+    { "smt;", "\342\252\252", 4, 3 },
+    { NULL, NULL, 0, 0 },
+    { "nsub;", "\342\212\204", 5, 3 },
+    { "varsupsetneqq;", "\342\253\214\357\270\200", 14, 6 },
+    { "ShortUpArrow;", "\342\206\221", 13, 3 },
+    { "FilledVerySmallSquare;", "\342\226\252", 22, 3 },
+    { NULL, NULL, 0, 0 },
+    { "le;", "\342\211\244", 3, 3 },
+    { "LeftArrowBar;", "\342\207\244", 13, 3 },
+    { "Barv;", "\342\253\247", 5, 3 },
+    { "neArr;", "\342\207\227", 6, 3 },
+    { "supdot;", "\342\252\276", 7, 3 },
+    { "Amacr;", "\304\200", 6, 2 },
+    { "eDot;", "\342\211\221", 5, 3 },
+    { "nopf;", "\360\235\225\237", 5, 4 },
+    { "dzcy;", "\321\237", 5, 2 },
+    { "iinfin;", "\342\247\234", 7, 3 },
+    { "hearts;", "\342\231\245", 7, 3 },
+    { "iopf;", "\360\235\225\232", 5, 4 },
+    { "jcy;", "\320\271", 4, 2 },
+    { "boxvr;", "\342\224\234", 6, 3 },
+    { "swnwar;", "\342\244\252", 7, 3 },
+    { NULL, NULL, 0, 0 },
+    { "rarr;", "\342\206\222", 5, 3 },
+    { "lrtri;", "\342\212\277", 6, 3 },
+    { "gl;", "\342\211\267", 3, 3 },
+    { "ntlg;", "\342\211\270", 5, 3 },
+    { NULL, NULL, 0, 0 },
+    { "Star;", "\342\213\206", 5, 3 },
+    { "Verbar;", "\342\200\226", 7, 3 },
+    { "smashp;", "\342\250\263", 7, 3 },
+    { "Uuml;", "\303\234", 5, 2 },
+    { "Edot;", "\304\226", 5, 2 },
+    { NULL, NULL, 0, 0 },
+    { "Tilde;", "\342\210\274", 6, 3 },
+    { "DownRightVector;", "\342\207\201", 16, 3 },
+    { "numero;", "\342\204\226", 7, 3 },
+    { "UnderParenthesis;", "\342\217\235", 17, 3 },
+    { "zigrarr;", "\342\207\235", 8, 3 },
+    { "cupcap;", "\342\251\206", 7, 3 },
+    { NULL, NULL, 0, 0 },
+    { NULL, NULL, 0, 0 },
+    { "Conint;", "\342\210\257", 7, 3 },
+    { "Rsh;", "\342\206\261", 4, 3 },
+    { "frasl;", "\342\201\204", 6, 3 },
+    { "tfr;", "\360\235\224\261", 4, 4 },
+    { "lHar;", "\342\245\242", 5, 3 },
+    { "telrec;", "\342\214\225", 7, 3 },
+    { NULL, NULL, 0, 0 },
+    { "varsubsetneqq;", "\342\253\213\357\270\200", 14, 6 },
+    { "NotSucceedsEqual;", "\342\252\260\314\270", 17, 5 },
+    { "nsupE;", "\342\253\206\314\270", 6, 5 },
+    { "Cross;", "\342\250\257", 6, 3 },
+    { "checkmark;", "\342\234\223", 10, 3 },
+    { "tshcy;", "\321\233", 6, 2 },
+    { "agrave;", "\303\240", 7, 2 },
+    { "copy", "\302\251", 4, 2 },
+    { "UnderBar;", "_", 9, 1 },
+    { "lbrkslu;", "\342\246\215", 8, 3 },
+    { "ohbar;", "\342\246\265", 6, 3 },
+    { "Gammad;", "\317\234", 7, 2 },
+    { "Ouml;", "\303\226", 5, 2 },
+    { NULL, NULL, 0, 0 },
+    { "LeftVectorBar;", "\342\245\222", 14, 3 },
+    { "nwarrow;", "\342\206\226", 8, 3 },
+    { "Uparrow;", "\342\207\221", 8, 3 },
+    { "lthree;", "\342\213\213", 7, 3 },
+    { "prurel;", "\342\212\260", 7, 3 },
+    { "mapstoleft;", "\342\206\244", 11, 3 },
+    { "rightarrow;", "\342\206\222", 11, 3 },
+    { "LeftTriangle;", "\342\212\262", 13, 3 },
+    { "tscr;", "\360\235\223\211", 5, 4 },
+    { "TripleDot;", "\342\203\233", 10, 3 },
+    { "harrcir;", "\342\245\210", 8, 3 },
+    { "LeftVector;", "\342\206\274", 11, 3 },
+    { "Yacute", "\303\235", 6, 2 },
+    { "diams;", "\342\231\246", 6, 3 },
+    { "gel;", "\342\213\233", 4, 3 },
+    { NULL, NULL, 0, 0 },
+    { "LeftRightArrow;", "\342\206\224", 15, 3 },
+    { "bernou;", "\342\204\254", 7, 3 },
+    { "bfr;", "\360\235\224\237", 4, 4 },
+    { "SquareSubset;", "\342\212\217", 13, 3 },
+    { "rationals;", "\342\204\232", 10, 3 },
+    { "roang;", "\342\237\255", 6, 3 },
+    { "vee;", "\342\210\250", 4, 3 },
+    { "becaus;", "\342\210\265", 7, 3 },
+    { "rightharpoondown;", "\342\207\201", 17, 3 },
+    { "comma;", ",", 6, 1 },
+    { NULL, NULL, 0, 0 },
+    { "cylcty;", "\342\214\255", 7, 3 },
+    { "nlsim;", "\342\211\264", 6, 3 },
+    { NULL, NULL, 0, 0 },
+    { "NotPrecedes;", "\342\212\200", 12, 3 },
+    { "NotLessGreater;", "\342\211\270", 15, 3 },
+    { NULL, NULL, 0, 0 },
+    { "oplus;", "\342\212\225", 6, 3 },
+    { "vellip;", "\342\213\256", 7, 3 },
+    { "CircleTimes;", "\342\212\227", 12, 3 },
+    { NULL, NULL, 0, 0 },
+    { "Ucirc;", "\303\233", 6, 2 },
+    { "triangleright;", "\342\226\271", 14, 3 },
+    { "rdquor;", "\342\200\235", 7, 3 },
+    { "nsimeq;", "\342\211\204", 7, 3 },
+    { "duarr;", "\342\207\265", 6, 3 },
+    { "Aring", "\303\205", 5, 2 },
+    { "NotCupCap;", "\342\211\255", 10, 3 },
+    { "sigmav;", "\317\202", 7, 2 },
+    { "ogt;", "\342\247\201", 4, 3 },
+    { "ntrianglelefteq;", "\342\213\254", 16, 3 },
+    { "laquo", "\302\253", 5, 2 },
+    { NULL, NULL, 0, 0 },
+    { "RightArrowLeftArrow;", "\342\207\204", 20, 3 },
+    { "lesssim;", "\342\211\262", 8, 3 },
+    { "Ecy;", "\320\255", 4, 2 },
+    { "blk34;", "\342\226\223", 6, 3 },
+    { "rarrlp;", "\342\206\254", 7, 3 },
+    { "lang;", "\342\237\250", 5, 3 },
+    { "Prime;", "\342\200\263", 6, 3 },
+    { "leq;", "\342\211\244", 4, 3 },
+    { "boxHD;", "\342\225\246", 6, 3 },
+    { "Gcy;", "\320\223", 4, 2 },
+    { "Lcaron;", "\304\275", 7, 2 },
+    { "uml;", "\302\250", 4, 2 },
+    { "ordm;", "\302\272", 5, 2 },
+    { "edot;", "\304\227", 5, 2 },
+    { NULL, NULL, 0, 0 },
+    { "lurdshar;", "\342\245\212", 9, 3 },
+    { "gesdot;", "\342\252\200", 7, 3 },
+    { "plusacir;", "\342\250\243", 9, 3 },
+    { NULL, NULL, 0, 0 },
+    { "supne;", "\342\212\213", 6, 3 },
+    { "frac45;", "\342\205\230", 7, 3 },
+    { NULL, NULL, 0, 0 },
+    { "it;", "\342\201\242", 3, 3 },
+    { "vnsub;", "\342\212\202\342\203\222", 6, 6 },
+    { "cedil;", "\302\270", 6, 2 },
+    { "Aopf;", "\360\235\224\270", 5, 4 },
+    { "ogon;", "\313\233", 5, 2 },
+    { "rarrsim;", "\342\245\264", 8, 3 },
+    { "ecirc", "\303\252", 5, 2 },
+    { "Imacr;", "\304\252", 6, 2 },
+    { "Hscr;", "\342\204\213", 5, 3 },
+    { "nbsp", "\302\240", 4, 2 },
+    { "ddagger;", "\342\200\241", 8, 3 },
+    { NULL, NULL, 0, 0 },
+    { "gg;", "\342\211\253", 3, 3 },
+    { "equals;", "=", 7, 1 },
+    { NULL, NULL, 0, 0 },
+    { NULL, NULL, 0, 0 },
+    { "nu;", "\316\275", 3, 2 },
+    { NULL, NULL, 0, 0 },
+    { "uacute", "\303\272", 6, 2 },
+    { "leftrightsquigarrow;", "\342\206\255", 20, 3 },
+    { "ImaginaryI;", "\342\205\210", 11, 3 },
+    { "upsilon;", "\317\205", 8, 2 },
+    { NULL, NULL, 0, 0 },
+    { "tdot;", "\342\203\233", 5, 3 },
+    { "approx;", "\342\211\210", 7, 3 },
+    { "spades;", "\342\231\240", 7, 3 },
+    { "pound", "\302\243", 5, 2 },
+    { "tscy;", "\321\206", 5, 2 },
+    { "hscr;", "\360\235\222\275", 5, 4 },
+    { "lbrace;", "{", 7, 1 },
+    { "bsol;", "\\", 5, 1 },
+    { "LeftDownTeeVector;", "\342\245\241", 18, 3 },
+    { "ntilde", "\303\261", 6, 2 },
+    { "lmidot;", "\305\200", 7, 2 },
+    { NULL, NULL, 0, 0 },
+    { "yuml;", "\303\277", 5, 2 },
+    { "oslash;", "\303\270", 7, 2 },
+    { "Yuml;", "\305\270", 5, 2 },
+    { "nges;", "\342\251\276\314\270", 5, 5 },
+    { "hArr;", "\342\207\224", 5, 3 },
+    { "xhArr;", "\342\237\272", 6, 3 },
+    { NULL, NULL, 0, 0 },
+    { "piv;", "\317\226", 4, 2 },
+    { "RightCeiling;", "\342\214\211", 13, 3 },
+    { "DoubleContourIntegral;", "\342\210\257", 22, 3 },
+    { "zscr;", "\360\235\223\217", 5, 4 },
+    { "erDot;", "\342\211\223", 6, 3 },
+    { "infin;", "\342\210\236", 6, 3 },
+    { "Fscr;", "\342\204\261", 5, 3 },
+    { "rarrfs;", "\342\244\236", 7, 3 },
+    { "natur;", "\342\231\256", 6, 3 },
+    { "nbsp;", "\302\240", 5, 2 },
+    { "nsucceq;", "\342\252\260\314\270", 8, 5 },
+    { "leftthreetimes;", "\342\213\213", 15, 3 },
+    { NULL, NULL, 0, 0 },
+    { "ShortDownArrow;", "\342\206\223", 15, 3 },
+    { "vsupnE;", "\342\253\214\357\270\200", 7, 6 },
+    { "curvearrowleft;", "\342\206\266", 15, 3 },
+    { "iff;", "\342\207\224", 4, 3 },
+    { "drcorn;", "\342\214\237", 7, 3 },
+    { "rlarr;", "\342\207\204", 6, 3 },
+    { "boxVr;", "\342\225\237", 6, 3 },
+    { "THORN", "\303\236", 5, 2 },
+    { "Lstrok;", "\305\201", 7, 2 },
+    { "aelig;", "\303\246", 6, 2 },
+    { "EqualTilde;", "\342\211\202", 11, 3 },
+    { "darr;", "\342\206\223", 5, 3 },
+    { "bull;", "\342\200\242", 5, 3 },
+    { "measuredangle;", "\342\210\241", 14, 3 },
+    { "Re;", "\342\204\234", 3, 3 },
+    { "xodot;", "\342\250\200", 6, 3 },
+    { "ffllig;", "\357\254\204", 7, 3 },
+    { NULL, NULL, 0, 0 },
+    { "divide", "\303\267", 6, 2 },
+    { "nvap;", "\342\211\215\342\203\222", 5, 6 },
+    { "hbar;", "\342\204\217", 5, 3 },
+    { "CenterDot;", "\302\267", 10, 2 },
+    { "thorn;", "\303\276", 6, 2 },
+    { "Esim;", "\342\251\263", 5, 3 },
+    { "ENG;", "\305\212", 4, 2 },
+    { "wp;", "\342\204\230", 3, 3 },
+    { "oror;", "\342\251\226", 5, 3 },
+    { "sol;", "/", 4, 1 },
+    { "boxDr;", "\342\225\223", 6, 3 },
+    { "epsi;", "\316\265", 5, 2 },
+    { "Dashv;", "\342\253\244", 6, 3 },
+    { "Xfr;", "\360\235\224\233", 4, 4 },
+    { "ldrushar;", "\342\245\213", 9, 3 },
+    { "dtri;", "\342\226\277", 5, 3 },
+    { "NotTildeEqual;", "\342\211\204", 14, 3 },
+    { NULL, NULL, 0, 0 },
+    { "acute;", "\302\264", 6, 2 },
+    { "varsubsetneq;", "\342\212\212\357\270\200", 13, 6 },
+    { "frac16;", "\342\205\231", 7, 3 },
+    { "ncup;", "\342\251\202", 5, 3 },
+    { "blank;", "\342\220\243", 6, 3 },
+    { "rotimes;", "\342\250\265", 8, 3 },
+    { "simne;", "\342\211\206", 6, 3 },
+    { NULL, NULL, 0, 0 },
+    { "oelig;", "\305\223", 6, 2 },
+    { "boxVL;", "\342\225\243", 6, 3 },
+    { "NestedGreaterGreater;", "\342\211\253", 21, 3 },
+    { "curlyeqprec;", "\342\213\236", 12, 3 },
+    { "DoubleLongLeftArrow;", "\342\237\270", 20, 3 },
+    { "lt", "<", 2, 1 },
+    { "sup;", "\342\212\203", 4, 3 },
+    { "Yacute;", "\303\235", 7, 2 },
+    { NULL, NULL, 0, 0 },
+    { "notnivc;", "\342\213\275", 8, 3 },
+    { NULL, NULL, 0, 0 },
+    { "NotElement;", "\342\210\211", 11, 3 },
+    { "tprime;", "\342\200\264", 7, 3 },
+    { "eplus;", "\342\251\261", 6, 3 },
+    { "bcy;", "\320\261", 4, 2 },
+    { "duhar;", "\342\245\257", 6, 3 },
+    { "backsim;", "\342\210\275", 8, 3 },
+    { "rect;", "\342\226\255", 5, 3 },
+    { "capand;", "\342\251\204", 7, 3 },
+    { "Ograve;", "\303\222", 7, 2 },
+    { "awint;", "\342\250\221", 6, 3 },
+    { "gtreqless;", "\342\213\233", 10, 3 },
+    { "questeq;", "\342\211\237", 8, 3 },
+    { "oscr;", "\342\204\264", 5, 3 },
+    { "nvltrie;", "\342\212\264\342\203\222", 8, 6 },
+    { "multimap;", "\342\212\270", 9, 3 },
+    { "kscr;", "\360\235\223\200", 5, 4 },
+    { "SquareSupersetEqual;", "\342\212\222", 20, 3 },
+    { "lhard;", "\342\206\275", 6, 3 },
+    { "Uuml", "\303\234", 4, 2 },
+    { "deg;", "\302\260", 4, 2 },
+    { "rightleftharpoons;", "\342\207\214", 18, 3 },
+    { "Zscr;", "\360\235\222\265", 5, 4 },
+    { "caron;", "\313\207", 6, 2 },
+    { "lesdot;", "\342\251\277", 7, 3 },
+    { "hkswarow;", "\342\244\246", 9, 3 },
+    { "vprop;", "\342\210\235", 6, 3 },
+    { "sdotb;", "\342\212\241", 6, 3 },
+    { "subsim;", "\342\253\207", 7, 3 },
+    { "DJcy;", "\320\202", 5, 2 },
+    { "Hfr;", "\342\204\214", 4, 3 },
+    { "DownLeftTeeVector;", "\342\245\236", 18, 3 },
+    { "Coproduct;", "\342\210\220", 10, 3 },
+    { "ShortLeftArrow;", "\342\206\220", 15, 3 },
+    { "Odblac;", "\305\220", 7, 2 },
+    { "yscr;", "\360\235\223\216", 5, 4 },
+    { "hardcy;", "\321\212", 7, 2 },
+    { "Barwed;", "\342\214\206", 7, 3 },
+    { "Vfr;", "\360\235\224\231", 4, 4 },
+    { "lmoustache;", "\342\216\260", 11, 3 },
+    { "vartheta;", "\317\221", 9, 2 },
+    { "Cap;", "\342\213\222", 4, 3 },
+    { "ljcy;", "\321\231", 5, 2 },
+    { "ldrdhar;", "\342\245\247", 8, 3 },
+    { "csub;", "\342\253\217", 5, 3 },
+    { "VerticalSeparator;", "\342\235\230", 18, 3 },
+    { "Ycy;", "\320\253", 4, 2 },
+    { "lescc;", "\342\252\250", 6, 3 },
+    { "DotDot;", "\342\203\234", 7, 3 },
+    { "lmoust;", "\342\216\260", 7, 3 },
+    { "ulcorner;", "\342\214\234", 9, 3 },
+    { NULL, NULL, 0, 0 },
+    { "blacktriangledown;", "\342\226\276", 18, 3 },
+    { "larrpl;", "\342\244\271", 7, 3 },
+    { "ApplyFunction;", "\342\201\241", 14, 3 },
+    { "Popf;", "\342\204\231", 5, 3 },
+    { NULL, NULL, 0, 0 },
+    { "blk12;", "\342\226\222", 6, 3 },
+    { "swarrow;", "\342\206\231", 8, 3 },
+    { "npart;", "\342\210\202\314\270", 6, 5 },
+    { "dashv;", "\342\212\243", 6, 3 },
+    { "lne;", "\342\252\207", 4, 3 },
+    { "ordm", "\302\272", 4, 2 },
+    { "nparallel;", "\342\210\246", 10, 3 },
+    { "squarf;", "\342\226\252", 7, 3 },
+    { "sdot;", "\342\213\205", 5, 3 },
+    { "seswar;", "\342\244\251", 7, 3 },
+    { "numsp;", "\342\200\207", 6, 3 },
+    { "incare;", "\342\204\205", 7, 3 },
+    { "kcy;", "\320\272", 4, 2 },
+    { "lBarr;", "\342\244\216", 6, 3 },
+    { "scy;", "\321\201", 4, 2 },
+    { "Dagger;", "\342\200\241", 7, 3 },
+    { "Igrave;", "\303\214", 7, 2 },
+    { "orslope;", "\342\251\227", 8, 3 },
+    { "RoundImplies;", "\342\245\260", 13, 3 },
+    { "bcong;", "\342\211\214", 6, 3 },
+    { "UpTee;", "\342\212\245", 6, 3 },
+    { "NegativeThickSpace;", "\342\200\213", 19, 3 },
+    { "thinsp;", "\342\200\211", 7, 3 },
+    { "ssetmn;", "\342\210\226", 7, 3 },
+    { "sup3;", "\302\263", 5, 2 },
+    { "shchcy;", "\321\211", 7, 2 },
+    { NULL, NULL, 0, 0 },
+    { "gt", ">", 2, 1 },
+    { "profline;", "\342\214\222", 9, 3 },
+    { "softcy;", "\321\214", 7, 2 },
+    { "supsim;", "\342\253\210", 7, 3 },
+    { "mapstodown;", "\342\206\247", 11, 3 },
+    { "aacute;", "\303\241", 7, 2 },
+    { "PrecedesSlantEqual;", "\342\211\274", 19, 3 },
+    { "notindot;", "\342\213\265\314\270", 9, 5 },
+    { "nvHarr;", "\342\244\204", 7, 3 },
+    { "loplus;", "\342\250\255", 7, 3 },
+    { "DownLeftVector;", "\342\206\275", 15, 3 },
+    { "yen", "\302\245", 3, 2 },
+    { "xopf;", "\360\235\225\251", 5, 4 },
+    { "scnsim;", "\342\213\251", 7, 3 },
+    { "ctdot;", "\342\213\257", 6, 3 },
+    { "iogon;", "\304\257", 6, 2 },
+    { "Eopf;", "\360\235\224\274", 5, 4 },
+    { "lagran;", "\342\204\222", 7, 3 },
+    { "ubrcy;", "\321\236", 6, 2 },
+    { "aopf;", "\360\235\225\222", 5, 4 },
+    { "lvnE;", "\342\211\250\357\270\200", 5, 6 },
+    { "simgE;", "\342\252\240", 6, 3 },
+    { "Oacute;", "\303\223", 7, 2 },
+    { "frac12;", "\302\275", 7, 2 },
+    { NULL, NULL, 0, 0 },
+    { "boxdr;", "\342\224\214", 6, 3 },
+    { "Mellintrf;", "\342\204\263", 10, 3 },
+    { "veebar;", "\342\212\273", 7, 3 },
+    { "ffr;", "\360\235\224\243", 4, 4 },
+    { "LeftUpTeeVector;", "\342\245\240", 16, 3 },
+    { "cularrp;", "\342\244\275", 8, 3 },
+    { "imagpart;", "\342\204\221", 9, 3 },
+    { "Gbreve;", "\304\236", 7, 2 },
+    { "Uacute;", "\303\232", 7, 2 },
+    { "diamondsuit;", "\342\231\246", 12, 3 },
+    { "egrave", "\303\250", 6, 2 },
+    { "lesseqqgtr;", "\342\252\213", 11, 3 },
+    { NULL, NULL, 0, 0 },
+    { "lsaquo;", "\342\200\271", 7, 3 },
+    { "epsiv;", "\317\265", 6, 2 },
+    { NULL, NULL, 0, 0 },
+    { "Square;", "\342\226\241", 7, 3 },
+    { "ijlig;", "\304\263", 6, 2 },
+    { "lrarr;", "\342\207\206", 6, 3 },
+    { "AMP;", "&", 4, 1 },
+    { "nmid;", "\342\210\244", 5, 3 },
+    { "olcross;", "\342\246\273", 8, 3 },
+    { "simrarr;", "\342\245\262", 8, 3 },
+    { "euml", "\303\253", 4, 2 },
+    { "asymp;", "\342\211\210", 6, 3 },
+    { "raquo;", "\302\273", 6, 2 },
+    { NULL, NULL, 0, 0 },
+    { "SquareSuperset;", "\342\212\220", 15, 3 },
+    { "xrArr;", "\342\237\271", 6, 3 },
+    { NULL, NULL, 0, 0 },
+    { "mscr;", "\360\235\223\202", 5, 4 },
+    { "boxhD;", "\342\225\245", 6, 3 },
+    { "OverBrace;", "\342\217\236", 10, 3 },
+    { "gneqq;", "\342\211\251", 6, 3 },
+    { NULL, NULL, 0, 0 },
+    { "lap;", "\342\252\205", 4, 3 },
+    { "nrarrw;", "\342\206\235\314\270", 7, 5 },
+    { "boxul;", "\342\224\230", 6, 3 },
+    { "rightrightarrows;", "\342\207\211", 17, 3 },
+    { "acute", "\302\264", 5, 2 },
+    { NULL, NULL, 0, 0 },
+    { "bigoplus;", "\342\250\201", 9, 3 },
+    { "Auml;", "\303\204", 5, 2 },
+    { "hoarr;", "\342\207\277", 6, 3 },
+    { "sscr;", "\360\235\223\210", 5, 4 },
+    { "Bscr;", "\342\204\254", 5, 3 },
+    { "ascr;", "\360\235\222\266", 5, 4 },
+    { "aelig", "\303\246", 5, 2 },
+    { "csupe;", "\342\253\222", 6, 3 },
+    { "lesg;", "\342\213\232\357\270\200", 5, 6 },
+    { NULL, NULL, 0, 0 },
+    { "prec;", "\342\211\272", 5, 3 },
+    { "cemptyv;", "\342\246\262", 8, 3 },
+    { "lE;", "\342\211\246", 3, 3 },
+    { NULL, NULL, 0, 0 },
+    { "Psi;", "\316\250", 4, 2 },
+    { "lparlt;", "\342\246\223", 7, 3 },
+    { NULL, NULL, 0, 0 },
+    { NULL, NULL, 0, 0 },
+    { "udhar;", "\342\245\256", 6, 3 },
+    { "nprcue;", "\342\213\240", 7, 3 },
+    { "DoubleUpDownArrow;", "\342\207\225", 18, 3 },
+    { NULL, NULL, 0, 0 },
+    { "rsqb;", "]", 5, 1 },
+    { NULL, NULL, 0, 0 },
+    { "raquo", "\302\273", 5, 2 },
+    { "Implies;", "\342\207\222", 8, 3 },
+    { "dlcrop;", "\342\214\215", 7, 3 },
+    { "rhov;", "\317\261", 5, 2 },
+    { "doteqdot;", "\342\211\221", 9, 3 },
+    { "efr;", "\360\235\224\242", 4, 4 },
+    { "precnapprox;", "\342\252\271", 12, 3 },
+    { "boxV;", "\342\225\221", 5, 3 },
+    { "lhblk;", "\342\226\204", 6, 3 },
+    { "Mopf;", "\360\235\225\204", 5, 4 },
+    { "bump;", "\342\211\216", 5, 3 },
+    { "compfn;", "\342\210\230", 7, 3 },
+    { "horbar;", "\342\200\225", 7, 3 },
+    { "ngeqslant;", "\342\251\276\314\270", 10, 5 },
+    { NULL, NULL, 0, 0 },
+    { "LeftTeeArrow;", "\342\206\244", 13, 3 },
+    { "ContourIntegral;", "\342\210\256", 16, 3 },
+    { "gtdot;", "\342\213\227", 6, 3 },
+    { NULL, NULL, 0, 0 },
+    { "minusd;", "\342\210\270", 7, 3 },
+    { NULL, NULL, 0, 0 },
+    { "not", "\302\254", 3, 2 },
+    { "Sup;", "\342\213\221", 4, 3 },
+    { NULL, NULL, 0, 0 },
+    { "pscr;", "\360\235\223\205", 5, 4 },
+    { "dash;", "\342\200\220", 5, 3 },
+    { "vdash;", "\342\212\242", 6, 3 },
+    { "nLl;", "\342\213\230\314\270", 4, 5 },
+    { "varnothing;", "\342\210\205", 11, 3 },
+    { "DoubleDot;", "\302\250", 10, 2 },
+    { NULL, NULL, 0, 0 },
+    { "emptyv;", "\342\210\205", 7, 3 },
+    { "sqsupe;", "\342\212\222", 7, 3 },
+    { "smid;", "\342\210\243", 5, 3 },
+    { NULL, NULL, 0, 0 },
+    { "DoubleLongRightArrow;", "\342\237\271", 21, 3 },
+    { "uArr;", "\342\207\221", 5, 3 },
+    { "circlearrowleft;", "\342\206\272", 16, 3 },
+    { "perp;", "\342\212\245", 5, 3 },
+    { "Laplacetrf;", "\342\204\222", 11, 3 },
+    { NULL, NULL, 0, 0 },
+    { "AElig", "\303\206", 5, 2 },
+    { "elinters;", "\342\217\247", 9, 3 },
+    { "uogon;", "\305\263", 6, 2 },
+    { NULL, NULL, 0, 0 },
+    { "sopf;", "\360\235\225\244", 5, 4 },
+    { "Ograve", "\303\222", 6, 2 },
+    { "ldquo;", "\342\200\234", 6, 3 },
+    { "DownLeftRightVector;", "\342\245\220", 20, 3 },
+    { "Sum;", "\342\210\221", 4, 3 },
+    { "bigodot;", "\342\250\200", 8, 3 },
+    { "Oslash;", "\303\230", 7, 2 },
+    { "nhpar;", "\342\253\262", 6, 3 },
+    { "DiacriticalGrave;", "`", 17, 1 },
+    { "nacute;", "\305\204", 7, 2 },
+    { "smte;", "\342\252\254", 5, 3 },
+    { "NotSucceedsTilde;", "\342\211\277\314\270", 17, 5 },
+    { "Gscr;", "\360\235\222\242", 5, 4 },
+    { "COPY;", "\302\251", 5, 2 },
+    { "trisb;", "\342\247\215", 6, 3 },
+    { "Acirc", "\303\202", 5, 2 },
+    { "pre;", "\342\252\257", 4, 3 },
+    { NULL, NULL, 0, 0 },
+    { "omicron;", "\316\277", 8, 2 },
+    { "UpperRightArrow;", "\342\206\227", 16, 3 },
+    { "xcap;", "\342\213\202", 5, 3 },
+    { "lsquor;", "\342\200\232", 7, 3 },
+    { "eparsl;", "\342\247\243", 7, 3 },
+    { "Vscr;", "\360\235\222\261", 5, 4 },
+    { "lnsim;", "\342\213\246", 6, 3 },
+    { "smtes;", "\342\252\254\357\270\200", 6, 6 },
+    { "dsol;", "\342\247\266", 5, 3 },
+    { NULL, NULL, 0, 0 },
+    { "UpArrowDownArrow;", "\342\207\205", 17, 3 },
+    { "ruluhar;", "\342\245\250", 8, 3 },
+    { "Rarr;", "\342\206\240", 5, 3 },
+    { "Larr;", "\342\206\236", 5, 3 },
+    { "dotsquare;", "\342\212\241", 10, 3 },
+    { "sext;", "\342\234\266", 5, 3 },
+    { "Congruent;", "\342\211\241", 10, 3 },
+    { "NonBreakingSpace;", "\302\240", 17, 2 },
+    { "crarr;", "\342\206\265", 6, 3 },
+    { "rlhar;", "\342\207\214", 6, 3 },
+    { "AElig;", "\303\206", 6, 2 },
+    { "xcirc;", "\342\227\257", 6, 3 },
+    { "Xopf;", "\360\235\225\217", 5, 4 },
+    { "ddarr;", "\342\207\212", 6, 3 },
+    { "ltlarr;", "\342\245\266", 7, 3 },
+    { "ofr;", "\360\235\224\254", 4, 4 },
+    { "napid;", "\342\211\213\314\270", 6, 5 },
+    { "gscr;", "\342\204\212", 5, 3 },
+    { "SOFTcy;", "\320\254", 7, 2 },
+    { "Beta;", "\316\222", 5, 2 },
+    { "lneqq;", "\342\211\250", 6, 3 },
+    { "iexcl", "\302\241", 5, 2 },
+    { "Aring;", "\303\205", 6, 2 },
+    { "DoubleLongLeftRightArrow;", "\342\237\272", 25, 3 },
+    { "midcir;", "\342\253\260", 7, 3 },
+    { "ordf", "\302\252", 4, 2 },
+    { NULL, NULL, 0, 0 },
+    { "npr;", "\342\212\200", 4, 3 },
+    { "Alpha;", "\316\221", 6, 2 },
+    { "Vdash;", "\342\212\251", 6, 3 },
+    { "xlarr;", "\342\237\265", 6, 3 },
+    { "Im;", "\342\204\221", 3, 3 },
+    { "Uarr;", "\342\206\237", 5, 3 },
+    { "solbar;", "\342\214\277", 7, 3 },
+    { "downharpoonleft;", "\342\207\203", 16, 3 },
+    { "nabla;", "\342\210\207", 6, 3 },
+    { "Cscr;", "\360\235\222\236", 5, 4 },
+    { NULL, NULL, 0, 0 },
+    { "intprod;", "\342\250\274", 8, 3 },
+    { "gtreqqless;", "\342\252\214", 11, 3 },
+    { "Iukcy;", "\320\206", 6, 2 },
+    { "middot", "\302\267", 6, 2 },
+    { "nRightarrow;", "\342\207\217", 12, 3 },
+    { "hybull;", "\342\201\203", 7, 3 },
+    { "smeparsl;", "\342\247\244", 9, 3 },
+    { "loarr;", "\342\207\275", 6, 3 },
+    { "amp", "&", 3, 1 },
+    { "Mcy;", "\320\234", 4, 2 },
+    { "caps;", "\342\210\251\357\270\200", 5, 6 },
+    { "Yscr;", "\360\235\222\264", 5, 4 },
+    { "pcy;", "\320\277", 4, 2 },
+    { "ordf;", "\302\252", 5, 2 },
+    { "ll;", "\342\211\252", 3, 3 },
+    { "langd;", "\342\246\221", 6, 3 },
+    { "leftharpoonup;", "\342\206\274", 14, 3 },
+    { "sect", "\302\247", 4, 2 },
+    { "dfisht;", "\342\245\277", 7, 3 },
+    { "Gt;", "\342\211\253", 3, 3 },
+    { "SubsetEqual;", "\342\212\206", 12, 3 },
+    { "Dot;", "\302\250", 4, 2 },
+    { "supE;", "\342\253\206", 5, 3 },
+    { "nang;", "\342\210\240\342\203\222", 5, 6 },
+    { NULL, NULL, 0, 0 },
+    { "Because;", "\342\210\265", 8, 3 },
+    { "Proportional;", "\342\210\235", 13, 3 },
+    { "rfr;", "\360\235\224\257", 4, 4 },
+    { "eqslantgtr;", "\342\252\226", 11, 3 },
+    { "HumpDownHump;", "\342\211\216", 13, 3 },
+    { "Copf;", "\342\204\202", 5, 3 },
+    { "HARDcy;", "\320\252", 7, 2 },
+    { "ccedil", "\303\247", 6, 2 },
+    { "circeq;", "\342\211\227", 7, 3 },
+    { "Pscr;", "\360\235\222\253", 5, 4 },
+    { "Atilde", "\303\203", 6, 2 },
+    { "kappav;", "\317\260", 7, 2 },
+    { "rdsh;", "\342\206\263", 5, 3 },
+    { NULL, NULL, 0, 0 },
+    { "plusdo;", "\342\210\224", 7, 3 },
+    { "lharul;", "\342\245\252", 7, 3 },
+    { "Bfr;", "\360\235\224\205", 4, 4 },
+    { "olcir;", "\342\246\276", 6, 3 },
+    { "lbarr;", "\342\244\214", 6, 3 },
+    { "SuchThat;", "\342\210\213", 9, 3 },
+    { "Agrave", "\303\200", 6, 2 },
+    { "NotRightTriangleBar;", "\342\247\220\314\270", 20, 5 },
+    { "Bumpeq;", "\342\211\216", 7, 3 },
+    { "REG", "\302\256", 3, 2 },
+    { "frac23;", "\342\205\224", 7, 3 },
+    { "square;", "\342\226\241", 7, 3 },
+    { "blacklozenge;", "\342\247\253", 13, 3 },
+    { "iiiint;", "\342\250\214", 7, 3 },
+    { NULL, NULL, 0, 0 },
+    { "solb;", "\342\247\204", 5, 3 },
+    { "Lmidot;", "\304\277", 7, 2 },
+    { NULL, NULL, 0, 0 },
+    { "angmsdad;", "\342\246\253", 9, 3 },
+    { "upharpoonleft;", "\342\206\277", 14, 3 },
+    { "RightTeeArrow;", "\342\206\246", 14, 3 },
+    { "commat;", "@", 7, 1 },
+    { "exponentiale;", "\342\205\207", 13, 3 },
+    { "ZHcy;", "\320\226", 5, 2 },
+    { "mcomma;", "\342\250\251", 7, 3 },
+    { "micro", "\302\265", 5, 2 },
+    { NULL, NULL, 0, 0 },
+    { "gneq;", "\342\252\210", 5, 3 },
+    { "RuleDelayed;", "\342\247\264", 12, 3 },
+    { "ecy;", "\321\215", 4, 2 },
+    { "lsquo;", "\342\200\230", 6, 3 },
+    { "ouml;", "\303\266", 5, 2 },
+    { "isin;", "\342\210\210", 5, 3 },
+    { "NotLessSlantEqual;", "\342\251\275\314\270", 18, 5 },
+    { "bsolb;", "\342\247\205", 6, 3 },
+    { "curren", "\302\244", 6, 2 },
+    { "macr", "\302\257", 4, 2 },
+    { "rsaquo;", "\342\200\272", 7, 3 },
+    { "ropar;", "\342\246\206", 6, 3 },
+    { "NegativeThinSpace;", "\342\200\213", 18, 3 },
+    { "thetav;", "\317\221", 7, 2 },
+    { "leqslant;", "\342\251\275", 9, 3 },
+    { "ugrave", "\303\271", 6, 2 },
+    { NULL, NULL, 0, 0 },
+    { "imped;", "\306\265", 6, 2 },
+    { "rlm;", "\342\200\217", 4, 3 },
+    { "boxuL;", "\342\225\233", 6, 3 },
+    { "bigstar;", "\342\230\205", 8, 3 },
+    { "npre;", "\342\252\257\314\270", 5, 5 },
+    { "capcup;", "\342\251\207", 7, 3 },
+    { "plankv;", "\342\204\217", 7, 3 },
+    { "dharr;", "\342\207\202", 6, 3 },
+    { NULL, NULL, 0, 0 },
+    { "Intersection;", "\342\213\202", 13, 3 },
+    { "nvDash;", "\342\212\255", 7, 3 },
+    { "notni;", "\342\210\214", 6, 3 },
+    { "strns;", "\302\257", 6, 2 },
+    { "searrow;", "\342\206\230", 8, 3 },
+    { "ni;", "\342\210\213", 3, 3 },
+    { NULL, NULL, 0, 0 },
+    { "npar;", "\342\210\246", 5, 3 },
+    { "Lfr;", "\360\235\224\217", 4, 4 },
+    { NULL, NULL, 0, 0 },
+    { "glj;", "\342\252\244", 4, 3 },
+    { "congdot;", "\342\251\255", 8, 3 },
+    { "TildeEqual;", "\342\211\203", 11, 3 },
+    { "copf;", "\360\235\225\224", 5, 4 },
+    { "lpar;", "(", 5, 1 },
+    { "ccupssm;", "\342\251\220", 8, 3 },
+    { "fopf;", "\360\235\225\227", 5, 4 },
+    { "gimel;", "\342\204\267", 6, 3 },
+    { "Acy;", "\320\220", 4, 2 },
+    { "Kcedil;", "\304\266", 7, 2 },
+    { "ring;", "\313\232", 5, 2 },
+    { NULL, NULL, 0, 0 },
+    { "NestedLessLess;", "\342\211\252", 15, 3 },
+    { "Wopf;", "\360\235\225\216", 5, 4 },
+    { "Ugrave;", "\303\231", 7, 2 },
+    { "Ropf;", "\342\204\235", 5, 3 },
+    { "angmsdac;", "\342\246\252", 9, 3 },
+    { "racute;", "\305\225", 7, 2 },
+    { "UpArrowBar;", "\342\244\222", 11, 3 },
+    { "lesdoto;", "\342\252\201", 8, 3 },
+    { "Backslash;", "\342\210\226", 10, 3 },
+    { "lneq;", "\342\252\207", 5, 3 },
+    { NULL, NULL, 0, 0 },
+    { "egs;", "\342\252\226", 4, 3 },
+    { "Ccedil", "\303\207", 6, 2 },
+    { NULL, NULL, 0, 0 },
+    { NULL, NULL, 0, 0 },
+    { NULL, NULL, 0, 0 },
+    { "boxDl;", "\342\225\226", 6, 3 },
+    { "nrArr;", "\342\207\217", 6, 3 },
+    { "boxHd;", "\342\225\244", 6, 3 },
+    { "varphi;", "\317\225", 7, 2 },
+    { "agrave", "\303\240", 6, 2 },
+    { NULL, NULL, 0, 0 },
+    { "NotSquareSuperset;", "\342\212\220\314\270", 18, 5 },
+    { "Dstrok;", "\304\220", 7, 2 },
+    { "shortmid;", "\342\210\243", 9, 3 },
+    { "leqq;", "\342\211\246", 5, 3 },
+    { "bsim;", "\342\210\275", 5, 3 },
+    { "plus;", "+", 5, 1 },
+    { "SHCHcy;", "\320\251", 7, 2 },
+    { NULL, NULL, 0, 0 },
+    { "OverBracket;", "\342\216\264", 12, 3 },
+    { "Aacute", "\303\201", 6, 2 },
+    { "iscr;", "\360\235\222\276", 5, 4 },
+    { "CircleDot;", "\342\212\231", 10, 3 },
+    { "UnionPlus;", "\342\212\216", 10, 3 },
+    { "gamma;", "\316\263", 6, 2 },
+    { NULL, NULL, 0, 0 },
+    { "odsold;", "\342\246\274", 7, 3 },
+    { "seArr;", "\342\207\230", 6, 3 },
+    { "ntriangleright;", "\342\213\253", 15, 3 },
+    { "Supset;", "\342\213\221", 7, 3 },
+    { NULL, NULL, 0, 0 },
+    { "ntriangleleft;", "\342\213\252", 14, 3 },
+    { "Vopf;", "\360\235\225\215", 5, 4 },
+    { "GreaterFullEqual;", "\342\211\247", 17, 3 },
+    { "Jfr;", "\360\235\224\215", 4, 4 },
+    { "ouml", "\303\266", 4, 2 },
+    { "swarr;", "\342\206\231", 6, 3 },
+    { NULL, NULL, 0, 0 },
+    { "LeftFloor;", "\342\214\212", 10, 3 },
+    { "Iopf;", "\360\235\225\200", 5, 4 },
+    { "cupor;", "\342\251\205", 6, 3 },
+    { "nleftarrow;", "\342\206\232", 11, 3 },
+    { "nVdash;", "\342\212\256", 7, 3 },
+    { "sect;", "\302\247", 5, 2 },
+    { "iprod;", "\342\250\274", 6, 3 },
+    { "maltese;", "\342\234\240", 8, 3 },
+    { "Ugrave", "\303\231", 6, 2 },
+    { NULL, NULL, 0, 0 },
+    { "Uscr;", "\360\235\222\260", 5, 4 },
+    { "lceil;", "\342\214\210", 6, 3 },
+    { "daleth;", "\342\204\270", 7, 3 },
+    { "varepsilon;", "\317\265", 11, 2 },
+    { "timesd;", "\342\250\260", 7, 3 },
+    { "nrtri;", "\342\213\253", 6, 3 },
+    { "Lleftarrow;", "\342\207\232", 11, 3 },
+    { "xvee;", "\342\213\201", 5, 3 },
+    { "NotHumpEqual;", "\342\211\217\314\270", 13, 5 },
+    { "sup3", "\302\263", 4, 2 },
+    { "nwArr;", "\342\207\226", 6, 3 },
+    { "scsim;", "\342\211\277", 6, 3 },
+    { "lrm;", "\342\200\216", 4, 3 },
+    { "alefsym;", "\342\204\265", 8, 3 },
+    { "smallsetminus;", "\342\210\226", 14, 3 },
+    { "ord;", "\342\251\235", 4, 3 },
+    { "NotGreaterSlantEqual;", "\342\251\276\314\270", 21, 5 },
+    { "udarr;", "\342\207\205", 6, 3 },
+    { NULL, NULL, 0, 0 },
+    { "ap;", "\342\211\210", 3, 3 },
+    { "infintie;", "\342\247\235", 9, 3 },
+    { "tau;", "\317\204", 4, 2 },
+    { "Updownarrow;", "\342\207\225", 12, 3 },
+    { "ucy;", "\321\203", 4, 2 },
+    { "eqcolon;", "\342\211\225", 8, 3 },
+    { "varsupsetneq;", "\342\212\213\357\270\200", 13, 6 },
+    { "Ifr;", "\342\204\221", 4, 3 },
+    { "szlig;", "\303\237", 6, 2 },
+    { "rthree;", "\342\213\214", 7, 3 },
+    { "rfloor;", "\342\214\213", 7, 3 },
+    { "szlig", "\303\237", 5, 2 },
+    { "frac15;", "\342\205\225", 7, 3 },
+    { "gnapprox;", "\342\252\212", 9, 3 },
+    { "mldr;", "\342\200\246", 5, 3 },
+    { "larrb;", "\342\207\244", 6, 3 },
+    { "dcaron;", "\304\217", 7, 2 },
+    { "psi;", "\317\210", 4, 2 },
+    { "minus;", "\342\210\222", 6, 3 },
+    { "omega;", "\317\211", 6, 2 },
+    { "deg", "\302\260", 3, 2 },
+    { "UnderBracket;", "\342\216\265", 13, 3 },
+    { "boxtimes;", "\342\212\240", 9, 3 },
+    { "quot", "\"", 4, 1 },
+    { "phone;", "\342\230\216", 6, 3 },
+    { "star;", "\342\230\206", 5, 3 },
+    { "swArr;", "\342\207\231", 6, 3 },
+    { "bepsi;", "\317\266", 6, 2 },
+    { "Zfr;", "\342\204\250", 4, 3 },
+    { "drbkarow;", "\342\244\220", 9, 3 },
+    { "gesles;", "\342\252\224", 7, 3 },
+    { "xmap;", "\342\237\274", 5, 3 },
+    { "Iota;", "\316\231", 5, 2 },
+    { "rcy;", "\321\200", 4, 2 },
+    { "Gopf;", "\360\235\224\276", 5, 4 },
+    { "Egrave", "\303\210", 6, 2 },
+    { "eg;", "\342\252\232", 3, 3 },
+    { "gtquest;", "\342\251\274", 8, 3 },
+    { "int;", "\342\210\253", 4, 3 },
+    { NULL, NULL, 0, 0 },
+    { "mDDot;", "\342\210\272", 6, 3 },
+    { "precnsim;", "\342\213\250", 9, 3 },
+    { "boxdl;", "\342\224\220", 6, 3 },
+    { "DownTeeArrow;", "\342\206\247", 13, 3 },
+    { "xdtri;", "\342\226\275", 6, 3 },
+    { "aring", "\303\245", 5, 2 },
+    { "Lsh;", "\342\206\260", 4, 3 },
+    { NULL, NULL, 0, 0 },
+    { "uscr;", "\360\235\223\212", 5, 4 },
+    { "odash;", "\342\212\235", 6, 3 },
+    { NULL, NULL, 0, 0 },
+    { "iecy;", "\320\265", 5, 2 },
+    { "gsim;", "\342\211\263", 5, 3 },
+    { "rcedil;", "\305\227", 7, 2 },
+    { "olt;", "\342\247\200", 4, 3 },
+    { "geqslant;", "\342\251\276", 9, 3 },
+    { "looparrowright;", "\342\206\254", 15, 3 },
+    { "quest;", "?", 6, 1 },
+    { "sqcup;", "\342\212\224", 6, 3 },
+    { "Tfr;", "\360\235\224\227", 4, 4 },
+    { "supmult;", "\342\253\202", 8, 3 },
+    { "empty;", "\342\210\205", 6, 3 },
+    { "longleftarrow;", "\342\237\265", 14, 3 },
+    { "sfr;", "\360\235\224\260", 4, 4 },
+    { "atilde", "\303\243", 6, 2 },
+    { "LowerRightArrow;", "\342\206\230", 16, 3 },
+    { "luruhar;", "\342\245\246", 8, 3 },
+    { "Kcy;", "\320\232", 4, 2 },
+    { "rbbrk;", "\342\235\263", 6, 3 },
+    { "order;", "\342\204\264", 6, 3 },
+    { "ngtr;", "\342\211\257", 5, 3 },
+    { "Ucirc", "\303\233", 5, 2 },
+    { NULL, NULL, 0, 0 },
+    { "barwed;", "\342\214\205", 7, 3 },
+    { "ThinSpace;", "\342\200\211", 10, 3 },
+    { "coprod;", "\342\210\220", 7, 3 },
+    { "qscr;", "\360\235\223\206", 5, 4 },
+    { "prnsim;", "\342\213\250", 7, 3 },
+    { "dblac;", "\313\235", 6, 2 },
+    { "hellip;", "\342\200\246", 7, 3 },
+    { "simlE;", "\342\252\237", 6, 3 },
+    { "ucirc;", "\303\273", 6, 2 },
+    { "Sqrt;", "\342\210\232", 5, 3 },
+    { NULL, NULL, 0, 0 },
+    { "nvgt;", ">\342\203\222", 5, 4 },
+    { "thksim;", "\342\210\274", 7, 3 },
+    { "Element;", "\342\210\210", 8, 3 },
+    { "bullet;", "\342\200\242", 7, 3 },
+    { "bemptyv;", "\342\246\260", 8, 3 },
+    { "sup1;", "\302\271", 5, 2 },
+    { "thkap;", "\342\211\210", 6, 3 },
+    { "oline;", "\342\200\276", 6, 3 },
+    { "quot;", "\"", 5, 1 },
+    { "lbrack;", "[", 7, 1 },
+    { "otimesas;", "\342\250\266", 9, 3 },
+    { "napE;", "\342\251\260\314\270", 5, 5 },
+    { "acirc;", "\303\242", 6, 2 },
+    { "nshortmid;", "\342\210\244", 10, 3 },
+    { "isinE;", "\342\213\271", 6, 3 },
+    { "els;", "\342\252\225", 4, 3 },
+    { "emsp13;", "\342\200\204", 7, 3 },
+    { "boxbox;", "\342\247\211", 7, 3 },
+    { "pm;", "\302\261", 3, 2 },
+    { "EmptyVerySmallSquare;", "\342\226\253", 21, 3 },
+    { "sdote;", "\342\251\246", 6, 3 },
+    { "vBarv;", "\342\253\251", 6, 3 },
+    { "triangleq;", "\342\211\234", 10, 3 },
+    { "downarrow;", "\342\206\223", 10, 3 },
+    { "nscr;", "\360\235\223\203", 5, 4 },
+    { "rarrap;", "\342\245\265", 7, 3 },
+    { "succ;", "\342\211\273", 5, 3 },
+    { "Bopf;", "\360\235\224\271", 5, 4 },
+    { "isins;", "\342\213\264", 6, 3 },
+    { "cfr;", "\360\235\224\240", 4, 4 },
+    { "mopf;", "\360\235\225\236", 5, 4 },
+    { "ClockwiseContourIntegral;", "\342\210\262", 25, 3 },
+    { "NotLeftTriangle;", "\342\213\252", 16, 3 },
+    { "xharr;", "\342\237\267", 6, 3 },
+    { "prE;", "\342\252\263", 4, 3 },
+    { "demptyv;", "\342\246\261", 8, 3 },
+    { "NotNestedGreaterGreater;", "\342\252\242\314\270", 24, 5 },
+    { "jfr;", "\360\235\224\247", 4, 4 },
+    { "Lambda;", "\316\233", 7, 2 },
+    { "InvisibleTimes;", "\342\201\242", 15, 3 },
+    { "quaternions;", "\342\204\215", 12, 3 },
+    { "beth;", "\342\204\266", 5, 3 },
+    { "nrightarrow;", "\342\206\233", 12, 3 },
+    { "biguplus;", "\342\250\204", 9, 3 },
+    { "egsdot;", "\342\252\230", 7, 3 },
+    { "zcy;", "\320\267", 4, 2 },
+    { "ltcir;", "\342\251\271", 6, 3 },
+    { "ratio;", "\342\210\266", 6, 3 },
+    { "Colone;", "\342\251\264", 7, 3 },
+    { NULL, NULL, 0, 0 },
+    { "lsim;", "\342\211\262", 5, 3 },
+    { "aacute", "\303\241", 6, 2 },
+    { "succnsim;", "\342\213\251", 9, 3 },
+    { NULL, NULL, 0, 0 },
+    { "Sc;", "\342\252\274", 3, 3 },
+    { "Sscr;", "\360\235\222\256", 5, 4 },
+    { "ntrianglerighteq;", "\342\213\255", 17, 3 },
+    { "bsemi;", "\342\201\217", 6, 3 },
+    { "bigcup;", "\342\213\203", 7, 3 },
+    { "Egrave;", "\303\210", 7, 2 },
+    { "uharl;", "\342\206\277", 6, 3 },
+    { NULL, NULL, 0, 0 },
+    { "hamilt;", "\342\204\213", 7, 3 },
+    { "otilde;", "\303\265", 7, 2 },
+    { "rarrb;", "\342\207\245", 6, 3 },
+    { NULL, NULL, 0, 0 },
+    { "nearrow;", "\342\206\227", 8, 3 },
+    { "supsup;", "\342\253\226", 7, 3 },
+    { "Dcaron;", "\304\216", 7, 2 },
+    { "andslope;", "\342\251\230", 9, 3 },
+    { "iexcl;", "\302\241", 6, 2 },
+    { "Kappa;", "\316\232", 6, 2 },
+    { "simplus;", "\342\250\244", 8, 3 },
+    { "there4;", "\342\210\264", 7, 3 },
+    { "supedot;", "\342\253\204", 8, 3 },
+    { "aring;", "\303\245", 6, 2 },
+    { "rightthreetimes;", "\342\213\214", 16, 3 },
+    { "rarrbfs;", "\342\244\240", 8, 3 },
+    { "esdot;", "\342\211\220", 6, 3 },
+    { "sup2;", "\302\262", 5, 2 },
+    { NULL, NULL, 0, 0 },
+    { "permil;", "\342\200\260", 7, 3 },
+    { "IEcy;", "\320\225", 5, 2 },
+    { "rarrpl;", "\342\245\205", 7, 3 },
+    { "Lscr;", "\342\204\222", 5, 3 },
+    { "circledast;", "\342\212\233", 11, 3 },
+    { "orarr;", "\342\206\273", 6, 3 },
+    { "nless;", "\342\211\256", 6, 3 },
+    { "subedot;", "\342\253\203", 8, 3 },
+    { "mfr;", "\360\235\224\252", 4, 4 },
+    { "Otilde;", "\303\225", 7, 2 },
+    { "prnap;", "\342\252\271", 6, 3 },
+    { "plusmn;", "\302\261", 7, 2 },
+    { "sime;", "\342\211\203", 5, 3 },
+    { "Leftrightarrow;", "\342\207\224", 15, 3 },
+    { "varkappa;", "\317\260", 9, 2 },
+    { "Hstrok;", "\304\246", 7, 2 },
+    { "gtrapprox;", "\342\252\206", 10, 3 },
+    { "lfr;", "\360\235\224\251", 4, 4 },
+    { "erarr;", "\342\245\261", 6, 3 },
+    { "ShortRightArrow;", "\342\206\222", 16, 3 },
+    { "bne;", "=\342\203\245", 4, 4 },
+    { "isinsv;", "\342\213\263", 7, 3 },
+    { "angmsdag;", "\342\246\256", 9, 3 },
+    { "NJcy;", "\320\212", 5, 2 },
+    { "cirmid;", "\342\253\257", 7, 3 },
+    { "centerdot;", "\302\267", 10, 2 },
+    { "zwnj;", "\342\200\214", 5, 3 },
+    { "iquest;", "\302\277", 7, 2 },
+    { "spadesuit;", "\342\231\240", 10, 3 },
+    { "coloneq;", "\342\211\224", 8, 3 },
+    { "zacute;", "\305\272", 7, 2 },
+    { "hfr;", "\360\235\224\245", 4, 4 },
+    { "Scedil;", "\305\236", 7, 2 },
+    { "rarrc;", "\342\244\263", 6, 3 },
+    { "cuvee;", "\342\213\216", 6, 3 },
+    { "cuesc;", "\342\213\237", 6, 3 },
+    { "vrtri;", "\342\212\263", 6, 3 },
+    { NULL, NULL, 0, 0 },
+    { "dotplus;", "\342\210\224", 8, 3 },
+    { "Or;", "\342\251\224", 3, 3 },
+    { "cup;", "\342\210\252", 4, 3 },
+    { "RightDownVector;", "\342\207\202", 16, 3 },
+    { "OElig;", "\305\222", 6, 2 },
+    { "And;", "\342\251\223", 4, 3 },
+    { "mumap;", "\342\212\270", 6, 3 },
+    { "Scirc;", "\305\234", 6, 2 },
+    { "Oslash", "\303\230", 6, 2 },
+    { "NotSucceeds;", "\342\212\201", 12, 3 },
+    { "circledR;", "\302\256", 9, 2 },
+    { "simg;", "\342\252\236", 5, 3 },
+    { NULL, NULL, 0, 0 },
+    { "Tscr;", "\360\235\222\257", 5, 4 },
+    { "cirE;", "\342\247\203", 5, 3 },
+    { "angzarr;", "\342\215\274", 8, 3 },
+    { NULL, NULL, 0, 0 },
+    { "Gcedil;", "\304\242", 7, 2 },
+    { "conint;", "\342\210\256", 7, 3 },
+    { "topf;", "\360\235\225\245", 5, 4 },
+    { "lnap;", "\342\252\211", 5, 3 },
+    { "yacute", "\303\275", 6, 2 },
+    { "nltrie;", "\342\213\254", 7, 3 },
+    { NULL, NULL, 0, 0 },
+    { "sqsup;", "\342\212\220", 6, 3 },
+    { "angmsdab;", "\342\246\251", 9, 3 },
+    { "curarrm;", "\342\244\274", 8, 3 },
+    { "nisd;", "\342\213\272", 5, 3 },
+    { "natural;", "\342\231\256", 8, 3 },
+    { "apE;", "\342\251\260", 4, 3 },
+    { "sim;", "\342\210\274", 4, 3 },
+    { "rharul;", "\342\245\254", 7, 3 },
+    { "CapitalDifferentialD;", "\342\205\205", 21, 3 },
+    { "nsupseteq;", "\342\212\211", 10, 3 },
+    { "frac25;", "\342\205\226", 7, 3 },
+    { "supnE;", "\342\253\214", 6, 3 },
+    { "Diamond;", "\342\213\204", 8, 3 },
+    { "blacktriangleleft;", "\342\227\202", 18, 3 },
+    { "mcy;", "\320\274", 4, 2 },
+    { "NotLess;", "\342\211\256", 8, 3 },
+    { "cuwed;", "\342\213\217", 6, 3 },
+    { "ltdot;", "\342\213\226", 6, 3 },
+    { "omacr;", "\305\215", 6, 2 },
+    { "ocy;", "\320\276", 4, 2 },
+    { NULL, NULL, 0, 0 },
+    { "wcirc;", "\305\265", 6, 2 },
+    { "wedbar;", "\342\251\237", 7, 3 },
+    { "phmmat;", "\342\204\263", 7, 3 },
+    { "vzigzag;", "\342\246\232", 8, 3 },
+    { "icirc", "\303\256", 5, 2 },
+    { "el;", "\342\252\231", 3, 3 },
+    { "DoubleLeftRightArrow;", "\342\207\224", 21, 3 },
+    { "boxVH;", "\342\225\254", 6, 3 },
+    { NULL, NULL, 0, 0 },
+    { "sigma;", "\317\203", 6, 2 },
+    { "roplus;", "\342\250\256", 7, 3 },
+    { "xcup;", "\342\213\203", 5, 3 },
+    { "nearhk;", "\342\244\244", 7, 3 },
+    { "harr;", "\342\206\224", 5, 3 },
+    { "lharu;", "\342\206\274", 6, 3 },
+    { "dcy;", "\320\264", 4, 2 },
+    { NULL, NULL, 0, 0 },
+    { NULL, NULL, 0, 0 },
+    { "varsigma;", "\317\202", 9, 2 },
+    { "zwj;", "\342\200\215", 4, 3 },
+    { "boxHu;", "\342\225\247", 6, 3 },
+    { "Oscr;", "\360\235\222\252", 5, 4 },
+    { "NotGreaterLess;", "\342\211\271", 15, 3 },
+    { "vsubne;", "\342\212\212\357\270\200", 7, 6 },
+    { NULL, NULL, 0, 0 },
+    { "succeq;", "\342\252\260", 7, 3 },
+    { "cupcup;", "\342\251\212", 7, 3 },
+    { "nvrArr;", "\342\244\203", 7, 3 },
+    { "zdot;", "\305\274", 5, 2 },
+    { "subseteqq;", "\342\253\205", 10, 3 },
+    { "gvertneqq;", "\342\211\251\357\270\200", 10, 6 },
+    { "notniva;", "\342\210\214", 8, 3 },
+    { "frac18;", "\342\205\233", 7, 3 },
+    { "gEl;", "\342\252\214", 4, 3 },
+    { "lfisht;", "\342\245\274", 7, 3 },
+    { "wedge;", "\342\210\247", 6, 3 },
+    { "Cconint;", "\342\210\260", 8, 3 },
+    { "ocirc;", "\303\264", 6, 2 },
+    { "prop;", "\342\210\235", 5, 3 },
+    { NULL, NULL, 0, 0 },
+    { "rrarr;", "\342\207\211", 6, 3 },
+    { "uhblk;", "\342\226\200", 6, 3 },
+    { "Equilibrium;", "\342\207\214", 12, 3 },
+    { "vert;", "|", 5, 1 },
+    { "brvbar;", "\302\246", 7, 2 },
+    { "gtrdot;", "\342\213\227", 7, 3 },
+    { "apid;", "\342\211\213", 5, 3 },
+    { "cscr;", "\360\235\222\270", 5, 4 },
+    { NULL, NULL, 0, 0 },
+    { "hslash;", "\342\204\217", 7, 3 },
+    { "preceq;", "\342\252\257", 7, 3 },
+    { "rsquo;", "\342\200\231", 6, 3 },
+    { "nvlt;", "<\342\203\222", 5, 4 },
+    { "angrtvb;", "\342\212\276", 8, 3 },
+    { "GreaterEqual;", "\342\211\245", 13, 3 },
+    { "uwangle;", "\342\246\247", 8, 3 },
+    { "rbrace;", "}", 7, 1 },
+    { "Vcy;", "\320\222", 4, 2 },
+    { "Upsi;", "\317\222", 5, 2 },
+    { "Nopf;", "\342\204\225", 5, 3 },
+    { "Ccirc;", "\304\210", 6, 2 },
+    { "rsh;", "\342\206\261", 4, 3 },
+    { "RBarr;", "\342\244\220", 6, 3 },
+    { "boxHU;", "\342\225\251", 6, 3 },
+    { "boxvL;", "\342\225\241", 6, 3 },
+    { "bnot;", "\342\214\220", 5, 3 },
+    { "laemptyv;", "\342\246\264", 9, 3 },
+    { "bowtie;", "\342\213\210", 7, 3 },
+    { "kopf;", "\360\235\225\234", 5, 4 },
+    { "Omicron;", "\316\237", 8, 2 },
+    { "rbrkslu;", "\342\246\220", 8, 3 },
+    { NULL, NULL, 0, 0 },
+    { "para", "\302\266", 4, 2 },
+    { "curlyeqsucc;", "\342\213\237", 12, 3 },
+    { "simdot;", "\342\251\252", 7, 3 },
+    { "triangleleft;", "\342\227\203", 13, 3 },
+    { "otimes;", "\342\212\227", 7, 3 },
+    { "ograve", "\303\262", 6, 2 },
+    { "divonx;", "\342\213\207", 7, 3 },
+    { NULL, NULL, 0, 0 },
+    { NULL, NULL, 0, 0 },
+    { "NotRightTriangle;", "\342\213\253", 17, 3 },
+    { "Sfr;", "\360\235\224\226", 4, 4 },
+    { "copy;", "\302\251", 5, 2 },
+    { NULL, NULL, 0, 0 },
+    { "topbot;", "\342\214\266", 7, 3 },
+    { "Gg;", "\342\213\231", 3, 3 },
+    { "bsolhsub;", "\342\237\210", 9, 3 },
+    { "eogon;", "\304\231", 6, 2 },
+    { "digamma;", "\317\235", 8, 2 },
+    { "Cfr;", "\342\204\255", 4, 3 },
+    { NULL, NULL, 0, 0 },
+    { "ltrie;", "\342\212\264", 6, 3 },
+    { "Int;", "\342\210\254", 4, 3 },
+    { "Therefore;", "\342\210\264", 10, 3 },
+    { "ThickSpace;", "\342\201\237\342\200\212", 11, 6 },
+    { "eth", "\303\260", 3, 2 },
+    { "vDash;", "\342\212\250", 6, 3 },
+    { "wopf;", "\360\235\225\250", 5, 4 },
+    { NULL, NULL, 0, 0 },
+    { "wscr;", "\360\235\223\214", 5, 4 },
+    { "nsime;", "\342\211\204", 6, 3 },
+    { NULL, NULL, 0, 0 },
+    { "Omacr;", "\305\214", 6, 2 },
+    { "yopf;", "\360\235\225\252", 5, 4 },
+    { NULL, NULL, 0, 0 },
+    { "bumpe;", "\342\211\217", 6, 3 },
+    { "dfr;", "\360\235\224\241", 4, 4 },
+    { "siml;", "\342\252\235", 5, 3 },
+    { "vangrt;", "\342\246\234", 7, 3 },
+    { "hksearow;", "\342\244\245", 9, 3 },
+    { "ge;", "\342\211\245", 3, 3 },
+    { "auml;", "\303\244", 5, 2 },
+    { "llarr;", "\342\207\207", 6, 3 },
+    { "notin;", "\342\210\211", 6, 3 },
+    { "profalar;", "\342\214\256", 9, 3 },
+    { "Itilde;", "\304\250", 7, 2 },
+    { "dollar;", "$", 7, 1 },
+    { "Hopf;", "\342\204\215", 5, 3 },
+    { "cedil", "\302\270", 5, 2 },
+    { "frac13;", "\342\205\223", 7, 3 },
+    { "rtri;", "\342\226\271", 5, 3 },
+    { "DownBreve;", "\314\221", 10, 2 },
+    { "thetasym;", "\317\221", 9, 2 },
+    { "NotSquareSupersetEqual;", "\342\213\243", 23, 3 },
+    { "intercal;", "\342\212\272", 9, 3 },
+    { "gacute;", "\307\265", 7, 2 },
+    { "ocirc", "\303\264", 5, 2 },
+    { "ecir;", "\342\211\226", 5, 3 },
+    { "lrcorner;", "\342\214\237", 9, 3 },
+    { "lopf;", "\360\235\225\235", 5, 4 },
+    { "supsetneq;", "\342\212\213", 10, 3 },
+    { "Ofr;", "\360\235\224\222", 4, 4 },
+    { NULL, NULL, 0, 0 },
+    { "lArr;", "\342\207\220", 5, 3 },
+    { "Xi;", "\316\236", 3, 2 },
+    { "LeftTee;", "\342\212\243", 8, 3 },
+    { "check;", "\342\234\223", 6, 3 },
+    { "rmoustache;", "\342\216\261", 11, 3 },
+    { "nedot;", "\342\211\220\314\270", 6, 5 },
+    { "cap;", "\342\210\251", 4, 3 },
+    { "lowast;", "\342\210\227", 7, 3 },
+    { "Kopf;", "\360\235\225\202", 5, 4 },
+    { "subrarr;", "\342\245\271", 8, 3 },
+    { "Rightarrow;", "\342\207\222", 11, 3 },
+    { "frac38;", "\342\205\234", 7, 3 },
+    { "prsim;", "\342\211\276", 6, 3 },
+    { "HorizontalLine;", "\342\224\200", 15, 3 },
+    { "ropf;", "\360\235\225\243", 5, 4 },
+    { "boxDL;", "\342\225\227", 6, 3 },
+    { "ocir;", "\342\212\232", 5, 3 },
+    { "ac;", "\342\210\276", 3, 3 },
+    { "Ucy;", "\320\243", 4, 2 },
+    { "Cacute;", "\304\206", 7, 2 },
+    { "leftarrow;", "\342\206\220", 10, 3 },
+    { "weierp;", "\342\204\230", 7, 3 },
+    { "lbrksld;", "\342\246\217", 8, 3 },
+    { "downdownarrows;", "\342\207\212", 15, 3 },
+    { "imof;", "\342\212\267", 5, 3 },
+    { "theta;", "\316\270", 6, 2 },
+    { "parsl;", "\342\253\275", 6, 3 },
+    { "nsup;", "\342\212\205", 5, 3 },
+    { "Uopf;", "\360\235\225\214", 5, 4 },
+    { "target;", "\342\214\226", 7, 3 },
+    { "chi;", "\317\207", 4, 2 },
+    { "Uring;", "\305\256", 6, 2 },
+    { "angst;", "\303\205", 6, 2 },
+    { "DoubleLeftArrow;", "\342\207\220", 16, 3 },
+    { "nsupset;", "\342\212\203\342\203\222", 8, 6 },
+    { "lg;", "\342\211\266", 3, 3 },
+    { "orv;", "\342\251\233", 4, 3 },
+    { "leg;", "\342\213\232", 4, 3 },
+    { "lscr;", "\360\235\223\201", 5, 4 },
+    { "GT;", ">", 3, 1 },
+    { "gap;", "\342\252\206", 4, 3 },
+    { "udblac;", "\305\261", 7, 2 },
+    { "Rang;", "\342\237\253", 5, 3 },
+    { "nsupe;", "\342\212\211", 6, 3 },
+    { "rarrhk;", "\342\206\252", 7, 3 },
+    { "boxvH;", "\342\225\252", 6, 3 },
+    { "KHcy;", "\320\245", 5, 2 },
+    { "macr;", "\302\257", 5, 2 },
+    { "rangle;", "\342\237\251", 7, 3 },
+    { "ecaron;", "\304\233", 7, 2 },
+    { "Vee;", "\342\213\201", 4, 3 },
+    { "backprime;", "\342\200\265", 10, 3 },
+    { "epsilon;", "\316\265", 8, 2 },
+    { "ubreve;", "\305\255", 7, 2 },
+    { "Succeeds;", "\342\211\273", 9, 3 },
+    { "nwarhk;", "\342\244\243", 7, 3 },
+    { NULL, NULL, 0, 0 },
+    { "alpha;", "\316\261", 6, 2 },
+    { "triangle;", "\342\226\265", 9, 3 },
+    { "lbbrk;", "\342\235\262", 6, 3 },
+    { "lsimg;", "\342\252\217", 6, 3 },
+    { "supset;", "\342\212\203", 7, 3 },
+    { "frac34;", "\302\276", 7, 2 },
+    { "subsup;", "\342\253\223", 7, 3 },
+    { "cupdot;", "\342\212\215", 7, 3 },
+    { "xwedge;", "\342\213\200", 7, 3 },
+    { "Iacute;", "\303\215", 7, 2 },
+    { "dd;", "\342\205\206", 3, 3 },
+    { NULL, NULL, 0, 0 },
+    { "nvle;", "\342\211\244\342\203\222", 5, 6 },
+    { "setmn;", "\342\210\226", 6, 3 },
+    { "circledcirc;", "\342\212\232", 12, 3 },
+    { "pluscir;", "\342\250\242", 8, 3 },
+    { "nequiv;", "\342\211\242", 7, 3 },
+    { "Ecaron;", "\304\232", 7, 2 },
+    { "DownTee;", "\342\212\244", 8, 3 },
+    { "ulcorn;", "\342\214\234", 7, 3 },
+    { "fpartint;", "\342\250\215", 9, 3 },
+    { NULL, NULL, 0, 0 },
+    { "Assign;", "\342\211\224", 7, 3 },
+    { "angmsdae;", "\342\246\254", 9, 3 },
+    { NULL, NULL, 0, 0 },
+    { "bkarow;", "\342\244\215", 7, 3 },
+    { "NotPrecedesEqual;", "\342\252\257\314\270", 17, 5 },
+    { "vsubnE;", "\342\253\213\357\270\200", 7, 6 },
+    { "Scy;", "\320\241", 4, 2 },
+    { "Poincareplane;", "\342\204\214", 14, 3 },
+    { "ForAll;", "\342\210\200", 7, 3 },
+    { "gtrarr;", "\342\245\270", 7, 3 },
+    { "Bernoullis;", "\342\204\254", 11, 3 },
+    { NULL, NULL, 0, 0 },
+    { "Sub;", "\342\213\220", 4, 3 },
+    { "mu;", "\316\274", 3, 2 },
+    { "ngeq;", "\342\211\261", 5, 3 },
+    { "efDot;", "\342\211\222", 6, 3 },
+    { "nvsim;", "\342\210\274\342\203\222", 6, 6 },
+    { "half;", "\302\275", 5, 2 },
+    { "lesges;", "\342\252\223", 7, 3 },
+    { NULL, NULL, 0, 0 },
+    { "comp;", "\342\210\201", 5, 3 },
+    { "sum;", "\342\210\221", 4, 3 },
+    { "Subset;", "\342\213\220", 7, 3 },
+    { "ang;", "\342\210\240", 4, 3 },
+    { "utilde;", "\305\251", 7, 2 },
+    { "eqsim;", "\342\211\202", 6, 3 },
+    { "realine;", "\342\204\233", 8, 3 },
+    { "xi;", "\316\276", 3, 2 },
+    { "upharpoonright;", "\342\206\276", 15, 3 },
+    { "Afr;", "\360\235\224\204", 4, 4 },
+    { "angmsd;", "\342\210\241", 7, 3 },
+    { "parallel;", "\342\210\245", 9, 3 },
+    { "rBarr;", "\342\244\217", 6, 3 },
+    { "dstrok;", "\304\221", 7, 2 },
+    { "circledS;", "\342\223\210", 9, 3 },
+    { "curvearrowright;", "\342\206\267", 16, 3 },
+    { NULL, NULL, 0, 0 },
+    { "ETH;", "\303\220", 4, 2 },
+    { "ltrif;", "\342\227\202", 6, 3 },
+    { "cdot;", "\304\213", 5, 2 },
+    { "abreve;", "\304\203", 7, 2 },
+    { "lessdot;", "\342\213\226", 8, 3 },
+    { "gE;", "\342\211\247", 3, 3 },
+    { "Abreve;", "\304\202", 7, 2 },
+    { "sigmaf;", "\317\202", 7, 2 },
+    { "qopf;", "\360\235\225\242", 5, 4 },
+    { "plusmn", "\302\261", 6, 2 },
+    { "boxminus;", "\342\212\237", 9, 3 },
+    { "clubsuit;", "\342\231\243", 9, 3 },
+    { "lozenge;", "\342\227\212", 8, 3 },
+    { "angrtvbd;", "\342\246\235", 9, 3 },
+    { "Eogon;", "\304\230", 6, 2 },
+    { "npreceq;", "\342\252\257\314\270", 8, 5 },
+    { "lotimes;", "\342\250\264", 8, 3 },
+    { "Epsilon;", "\316\225", 8, 2 },
+    { "sccue;", "\342\211\275", 6, 3 },
+    { "equest;", "\342\211\237", 7, 3 },
+    { "boxdR;", "\342\225\222", 6, 3 },
+    { "iquest", "\302\277", 6, 2 },
+    { "TildeTilde;", "\342\211\210", 11, 3 },
+    { "frac56;", "\342\205\232", 7, 3 },
+    { "VerticalTilde;", "\342\211\200", 14, 3 },
+    { "notinvc;", "\342\213\266", 8, 3 },
+    { "NotGreater;", "\342\211\257", 11, 3 },
+    { "Tstrok;", "\305\246", 7, 2 },
+    { "trie;", "\342\211\234", 5, 3 },
+    { "nspar;", "\342\210\246", 6, 3 },
+    { "phi;", "\317\206", 4, 2 },
+    { NULL, NULL, 0, 0 },
+    { "nprec;", "\342\212\200", 6, 3 },
+    { "nsce;", "\342\252\260\314\270", 5, 5 },
+    { "NotLessTilde;", "\342\211\264", 13, 3 },
+    { "rcaron;", "\305\231", 7, 2 },
+    { "isinv;", "\342\210\210", 6, 3 },
+    { "rhard;", "\342\207\201", 6, 3 },
+    { "female;", "\342\231\200", 7, 3 },
+    { "ltquest;", "\342\251\273", 8, 3 },
+    { NULL, NULL, 0, 0 },
+    { "percnt;", "%", 7, 1 },
+    { "Theta;", "\316\230", 6, 2 },
+    { "LeftUpDownVector;", "\342\245\221", 17, 3 },
+    { "Vvdash;", "\342\212\252", 7, 3 },
+    { "Lcedil;", "\304\273", 7, 2 },
+    { "hookrightarrow;", "\342\206\252", 15, 3 },
+    { "cent;", "\302\242", 5, 2 },
+    { "imagline;", "\342\204\220", 9, 3 },
+    { "frac12", "\302\275", 6, 2 },
+    { "excl;", "!", 5, 1 },
+    { NULL, NULL, 0, 0 },
+    { "euro;", "\342\202\254", 5, 3 },
+    { "larrsim;", "\342\245\263", 8, 3 },
+    { "nesim;", "\342\211\202\314\270", 6, 5 },
+    { NULL, NULL, 0, 0 },
+    { "parsim;", "\342\253\263", 7, 3 },
+    { "olarr;", "\342\206\272", 6, 3 },
+    { "gdot;", "\304\241", 5, 2 },
+    { "models;", "\342\212\247", 7, 3 },
+    { "lrhard;", "\342\245\255", 7, 3 },
+    { "gvnE;", "\342\211\251\357\270\200", 5, 6 },
+    { NULL, NULL, 0, 0 },
+    { "sfrown;", "\342\214\242", 7, 3 },
+    { "boxVl;", "\342\225\242", 6, 3 },
+    { "bigcirc;", "\342\227\257", 8, 3 },
+    { "nvinfin;", "\342\247\236", 8, 3 },
+    { "RightUpVectorBar;", "\342\245\224", 17, 3 },
+    { "eDDot;", "\342\251\267", 6, 3 },
+    { "scirc;", "\305\235", 6, 2 },
+    { "sup2", "\302\262", 4, 2 },
+    { "cwconint;", "\342\210\262", 9, 3 },
+    { "prime;", "\342\200\262", 6, 3 },
+    { "ape;", "\342\211\212", 4, 3 },
+    { "lnE;", "\342\211\250", 4, 3 },
+    { NULL, NULL, 0, 0 },
+    { "scedil;", "\305\237", 7, 2 },
+    { "cularr;", "\342\206\266", 7, 3 },
+    { "setminus;", "\342\210\226", 9, 3 },
+    { "wedgeq;", "\342\211\231", 7, 3 },
+    { "rightleftarrows;", "\342\207\204", 16, 3 },
+    { "langle;", "\342\237\250", 7, 3 },
+    { "supdsub;", "\342\253\230", 8, 3 },
+    { "cir;", "\342\227\213", 4, 3 },
+    { "geq;", "\342\211\245", 4, 3 },
+    { "dzigrarr;", "\342\237\277", 9, 3 },
+    { "LowerLeftArrow;", "\342\206\231", 15, 3 },
+    { "SmallCircle;", "\342\210\230", 12, 3 },
+    { "NotVerticalBar;", "\342\210\244", 15, 3 },
+    { "ncaron;", "\305\210", 7, 2 },
+    { "lowbar;", "_", 7, 1 },
+    { NULL, NULL, 0, 0 },
+    { "bigcap;", "\342\213\202", 7, 3 },
+    { "LongLeftArrow;", "\342\237\265", 14, 3 },
+    { "risingdotseq;", "\342\211\223", 13, 3 },
+    { NULL, NULL, 0, 0 },
+    { "CloseCurlyQuote;", "\342\200\231", 16, 3 },
+    { "Wfr;", "\360\235\224\232", 4, 4 },
+    { "ngt;", "\342\211\257", 4, 3 },
+    { "thorn", "\303\276", 5, 2 },
+    { "lcedil;", "\304\274", 7, 2 },
+    { "ddotseq;", "\342\251\267", 8, 3 },
+    { "mnplus;", "\342\210\223", 7, 3 },
+    { NULL, NULL, 0, 0 },
+    { "dArr;", "\342\207\223", 5, 3 },
+    { "EmptySmallSquare;", "\342\227\273", 17, 3 },
+    { "igrave;", "\303\254", 7, 2 },
+    { "gesdoto;", "\342\252\202", 8, 3 },
+    { "frac14;", "\302\274", 7, 2 },
+    { "Rcy;", "\320\240", 4, 2 },
+    { "nharr;", "\342\206\256", 6, 3 },
+    { "equiv;", "\342\211\241", 6, 3 },
+    { "nwarr;", "\342\206\226", 6, 3 },
+    { "DoubleDownArrow;", "\342\207\223", 16, 3 },
+    { "supe;", "\342\212\207", 5, 3 },
+    { "RightVector;", "\342\207\200", 12, 3 },
+    { "rAarr;", "\342\207\233", 6, 3 },
+    { "uarr;", "\342\206\221", 5, 3 },
+    { NULL, NULL, 0, 0 },
+    { "TRADE;", "\342\204\242", 6, 3 },
+    { "backcong;", "\342\211\214", 9, 3 },
+    { "boxhd;", "\342\224\254", 6, 3 },
+    { "ccups;", "\342\251\214", 6, 3 },
+    { "NotLessEqual;", "\342\211\260", 13, 3 },
+    { "lrhar;", "\342\207\213", 6, 3 },
+    { NULL, NULL, 0, 0 },
+    { "yicy;", "\321\227", 5, 2 },
+    { "straightepsilon;", "\317\265", 16, 2 },
+    { "nbump;", "\342\211\216\314\270", 6, 5 },
+    { NULL, NULL, 0, 0 },
+    { "otilde", "\303\265", 6, 2 },
+    { "doublebarwedge;", "\342\214\206", 15, 3 },
+    { "Longleftrightarrow;", "\342\237\272", 19, 3 },
+    { "dbkarow;", "\342\244\217", 8, 3 },
+    { "origof;", "\342\212\266", 7, 3 },
+    { "bigtriangleup;", "\342\226\263", 14, 3 },
+    { "khcy;", "\321\205", 5, 2 },
+    { "complement;", "\342\210\201", 11, 3 },
+    { "acirc", "\303\242", 5, 2 },
+    { "Cdot;", "\304\212", 5, 2 },
+    { "notinvb;", "\342\213\267", 8, 3 },
+    { "escr;", "\342\204\257", 5, 3 },
+    { "Tau;", "\316\244", 4, 2 },
+    { "hcirc;", "\304\245", 6, 2 },
+    { "frown;", "\342\214\242", 6, 3 },
+    { "acE;", "\342\210\276\314\263", 4, 5 },
+    { "umacr;", "\305\253", 6, 2 },
+    { "Qopf;", "\342\204\232", 5, 3 },
+    { "LeftTriangleBar;", "\342\247\217", 16, 3 },
+    { NULL, NULL, 0, 0 },
+    { "bbrktbrk;", "\342\216\266", 9, 3 },
+    { "igrave", "\303\254", 6, 2 },
+    { "gt;", ">", 3, 1 },
+    { "lesseqgtr;", "\342\213\232", 10, 3 },
+    { "NegativeVeryThinSpace;", "\342\200\213", 22, 3 },
+    { "barwedge;", "\342\214\205", 9, 3 },
+    { "lessgtr;", "\342\211\266", 8, 3 },
+    { "vnsup;", "\342\212\203\342\203\222", 6, 6 },
+    { "lbrke;", "\342\246\213", 6, 3 },
+    { "raemptyv;", "\342\246\263", 9, 3 },
+    { "capdot;", "\342\251\200", 7, 3 },
+    { "COPY", "\302\251", 4, 2 },
+    { NULL, NULL, 0, 0 },
+    { NULL, NULL, 0, 0 },
+    { "nsqsupe;", "\342\213\243", 8, 3 },
+    { "LeftRightVector;", "\342\245\216", 16, 3 },
+    { "nis;", "\342\213\274", 4, 3 },
+    { "GreaterSlantEqual;", "\342\251\276", 18, 3 },
+    { "euml;", "\303\253", 5, 2 },
+    { "SHcy;", "\320\250", 5, 2 },
+    { "varrho;", "\317\261", 7, 2 },
+    { "bumpE;", "\342\252\256", 6, 3 },
+    { "yacy;", "\321\217", 5, 2 },
+    { "dlcorn;", "\342\214\236", 7, 3 },
+    { "amp;", "&", 4, 1 },
+    { NULL, NULL, 0, 0 },
+    { "lAarr;", "\342\207\232", 6, 3 },
+    { "nvlArr;", "\342\244\202", 7, 3 },
+    { "sce;", "\342\252\260", 4, 3 },
+    { "divideontimes;", "\342\213\207", 14, 3 },
+    { "Zcy;", "\320\227", 4, 2 },
+    { "NotGreaterTilde;", "\342\211\265", 16, 3 },
+    { "searr;", "\342\206\230", 6, 3 },
+    { "gla;", "\342\252\245", 4, 3 },
+    { "boxhu;", "\342\224\264", 6, 3 },
+    { "DoubleUpArrow;", "\342\207\221", 14, 3 },
+    { "Oopf;", "\360\235\225\206", 5, 4 },
+    { "bscr;", "\360\235\222\267", 5, 4 },
+    { "rharu;", "\342\207\200", 6, 3 },
+    { "prod;", "\342\210\217", 5, 3 },
+    { "Ocy;", "\320\236", 4, 2 },
+    { "plusb;", "\342\212\236", 6, 3 },
+    { "nleqq;", "\342\211\246\314\270", 6, 5 },
+    { "ReverseEquilibrium;", "\342\207\213", 19, 3 },
+    { "tosa;", "\342\244\251", 5, 3 },
+    { "sqcap;", "\342\212\223", 6, 3 },
+    { "urtri;", "\342\227\271", 6, 3 },
+    { NULL, NULL, 0, 0 },
+    { "ee;", "\342\205\207", 3, 3 },
+    { "gnE;", "\342\211\251", 4, 3 },
+    { "xutri;", "\342\226\263", 6, 3 },
+    { "LeftDownVector;", "\342\207\203", 15, 3 },
+    { "oacute", "\303\263", 6, 2 },
+    { "NotTildeFullEqual;", "\342\211\207", 18, 3 },
+    { "succneqq;", "\342\252\266", 9, 3 },
+    { "kcedil;", "\304\267", 7, 2 },
+    { "Sigma;", "\316\243", 6, 2 },
+    { "Gfr;", "\360\235\224\212", 4, 4 },
+    { "succsim;", "\342\211\277", 8, 3 },
+    { NULL, NULL, 0, 0 },
+    { "Tcedil;", "\305\242", 7, 2 },
+    { "precsim;", "\342\211\276", 8, 3 },
+    { "Otimes;", "\342\250\267", 7, 3 },
+    { "Pfr;", "\360\235\224\223", 4, 4 },
+    { "nhArr;", "\342\207\216", 6, 3 },
+    { "boxDR;", "\342\225\224", 6, 3 },
+    { "GT", ">", 2, 1 },
+    { NULL, NULL, 0, 0 },
+    { "epar;", "\342\213\225", 5, 3 },
+    { "hairsp;", "\342\200\212", 7, 3 },
+    { "real;", "\342\204\234", 5, 3 },
+    { "UpTeeArrow;", "\342\206\245", 11, 3 },
+    { "Jcirc;", "\304\264", 6, 2 },
+    { "thickapprox;", "\342\211\210", 12, 3 },
+    { "map;", "\342\206\246", 4, 3 },
+    { "leftleftarrows;", "\342\207\207", 15, 3 },
+    { "ecirc;", "\303\252", 6, 2 },
+    { "napos;", "\305\211", 6, 2 },
+    { NULL, NULL, 0, 0 },
+    { "gne;", "\342\252\210", 4, 3 },
+    { NULL, NULL, 0, 0 },
+    { "Ubrcy;", "\320\216", 6, 2 },
+    { NULL, NULL, 0, 0 },
+    { "precapprox;", "\342\252\267", 11, 3 },
+    { "Icirc;", "\303\216", 6, 2 },
+    { "ifr;", "\360\235\224\246", 4, 4 },
+    { "ltri;", "\342\227\203", 5, 3 },
+    { "Ocirc;", "\303\224", 6, 2 },
+    { "gfr;", "\360\235\224\244", 4, 4 },
+    { "Dopf;", "\360\235\224\273", 5, 4 },
+    { "Exists;", "\342\210\203", 7, 3 },
+    { "ltrPar;", "\342\246\226", 7, 3 },
+    { "TildeFullEqual;", "\342\211\205", 15, 3 },
+    { "LeftTeeVector;", "\342\245\232", 14, 3 },
+    { NULL, NULL, 0, 0 },
+    { NULL, NULL, 0, 0 },
+    { "nsqsube;", "\342\213\242", 8, 3 },
+    { "Iscr;", "\342\204\220", 5, 3 },
+    { "longmapsto;", "\342\237\274", 11, 3 },
+    { "subE;", "\342\253\205", 5, 3 },
+    { NULL, NULL, 0, 0 },
+    { "rang;", "\342\237\251", 5, 3 },
+    { "planck;", "\342\204\217", 7, 3 },
+    { "kjcy;", "\321\234", 5, 2 },
+    { "Hacek;", "\313\207", 6, 2 },
+    { "Iacute", "\303\215", 6, 2 },
+    { "succcurlyeq;", "\342\211\275", 12, 3 },
+    { "nap;", "\342\211\211", 4, 3 },
+    { "Udblac;", "\305\260", 7, 2 },
+    { "RightDownTeeVector;", "\342\245\235", 19, 3 },
+    { "njcy;", "\321\232", 5, 2 },
+    { "nsc;", "\342\212\201", 4, 3 },
+    { "lat;", "\342\252\253", 4, 3 },
+    { "nge;", "\342\211\261", 4, 3 },
+    { "diamond;", "\342\213\204", 8, 3 },
+    { "reg", "\302\256", 3, 2 },
+    { "RightFloor;", "\342\214\213", 11, 3 },
+    { "boxUl;", "\342\225\234", 6, 3 },
+    { "uuarr;", "\342\207\210", 6, 3 },
+    { "nLt;", "\342\211\252\342\203\222", 4, 6 },
+    { "leftrightarrow;", "\342\206\224", 15, 3 },
+    { "Lang;", "\342\237\252", 5, 3 },
+    { "ange;", "\342\246\244", 5, 3 },
+    { "fscr;", "\360\235\222\273", 5, 4 },
+    { "Ll;", "\342\213\230", 3, 3 },
+    { "xlArr;", "\342\237\270", 6, 3 },
+    { "Hcirc;", "\304\244", 6, 2 },
+    { NULL, NULL, 0, 0 },
+    { "CircleMinus;", "\342\212\226", 12, 3 },
+    { "Pcy;", "\320\237", 4, 2 },
+    { "odiv;", "\342\250\270", 5, 3 },
+    { NULL, NULL, 0, 0 },
+    { "Jscr;", "\360\235\222\245", 5, 4 },
+    { "rho;", "\317\201", 4, 2 },
+    { "dagger;", "\342\200\240", 7, 3 },
+    { "marker;", "\342\226\256", 7, 3 },
+    { "dtrif;", "\342\226\276", 6, 3 },
+    { "colone;", "\342\211\224", 7, 3 },
+    { "dot;", "\313\231", 4, 2 },
+    { "varpropto;", "\342\210\235", 10, 3 },
+    { "lesdotor;", "\342\252\203", 9, 3 },
+    { "colon;", ":", 6, 1 },
+    { "eta;", "\316\267", 4, 2 },
+    { "LT", "<", 2, 1 },
+    { NULL, NULL, 0, 0 },
+    { "LeftTriangleEqual;", "\342\212\264", 18, 3 },
+    { "Pi;", "\316\240", 3, 2 },
+    { "hyphen;", "\342\200\220", 7, 3 },
+    { "cross;", "\342\234\227", 6, 3 },
+    { "atilde;", "\303\243", 7, 2 },
+    { "twoheadleftarrow;", "\342\206\236", 17, 3 },
+    { "iiint;", "\342\210\255", 6, 3 },
+    { "frac58;", "\342\205\235", 7, 3 },
+    { "exist;", "\342\210\203", 6, 3 },
+    { "oS;", "\342\223\210", 3, 3 },
+    { "isindot;", "\342\213\265", 8, 3 },
+    { "notinE;", "\342\213\271\314\270", 7, 5 },
+    { "ofcir;", "\342\246\277", 6, 3 },
+    { "nvge;", "\342\211\245\342\203\222", 5, 6 },
+    { "Acirc;", "\303\202", 6, 2 },
+    { "copysr;", "\342\204\227", 7, 3 },
+    { "upuparrows;", "\342\207\210", 11, 3 },
+    { "mlcp;", "\342\253\233", 5, 3 },
+    { "quatint;", "\342\250\226", 8, 3 },
+    { "triminus;", "\342\250\272", 9, 3 },
+    { "CupCap;", "\342\211\215", 7, 3 },
+    { "swarhk;", "\342\244\246", 7, 3 },
+    { "subnE;", "\342\253\213", 6, 3 },
+    { "ugrave;", "\303\271", 7, 2 },
+    { "mapsto;", "\342\206\246", 7, 3 },
+    { "angrt;", "\342\210\237", 6, 3 },
+    { "xfr;", "\360\235\224\265", 4, 4 },
+    { "rdca;", "\342\244\267", 5, 3 },
+    { "block;", "\342\226\210", 6, 3 },
+    { "midast;", "*", 7, 1 },
+    { "OpenCurlyQuote;", "\342\200\230", 15, 3 },
+    { "PrecedesEqual;", "\342\252\257", 14, 3 },
+    { NULL, NULL, 0, 0 },
+    { "SucceedsEqual;", "\342\252\260", 14, 3 },
+    { "nGg;", "\342\213\231\314\270", 4, 5 },
+    { "Union;", "\342\213\203", 6, 3 },
+    { "NotSquareSubsetEqual;", "\342\213\242", 21, 3 },
+    { "ggg;", "\342\213\231", 4, 3 },
+    { "pointint;", "\342\250\225", 9, 3 },
+    { "ominus;", "\342\212\226", 7, 3 },
+    { NULL, NULL, 0, 0 },
+    { "aleph;", "\342\204\265", 6, 3 },
+    { "Precedes;", "\342\211\272", 9, 3 },
+    { "lAtail;", "\342\244\233", 7, 3 },
+    { "Chi;", "\316\247", 4, 2 },
+    { "plusdu;", "\342\250\245", 7, 3 },
+    { NULL, NULL, 0, 0 },
+    { "gbreve;", "\304\237", 7, 2 },
+    { "bot;", "\342\212\245", 4, 3 },
+    { "RightUpDownVector;", "\342\245\217", 18, 3 },
+    { "oacute;", "\303\263", 7, 2 },
+    { "ovbar;", "\342\214\275", 6, 3 },
+    { "rbrack;", "]", 7, 1 },
+    { "ETH", "\303\220", 3, 2 },
+    { "eqslantless;", "\342\252\225", 12, 3 },
+    { "jukcy;", "\321\224", 6, 2 },
+    { "upsi;", "\317\205", 5, 2 },
+    { "subset;", "\342\212\202", 7, 3 },
+    { NULL, NULL, 0, 0 },
+    { "ycirc;", "\305\267", 6, 2 },
+    { "Yfr;", "\360\235\224\234", 4, 4 },
+    { NULL, NULL, 0, 0 },
+    { "qprime;", "\342\201\227", 7, 3 },
+    { NULL, NULL, 0, 0 },
+    { "DownArrowUpArrow;", "\342\207\265", 17, 3 },
+    { "grave;", "`", 6, 1 },
+    { "supsetneqq;", "\342\253\214", 11, 3 },
+    { "amacr;", "\304\201", 6, 2 },
+    { "SupersetEqual;", "\342\212\207", 14, 3 },
+    { "emsp14;", "\342\200\205", 7, 3 },
+    { "csube;", "\342\253\221", 6, 3 },
+    { "dotminus;", "\342\210\270", 9, 3 },
+    { "lsime;", "\342\252\215", 6, 3 },
+    { "ngeqq;", "\342\211\247\314\270", 6, 5 },
+    { "Map;", "\342\244\205", 4, 3 },
+    { "Utilde;", "\305\250", 7, 2 },
+    { "ldca;", "\342\244\266", 5, 3 },
+    { "GreaterTilde;", "\342\211\263", 13, 3 },
+    { "nsupseteqq;", "\342\253\206\314\270", 11, 5 },
+    { "djcy;", "\321\222", 5, 2 },
+    { "uharr;", "\342\206\276", 6, 3 },
+    { "tcy;", "\321\202", 4, 2 },
+    { "NotReverseElement;", "\342\210\214", 18, 3 },
+    { "submult;", "\342\253\201", 8, 3 },
+    { "profsurf;", "\342\214\223", 9, 3 },
+    { "chcy;", "\321\207", 5, 2 },
+    { "odblac;", "\305\221", 7, 2 },
+    { "cire;", "\342\211\227", 5, 3 },
+    { "ycy;", "\321\213", 4, 2 },
+    { "Emacr;", "\304\222", 6, 2 },
+    { "itilde;", "\304\251", 7, 2 },
+    { "frac14", "\302\274", 6, 2 },
+    { "CirclePlus;", "\342\212\225", 11, 3 },
+    { "yucy;", "\321\216", 5, 2 },
+    { "PlusMinus;", "\302\261", 10, 2 },
+    { "LJcy;", "\320\211", 5, 2 },
+    { NULL, NULL, 0, 0 },
+    { "Iuml", "\303\217", 4, 2 },
+    { "wr;", "\342\211\200", 3, 3 },
+    { "wfr;", "\360\235\224\264", 4, 4 },
+    { "RightTriangleBar;", "\342\247\220", 17, 3 },
+    { "zeetrf;", "\342\204\250", 7, 3 },
+    { "SquareIntersection;", "\342\212\223", 19, 3 },
+    { "ExponentialE;", "\342\205\207", 13, 3 },
+    { "Vdashl;", "\342\253\246", 7, 3 },
+    { "Eacute;", "\303\211", 7, 2 },
+    { "Rarrtl;", "\342\244\226", 7, 3 },
+    { "Fcy;", "\320\244", 4, 2 },
+    { "filig;", "\357\254\201", 6, 3 },
+    { "tbrk;", "\342\216\264", 5, 3 },
+    { "ulcrop;", "\342\214\217", 7, 3 },
+    { "apos;", "'", 5, 1 },
+    { "nsmid;", "\342\210\244", 6, 3 },
+    { "Ncaron;", "\305\207", 7, 2 },
+    { "Qscr;", "\360\235\222\254", 5, 4 },
+    { "circlearrowright;", "\342\206\273", 17, 3 },
+    { "srarr;", "\342\206\222", 6, 3 },
+    { "af;", "\342\201\241", 3, 3 },
+    { "intlarhk;", "\342\250\227", 9, 3 },
+    { "rarrw;", "\342\206\235", 6, 3 },
+    { "expectation;", "\342\204\260", 12, 3 },
+    { "Cedilla;", "\302\270", 8, 2 },
+    { "Product;", "\342\210\217", 8, 3 },
+    { NULL, NULL, 0, 0 },
+    { "eacute", "\303\251", 6, 2 },
+    { "UnderBrace;", "\342\217\237", 11, 3 },
+    { "sung;", "\342\231\252", 5, 3 },
+    { "fllig;", "\357\254\202", 6, 3 },
+    { "Tab;", "\011", 4, 1 },
+    { "Yopf;", "\360\235\225\220", 5, 4 },
+    { "Agrave;", "\303\200", 7, 2 },
+    { "backepsilon;", "\317\266", 12, 2 },
+    { "Wcirc;", "\305\264", 6, 2 },
+    { "homtht;", "\342\210\273", 7, 3 },
+    { "esim;", "\342\211\202", 5, 3 },
+    { "timesbar;", "\342\250\261", 9, 3 },
+    { "nlArr;", "\342\207\215", 6, 3 },
+    { "nwnear;", "\342\244\247", 7, 3 },
+    { "para;", "\302\266", 5, 2 },
+    { "barvee;", "\342\212\275", 7, 3 },
+    { "Ycirc;", "\305\266", 6, 2 },
+    { "rpar;", ")", 5, 1 },
+    { "auml", "\303\244", 4, 2 },
+    { "rdquo;", "\342\200\235", 6, 3 },
+    { "Equal;", "\342\251\265", 6, 3 },
+    { "NotEqual;", "\342\211\240", 9, 3 },
+    { "circ;", "\313\206", 5, 2 },
+    { NULL, NULL, 0, 0 },
+    { "ReverseElement;", "\342\210\213", 15, 3 },
+    { "bigwedge;", "\342\213\200", 9, 3 },
+    { "Ncedil;", "\305\205", 7, 2 },
+    { "nexist;", "\342\210\204", 7, 3 },
+    { "longleftrightarrow;", "\342\237\267", 19, 3 },
+    { NULL, NULL, 0, 0 },
+    { "sqsubseteq;", "\342\212\221", 11, 3 },
+    { "THORN;", "\303\236", 6, 2 },
+    { "lessapprox;", "\342\252\205", 11, 3 },
+    { "ccedil;", "\303\247", 7, 2 },
+    { "egrave;", "\303\250", 7, 2 },
+    { "cupbrcap;", "\342\251\210", 9, 3 },
+    { "micro;", "\302\265", 6, 2 },
+    { "larrfs;", "\342\244\235", 7, 3 },
+    { "ohm;", "\316\251", 4, 2 },
+    { "xrarr;", "\342\237\266", 6, 3 },
+    { "Integral;", "\342\210\253", 9, 3 },
+    { "VeryThinSpace;", "\342\200\212", 14, 3 },
+    { "InvisibleComma;", "\342\201\243", 15, 3 },
+    { "Lt;", "\342\211\252", 3, 3 },
+    { "gesdotol;", "\342\252\204", 9, 3 },
+    { "ell;", "\342\204\223", 4, 3 },
+    { "Iuml;", "\303\217", 5, 2 },
+    { "sube;", "\342\212\206", 5, 3 },
+    { "LessLess;", "\342\252\241", 9, 3 },
+    { "gsime;", "\342\252\216", 6, 3 },
+    { "tcedil;", "\305\243", 7, 2 },
+    { NULL, NULL, 0, 0 },
+    { NULL, NULL, 0, 0 },
+    { "Wedge;", "\342\213\200", 6, 3 },
+    { "frac34", "\302\276", 6, 2 },
+    { "RightUpTeeVector;", "\342\245\234", 17, 3 },
+    { "Wscr;", "\360\235\222\262", 5, 4 },
+    { "ratail;", "\342\244\232", 7, 3 },
+    { "Ufr;", "\360\235\224\230", 4, 4 },
+    { "not;", "\302\254", 4, 2 },
+    { "DoubleVerticalBar;", "\342\210\245", 18, 3 },
+    { "harrw;", "\342\206\255", 6, 3 },
+    { "HilbertSpace;", "\342\204\213", 13, 3 },
+    { "Superset;", "\342\212\203", 9, 3 },
+    { "jcirc;", "\304\265", 6, 2 },
+    { "afr;", "\360\235\224\236", 4, 4 },
+    { "bnequiv;", "\342\211\241\342\203\245", 8, 6 },
+    { "angle;", "\342\210\240", 6, 3 },
+    { "rArr;", "\342\207\222", 5, 3 },
+    { "nshortparallel;", "\342\210\246", 15, 3 },
+    { "RightArrow;", "\342\206\222", 11, 3 },
+    { "MediumSpace;", "\342\201\237", 12, 3 },
+    { "sacute;", "\305\233", 7, 2 },
+    { "DiacriticalAcute;", "\302\264", 17, 2 },
+    { "larrlp;", "\342\206\253", 7, 3 },
+    { "iuml", "\303\257", 4, 2 },
+    { "scnap;", "\342\252\272", 6, 3 },
+    { "loang;", "\342\237\254", 6, 3 },
+    { NULL, NULL, 0, 0 },
+    { "frac35;", "\342\205\227", 7, 3 },
+    { "larrbfs;", "\342\244\237", 8, 3 },
+    { "lozf;", "\342\247\253", 5, 3 },
+    { "Lcy;", "\320\233", 4, 2 },
+    { "apacir;", "\342\251\257", 7, 3 },
+    { "angmsdaf;", "\342\246\255", 9, 3 },
+    { "Tcaron;", "\305\244", 7, 2 },
+    { "PartialD;", "\342\210\202", 9, 3 },
+    { "plussim;", "\342\250\246", 8, 3 },
+    { NULL, NULL, 0, 0 },
+    { NULL, NULL, 0, 0 },
+    { "nldr;", "\342\200\245", 5, 3 },
+    { "naturals;", "\342\204\225", 9, 3 },
+    { "mp;", "\342\210\223", 3, 3 },
+    { "squf;", "\342\226\252", 5, 3 },
+    { "prnE;", "\342\252\265", 5, 3 },
+    { "andv;", "\342\251\232", 5, 3 },
+    { "REG;", "\302\256", 4, 2 },
+    { "les;", "\342\251\275", 4, 3 },
+    { "lsqb;", "[", 5, 1 },
+    { "hookleftarrow;", "\342\206\251", 14, 3 },
+    { "boxVR;", "\342\225\240", 6, 3 },
+    { "topcir;", "\342\253\261", 7, 3 },
+    { "eth;", "\303\260", 4, 2 },
+    { "TScy;", "\320\246", 5, 2 },
+    { "sub;", "\342\212\202", 4, 3 },
+    { "geqq;", "\342\211\247", 5, 3 },
+    { "Ccaron;", "\304\214", 7, 2 },
+    { "fcy;", "\321\204", 4, 2 },
+    { "urcorn;", "\342\214\235", 7, 3 },
+    { NULL, NULL, 0, 0 },
+    { "ucirc", "\303\273", 5, 2 },
+    { "bopf;", "\360\235\225\223", 5, 4 },
+    { "vBar;", "\342\253\250", 5, 3 },
+    { "Hat;", "^", 4, 1 },
+    { "angmsdaa;", "\342\246\250", 9, 3 },
+    { "pr;", "\342\211\272", 3, 3 },
+    { NULL, NULL, 0, 0 },
+    { "gnsim;", "\342\213\247", 6, 3 },
+    { "therefore;", "\342\210\264", 10, 3 },
+    { NULL, NULL, 0, 0 },
+    { "num;", "#", 4, 1 },
+    { "nltri;", "\342\213\252", 6, 3 },
+    { "approxeq;", "\342\211\212", 9, 3 },
+    { "brvbar", "\302\246", 6, 2 },
+    { NULL, NULL, 0, 0 },
+    { NULL, NULL, 0, 0 },
+    { "Uarrocir;", "\342\245\211", 9, 3 },
+    { "Kfr;", "\360\235\224\216", 4, 4 },
+    { "kgreen;", "\304\270", 7, 2 },
+    { "tritime;", "\342\250\273", 8, 3 },
+    { "nsubseteq;", "\342\212\210", 10, 3 },
+    { "xnis;", "\342\213\273", 5, 3 },
+    { "imacr;", "\304\253", 6, 2 },
+    { "nvrtrie;", "\342\212\265\342\203\222", 8, 6 },
+    { NULL, NULL, 0, 0 },
+    { "glE;", "\342\252\222", 4, 3 },
+    { "Jcy;", "\320\231", 4, 2 },
+    { "larrtl;", "\342\206\242", 7, 3 },
+    { "forall;", "\342\210\200", 7, 3 },
+    { "hstrok;", "\304\247", 7, 2 },
+    { "FilledSmallSquare;", "\342\227\274", 18, 3 },
+    { "lstrok;", "\305\202", 7, 2 },
+    { "sqsupset;", "\342\212\220", 9, 3 },
+    { "ultri;", "\342\227\270", 6, 3 },
+    { NULL, NULL, 0, 0 },
+    { "rfisht;", "\342\245\275", 7, 3 },
+    { "Ntilde;", "\303\221", 7, 2 },
+    { "equivDD;", "\342\251\270", 8, 3 },
+    { "angsph;", "\342\210\242", 7, 3 },
+    { "RightTriangle;", "\342\212\263", 14, 3 },
+    { "boxUr;", "\342\225\231", 6, 3 },
+    { "leftrightarrows;", "\342\207\206", 16, 3 },
+    { "nesear;", "\342\244\250", 7, 3 },
+    { "clubs;", "\342\231\243", 6, 3 },
+    { "rightharpoonup;", "\342\207\200", 15, 3 },
+    { "Uogon;", "\305\262", 6, 2 },
+    { "ges;", "\342\251\276", 4, 3 },
+    { "prap;", "\342\252\267", 5, 3 },
+    { "boxvh;", "\342\224\274", 6, 3 },
+    { NULL, NULL, 0, 0 },
+    { NULL, NULL, 0, 0 },
+    { "iuml;", "\303\257", 5, 2 },
+    { NULL, NULL, 0, 0 },
+    { "Lopf;", "\360\235\225\203", 5, 4 },
+    { "boxdL;", "\342\225\225", 6, 3 },
+    { NULL, NULL, 0, 0 },
+    { "malt;", "\342\234\240", 5, 3 },
+    { "forkv;", "\342\253\231", 6, 3 },
+    { NULL, NULL, 0, 0 },
+    { "Icirc", "\303\216", 5, 2 },
+    { "Euml;", "\303\213", 5, 2 },
+    { NULL, NULL, 0, 0 },
+    { "rightarrowtail;", "\342\206\243", 15, 3 },
+    { "lcaron;", "\304\276", 7, 2 },
+    { "fjlig;", "fj", 6, 2 },
+    { "minusb;", "\342\212\237", 7, 3 },
+    { "IJlig;", "\304\262", 6, 2 },
+    { "ne;", "\342\211\240", 3, 3 },
+    { "cacute;", "\304\207", 7, 2 },
+    { "VDash;", "\342\212\253", 6, 3 },
+    { NULL, NULL, 0, 0 },
+    { "boxUR;", "\342\225\232", 6, 3 },
+    { NULL, NULL, 0, 0 },
+    { "DScy;", "\320\205", 5, 2 },
+    { "Omega;", "\316\251", 6, 2 },
+    { "pluse;", "\342\251\262", 6, 3 },
+    { "rppolint;", "\342\250\222", 9, 3 },
+    { "uml", "\302\250", 3, 2 },
+    { "nLeftarrow;", "\342\207\215", 11, 3 },
+    { "Ffr;", "\360\235\224\211", 4, 4 },
+    { "robrk;", "\342\237\247", 6, 3 },
+    { "Zopf;", "\342\204\244", 5, 3 },
+    { NULL, NULL, 0, 0 },
+    { "trianglerighteq;", "\342\212\265", 16, 3 },
+    { "GJcy;", "\320\203", 5, 2 },
+    { NULL, NULL, 0, 0 },
+    { "sqsub;", "\342\212\217", 6, 3 },
+    { NULL, NULL, 0, 0 },
+    { "yacute;", "\303\275", 7, 2 },
+    { "rtimes;", "\342\213\212", 7, 3 },
+    { "gesl;", "\342\213\233\357\270\200", 5, 6 },
+    { "Dcy;", "\320\224", 4, 2 },
+    { "DotEqual;", "\342\211\220", 9, 3 },
+    { "divide;", "\303\267", 7, 2 },
+    { "prcue;", "\342\211\274", 6, 3 },
+    { "LessEqualGreater;", "\342\213\232", 17, 3 },
+    { "blacksquare;", "\342\226\252", 12, 3 },
+    { "lambda;", "\316\273", 7, 2 },
+    { "csup;", "\342\253\220", 5, 3 },
+    { "Longrightarrow;", "\342\237\271", 15, 3 },
+    { "sharp;", "\342\231\257", 6, 3 },
+    { "yfr;", "\360\235\224\266", 4, 4 },
+    { "awconint;", "\342\210\263", 9, 3 },
+    { "or;", "\342\210\250", 3, 3 },
+    { NULL, NULL, 0, 0 },
+    { NULL, NULL, 0, 0 },
+    { "iota;", "\316\271", 5, 2 },
+    { "Escr;", "\342\204\260", 5, 3 },
+    { "utrif;", "\342\226\264", 6, 3 },
+    { "boxplus;", "\342\212\236", 8, 3 },
+    { "blk14;", "\342\226\221", 6, 3 },
+    { "pfr;", "\360\235\224\255", 4, 4 },
+    { "Ncy;", "\320\235", 4, 2 },
+    { "ccirc;", "\304\211", 6, 2 },
+    { "image;", "\342\204\221", 6, 3 },
+    { "DownLeftVectorBar;", "\342\245\226", 18, 3 },
+    { "jsercy;", "\321\230", 7, 2 },
+    { "breve;", "\313\230", 6, 2 },
+    { "Proportion;", "\342\210\267", 11, 3 },
+    { NULL, NULL, 0, 0 },
+    { "leftarrowtail;", "\342\206\242", 14, 3 },
+    { "NotEqualTilde;", "\342\211\202\314\270", 14, 5 },
+    { "rscr;", "\360\235\223\207", 5, 4 },
+    { "Not;", "\342\253\254", 4, 3 },
+    { "scap;", "\342\252\270", 5, 3 },
+    { NULL, NULL, 0, 0 },
+    { "times;", "\303\227", 6, 2 },
+    { "MinusPlus;", "\342\210\223", 10, 3 },
+    { "xuplus;", "\342\250\204", 7, 3 },
+    { "supplus;", "\342\253\200", 8, 3 },
+    { "Cup;", "\342\213\223", 4, 3 },
+    { "CHcy;", "\320\247", 5, 2 },
+    { "uHar;", "\342\245\243", 5, 3 },
+    { "dopf;", "\360\235\225\225", 5, 4 },
+    { "Aogon;", "\304\204", 6, 2 },
+    { "curlyvee;", "\342\213\216", 9, 3 },
+    { "iocy;", "\321\221", 5, 2 },
+    { "IOcy;", "\320\201", 5, 2 },
+    { "male;", "\342\231\202", 5, 3 },
+    { "RightArrowBar;", "\342\207\245", 14, 3 },
+    { "pi;", "\317\200", 3, 2 },
+    { "ecolon;", "\342\211\225", 7, 3 },
+    { "boxv;", "\342\224\202", 5, 3 },
+    { "Mu;", "\316\234", 3, 2 },
+    { "RightDownVectorBar;", "\342\245\225", 19, 3 },
+    { "rHar;", "\342\245\244", 5, 3 },
+    { "nsucc;", "\342\212\201", 6, 3 },
+    { NULL, NULL, 0, 0 },
+    { "Downarrow;", "\342\207\223", 10, 3 },
+    { "UpperLeftArrow;", "\342\206\226", 15, 3 },
+    { "ii;", "\342\205\210", 3, 3 },
+    { "LeftCeiling;", "\342\214\210", 12, 3 },
+    { "amalg;", "\342\250\277", 6, 3 },
+    { "jopf;", "\360\235\225\233", 5, 4 },
+    { NULL, NULL, 0, 0 },
+    { "Ocirc", "\303\224", 5, 2 },
+    { "subsub;", "\342\253\225", 7, 3 },
+    { "odot;", "\342\212\231", 5, 3 },
+    { "mdash;", "\342\200\224", 6, 3 },
+    { "boxur;", "\342\224\224", 6, 3 },
+    { "gtrless;", "\342\211\267", 8, 3 },
+    { "Fouriertrf;", "\342\204\261", 11, 3 },
+    { "reals;", "\342\204\235", 6, 3 },
+    { "SquareSubsetEqual;", "\342\212\221", 18, 3 },
+    { NULL, NULL, 0, 0 },
+    { "andand;", "\342\251\225", 7, 3 },
+    { NULL, NULL, 0, 0 },
+    { "bbrk;", "\342\216\265", 5, 3 },
+    { "Zcaron;", "\305\275", 7, 2 },
+    { "boxvR;", "\342\225\236", 6, 3 },
+    { "xscr;", "\360\235\223\215", 5, 4 },
+    { "gescc;", "\342\252\251", 6, 3 },
+    { "Oacute", "\303\223", 6, 2 },
+    { "DownRightTeeVector;", "\342\245\237", 19, 3 },
+    { "Nscr;", "\360\235\222\251", 5, 4 },
+    { "curarr;", "\342\206\267", 7, 3 },
+    { "RightAngleBracket;", "\342\237\251", 18, 3 },
+    { "Qfr;", "\360\235\224\224", 4, 4 },
+    { "subsetneq;", "\342\212\212", 10, 3 },
+    { "ast;", "*", 4, 1 },
+    { "yuml", "\303\277", 4, 2 },
+    { "lates;", "\342\252\255\357\270\200", 6, 6 },
+    { "andd;", "\342\251\234", 5, 3 },
+    { "sstarf;", "\342\213\206", 7, 3 },
+    { "squ;", "\342\226\241", 4, 3 },
+    { "gammad;", "\317\235", 7, 2 },
+    { "loz;", "\342\227\212", 4, 3 },
+    { "vopf;", "\360\235\225\247", 5, 4 },
+    { "simeq;", "\342\211\203", 6, 3 },
+    { "NotSubsetEqual;", "\342\212\210", 15, 3 },
+    { "rsquor;", "\342\200\231", 7, 3 },
+    { "Euml", "\303\213", 4, 2 },
+    { "scE;", "\342\252\264", 4, 3 },
+    { "uparrow;", "\342\206\221", 8, 3 },
+    { "scnE;", "\342\252\266", 5, 3 },
+    { "NotGreaterEqual;", "\342\211\261", 16, 3 },
+    { "because;", "\342\210\265", 8, 3 },
+    { "Otilde", "\303\225", 6, 2 },
+    { "dscr;", "\360\235\222\271", 5, 4 },
+    { "easter;", "\342\251\256", 7, 3 },
+    { "NewLine;", "\012", 8, 1 },
+    { "zcaron;", "\305\276", 7, 2 },
+    { NULL, NULL, 0, 0 },
+    { "gcy;", "\320\263", 4, 2 },
+    { "subsetneqq;", "\342\253\213", 11, 3 },
+    { "LeftDownVectorBar;", "\342\245\231", 18, 3 },
+    { "vArr;", "\342\207\225", 5, 3 },
+    { "emsp;", "\342\200\203", 5, 3 },
+    { "subne;", "\342\212\212", 6, 3 },
+    { "dscy;", "\321\225", 5, 2 },
+    { "zhcy;", "\320\266", 5, 2 },
+    { "OpenCurlyDoubleQuote;", "\342\200\234", 21, 3 },
+    { "puncsp;", "\342\200\210", 7, 3 },
+    { "triplus;", "\342\250\271", 8, 3 },
+    { "Scaron;", "\305\240", 7, 2 },
+    { "NegativeMediumSpace;", "\342\200\213", 20, 3 },
+    { "Idot;", "\304\260", 5, 2 },
+    { "upsih;", "\317\222", 6, 2 },
+    { "oopf;", "\360\235\225\240", 5, 4 },
+    { "orderof;", "\342\204\264", 8, 3 },
+    { "cent", "\302\242", 4, 2 },
+    { "operp;", "\342\246\271", 6, 3 },
+    { "race;", "\342\210\275\314\261", 5, 5 },
+    { "ltimes;", "\342\213\211", 7, 3 },
+    { "rceil;", "\342\214\211", 6, 3 },
+    { "nleftrightarrow;", "\342\206\256", 16, 3 },
+    { NULL, NULL, 0, 0 },
+    { "DoubleLeftTee;", "\342\253\244", 14, 3 },
+    { "rtrif;", "\342\226\270", 6, 3 },
+    { "VerticalBar;", "\342\210\243", 12, 3 },
+    { "Longleftarrow;", "\342\237\270", 14, 3 },
+    { "ncong;", "\342\211\207", 6, 3 },
+    { "pitchfork;", "\342\213\224", 10, 3 },
+    { "utdot;", "\342\213\260", 6, 3 },
+    { "LeftAngleBracket;", "\342\237\250", 17, 3 },
+    { "vltri;", "\342\212\262", 6, 3 },
+    { "tstrok;", "\305\247", 7, 2 },
+    { "emptyset;", "\342\210\205", 9, 3 },
+    { "NotRightTriangleEqual;", "\342\213\255", 22, 3 },
+    { "shcy;", "\321\210", 5, 2 },
+    { NULL, NULL, 0, 0 },
+    { "rcub;", "}", 5, 1 },
+    { "subseteq;", "\342\212\206", 9, 3 },
+    { "UpEquilibrium;", "\342\245\256", 14, 3 },
+    { "nlarr;", "\342\206\232", 6, 3 },
+    { "curren;", "\302\244", 7, 2 },
+    { "middot;", "\302\267", 7, 2 },
+    { "UpDownArrow;", "\342\206\225", 12, 3 },
+    { "succapprox;", "\342\252\270", 11, 3 },
+    { "nGtv;", "\342\211\253\314\270", 5, 5 },
+    { "qint;", "\342\250\214", 5, 3 },
+    { NULL, NULL, 0, 0 },
+    { "DZcy;", "\320\217", 5, 2 },
+    { "fflig;", "\357\254\200", 6, 3 },
+    { "Jukcy;", "\320\204", 6, 2 },
+    { "RightTeeVector;", "\342\245\233", 15, 3 },
+    { "tcaron;", "\305\245", 7, 2 },
+    { "ograve;", "\303\262", 7, 2 },
+    { NULL, NULL, 0, 0 },
+    { "late;", "\342\252\255", 5, 3 },
+    { "inodot;", "\304\261", 7, 2 },
+    { "Dfr;", "\360\235\224\207", 4, 4 },
+    { "lopar;", "\342\246\205", 6, 3 },
+    { "longrightarrow;", "\342\237\266", 15, 3 },
+    { "ssmile;", "\342\214\243", 7, 3 },
+    { "ldsh;", "\342\206\262", 5, 3 },
+    { "NotSquareSubset;", "\342\212\217\314\270", 16, 5 },
+    { "Vbar;", "\342\253\253", 5, 3 },
+    { "Zacute;", "\305\271", 7, 2 },
+    { "shy;", "\302\255", 4, 2 },
+    { "dwangle;", "\342\246\246", 8, 3 },
+    { "uacute;", "\303\272", 7, 2 },
+    { "ccaron;", "\304\215", 7, 2 },
+    { "nfr;", "\360\235\224\253", 4, 4 },
+    { "sqcaps;", "\342\212\223\357\270\200", 7, 6 },
+    { "ntgl;", "\342\211\271", 5, 3 },
+    { NULL, NULL, 0, 0 },
+    { "lcub;", "{", 5, 1 },
+    { "twixt;", "\342\211\254", 6, 3 },
+    { "lcy;", "\320\273", 4, 2 },
+    { "DDotrahd;", "\342\244\221", 9, 3 },
+    { NULL, NULL, 0, 0 },
+    { "HumpEqual;", "\342\211\217", 10, 3 },
+    { "suphsol;", "\342\237\211", 8, 3 },
+    { "beta;", "\316\262", 5, 2 },
+    { "caret;", "\342\201\201", 6, 3 },
+    { "vartriangleright;", "\342\212\263", 17, 3 },
+    { "gtrsim;", "\342\211\263", 7, 3 },
+    { "kfr;", "\360\235\224\250", 4, 4 },
+    { "DiacriticalTilde;", "\313\234", 17, 2 },
+    { "bdquo;", "\342\200\236", 6, 3 },
+    { "urcrop;", "\342\214\216", 7, 3 },
+    { "rbarr;", "\342\244\215", 6, 3 },
+    { "triangledown;", "\342\226\277", 13, 3 },
+    { "ic;", "\342\201\243", 3, 3 },
+    { "toea;", "\342\244\250", 5, 3 },
+    { "YUcy;", "\320\256", 5, 2 },
+    { "Vert;", "\342\200\226", 5, 3 },
+    { NULL, NULL, 0, 0 },
+    { "NotSupersetEqual;", "\342\212\211", 17, 3 },
+    { "npolint;", "\342\250\224", 8, 3 },
+    { "Rho;", "\316\241", 4, 2 },
+    { "urcorner;", "\342\214\235", 9, 3 },
+    { "DownArrow;", "\342\206\223", 10, 3 },
+    { "LessTilde;", "\342\211\262", 10, 3 },
+    { "LeftDoubleBracket;", "\342\237\246", 18, 3 },
+    { "VerticalLine;", "|", 13, 1 },
+    { "supseteq;", "\342\212\207", 9, 3 },
+    { "straightphi;", "\317\225", 12, 2 },
+    { "Pr;", "\342\252\273", 3, 3 },
+    { "smile;", "\342\214\243", 6, 3 },
+    { "boxVh;", "\342\225\253", 6, 3 },
+    { NULL, NULL, 0, 0 },
+    { "lEg;", "\342\252\213", 4, 3 },
+    { "NotDoubleVerticalBar;", "\342\210\246", 21, 3 },
+    { "iacute", "\303\255", 6, 2 },
+    { "boxUL;", "\342\225\235", 6, 3 },
+    { "sqsubset;", "\342\212\217", 9, 3 },
+    { "Rrightarrow;", "\342\207\233", 12, 3 },
+    { "ffilig;", "\357\254\203", 7, 3 },
+    { "dHar;", "\342\245\245", 5, 3 },
+    { NULL, NULL, 0, 0 },
+    { "cudarrr;", "\342\244\265", 8, 3 },
+    { "NotHumpDownHump;", "\342\211\216\314\270", 16, 5 },
+    { "ngE;", "\342\211\247\314\270", 4, 5 },
+    { "eopf;", "\360\235\225\226", 5, 4 },
+    { "rtriltri;", "\342\247\216", 9, 3 },
+    { "dharl;", "\342\207\203", 6, 3 },
+    { "downharpoonright;", "\342\207\202", 17, 3 },
+    { NULL, NULL, 0, 0 },
+    { "times", "\303\227", 5, 2 },
+    { "backsimeq;", "\342\213\215", 10, 3 },
+    { "NoBreak;", "\342\201\240", 8, 3 },
+    { NULL, NULL, 0, 0 },
+    { "DD;", "\342\205\205", 3, 3 },
+    { "roarr;", "\342\207\276", 6, 3 },
+    { "SucceedsTilde;", "\342\211\277", 14, 3 },
+    { "lobrk;", "\342\237\246", 6, 3 },
+    { "boxuR;", "\342\225\230", 6, 3 },
+    { "trpezium;", "\342\217\242", 9, 3 },
+    { "cwint;", "\342\210\261", 6, 3 },
+    { "eqvparsl;", "\342\247\245", 9, 3 },
+    { "Topf;", "\360\235\225\213", 5, 4 },
+    { "NotSuperset;", "\342\212\203\342\203\222", 12, 6 },
+    { NULL, NULL, 0, 0 },
+    { "div;", "\303\267", 4, 2 },
+    { "Efr;", "\360\235\224\210", 4, 4 },
+    { "nsim;", "\342\211\201", 5, 3 },
+    { "Rcedil;", "\305\226", 7, 2 },
+    { "nsubseteqq;", "\342\253\205\314\270", 11, 5 },
+    { "RightTriangleEqual;", "\342\212\265", 19, 3 },
+    { "popf;", "\360\235\225\241", 5, 4 },
+    { "verbar;", "|", 7, 1 },
+    { "NotExists;", "\342\210\204", 10, 3 },
+    { "gtcir;", "\342\251\272", 6, 3 },
+    { "ldquor;", "\342\200\236", 7, 3 },
+    { "Kscr;", "\360\235\222\246", 5, 4 },
+    { "Rcaron;", "\305\230", 7, 2 },
+    { "lgE;", "\342\252\221", 4, 3 },
+    { "subplus;", "\342\252\277", 8, 3 },
+    { "subdot;", "\342\252\275", 7, 3 },
+    { NULL, NULL, 0, 0 },
+    { "Ecirc", "\303\212", 5, 2 },
+    { "tint;", "\342\210\255", 5, 3 },
+    { "nsube;", "\342\212\210", 6, 3 },
+    { "supseteqq;", "\342\253\206", 10, 3 },
+    { "RightUpVector;", "\342\206\276", 14, 3 },
+    { "ltcc;", "\342\252\246", 5, 3 },
+    { "preccurlyeq;", "\342\211\274", 12, 3 },
+    { "ncedil;", "\305\206", 7, 2 },
+    { "LeftArrow;", "\342\206\220", 10, 3 },
+    { "gtcc;", "\342\252\247", 5, 3 },
+    { "RightDoubleBracket;", "\342\237\247", 19, 3 },
+    { "Del;", "\342\210\207", 4, 3 },
+    { "oint;", "\342\210\256", 5, 3 },
+    { "SquareUnion;", "\342\212\224", 12, 3 },
+    { "rpargt;", "\342\246\224", 7, 3 },
+    { "yen;", "\302\245", 4, 2 },
+    { "eng;", "\305\213", 4, 2 },
+    { NULL, NULL, 0, 0 },
+    { "gnap;", "\342\252\212", 5, 3 },
+    { "blacktriangle;", "\342\226\264", 14, 3 },
+    { "ncy;", "\320\275", 4, 2 },
+    { "lt;", "<", 3, 1 },
+    { "emacr;", "\304\223", 6, 2 },
+    { "UpArrow;", "\342\206\221", 8, 3 },
+    { "radic;", "\342\210\232", 6, 3 },
+    { "cuepr;", "\342\213\236", 6, 3 },
+    { "angmsdah;", "\342\246\257", 9, 3 },
+    { "scaron;", "\305\241", 7, 2 },
+    { "Ascr;", "\360\235\222\234", 5, 4 },
+    { "gopf;", "\360\235\225\230", 5, 4 },
+    { "uring;", "\305\257", 6, 2 },
+    { NULL, NULL, 0, 0 },
+    { "NotNestedLessLess;", "\342\252\241\314\270", 18, 5 },
+    { "cirfnint;", "\342\250\220", 9, 3 },
+    { "gcirc;", "\304\235", 6, 2 },
+    { "ReverseUpEquilibrium;", "\342\245\257", 21, 3 },
+    { "omid;", "\342\246\266", 5, 3 },
+    { "capcap;", "\342\251\213", 7, 3 },
+    { "iukcy;", "\321\226", 6, 2 },
+    { "Nfr;", "\360\235\224\221", 4, 4 },
+    { "rnmid;", "\342\253\256", 6, 3 },
+    { "nparsl;", "\342\253\275\342\203\245", 7, 6 },
+    { "intcal;", "\342\212\272", 7, 3 },
+    { "rightsquigarrow;", "\342\206\235", 16, 3 },
+    { "nsubset;", "\342\212\202\342\203\222", 8, 6 },
+    { "timesb;", "\342\212\240", 7, 3 },
+    { "notnivb;", "\342\213\276", 8, 3 },
+    { "sup1", "\302\271", 4, 2 },
+    { "LT;", "<", 3, 1 },
+    { "NotSubset;", "\342\212\202\342\203\222", 10, 6 },
+    { "QUOT;", "\"", 5, 1 },
+    { NULL, NULL, 0, 0 },
+    { "rtrie;", "\342\212\265", 6, 3 },
+    { "asympeq;", "\342\211\215", 8, 3 },
+    { "llcorner;", "\342\214\236", 9, 3 },
+    { "propto;", "\342\210\235", 7, 3 },
+    { "nlt;", "\342\211\256", 4, 3 },
+    { "nvdash;", "\342\212\254", 7, 3 },
+    { "Gamma;", "\316\223", 6, 2 },
+    { "trianglelefteq;", "\342\212\264", 15, 3 },
+    { "drcrop;", "\342\214\214", 7, 3 },
+    { "LeftUpVectorBar;", "\342\245\230", 16, 3 },
+    { "sqsube;", "\342\212\221", 7, 3 },
+    { "TSHcy;", "\320\213", 6, 2 },
+    { "Rfr;", "\342\204\234", 4, 3 },
+    { "nlE;", "\342\211\246\314\270", 4, 5 },
+    { "gtlPar;", "\342\246\225", 7, 3 },
+    { "lltri;", "\342\227\272", 6, 3 },
+    { "Nacute;", "\305\203", 7, 2 },
+    { "range;", "\342\246\245", 6, 3 },
+    { "and;", "\342\210\247", 4, 3 },
+    { "Bcy;", "\320\221", 4, 2 },
+    { "between;", "\342\211\254", 8, 3 },
+    { "nle;", "\342\211\260", 4, 3 },
+    { "varpi;", "\317\226", 6, 2 },
+    { "xotime;", "\342\250\202", 7, 3 },
+    { "succnapprox;", "\342\252\272", 12, 3 },
+    { NULL, NULL, 0, 0 },
+    { "pertenk;", "\342\200\261", 8, 3 },
+    { "Mscr;", "\342\204\263", 5, 3 },
+    { "semi;", ";", 5, 1 },
+    { "suplarr;", "\342\245\273", 8, 3 },
+    { "searhk;", "\342\244\245", 7, 3 },
+    { "ufr;", "\360\235\224\262", 4, 4 },
+    { "Racute;", "\305\224", 7, 2 },
+    { "QUOT", "\"", 4, 1 },
+    { "NotSucceedsSlantEqual;", "\342\213\241", 22, 3 },
+    { "Gdot;", "\304\240", 5, 2 },
+    { "osol;", "\342\212\230", 5, 3 },
+    { NULL, NULL, 0, 0 },
+    { "llhard;", "\342\245\253", 7, 3 },
+    { "ZeroWidthSpace;", "\342\200\213", 15, 3 },
+    { "bsime;", "\342\213\215", 6, 3 },
+    { "GreaterLess;", "\342\211\267", 12, 3 },
+    { "rbrksld;", "\342\246\216", 8, 3 },
+    { "RightVectorBar;", "\342\245\223", 15, 3 },
+    { "DownArrowBar;", "\342\244\223", 13, 3 },
+    { "Phi;", "\316\246", 4, 2 },
+    { "Ubreve;", "\305\254", 7, 2 },
+    { "icy;", "\320\270", 4, 2 },
+    { "curlywedge;", "\342\213\217", 11, 3 },
+    { "aogon;", "\304\205", 6, 2 },
+    { "imath;", "\304\261", 6, 2 },
+    { NULL, NULL, 0, 0 },
+    { "NotGreaterGreater;", "\342\211\253\314\270", 18, 5 },
+    { "ntilde;", "\303\261", 7, 2 },
+    { "bNot;", "\342\253\255", 5, 3 },
+    { "dtdot;", "\342\213\261", 6, 3 },
+    { NULL, NULL, 0, 0 },
+    { "cirscir;", "\342\247\202", 8, 3 },
+    { "LessFullEqual;", "\342\211\246", 14, 3 },
+    { "Sopf;", "\360\235\225\212", 5, 4 },
+    { "LessSlantEqual;", "\342\251\275", 15, 3 },
+    { "Uacute", "\303\232", 6, 2 },
+    { "nLtv;", "\342\211\252\314\270", 5, 5 },
+    { "Darr;", "\342\206\241", 5, 3 },
+    { NULL, NULL, 0, 0 },
+    { "Igrave", "\303\214", 6, 2 },
+    { "planckh;", "\342\204\216", 8, 3 },
+    { "NotTilde;", "\342\211\201", 9, 3 },
+    { "DiacriticalDot;", "\313\231", 15, 2 },
+    { "rangd;", "\342\246\222", 6, 3 },
+    { "Iogon;", "\304\256", 6, 2 },
+    { NULL, NULL, 0, 0 },
+    { "nleqslant;", "\342\251\275\314\270", 10, 5 },
+    { "shy", "\302\255", 3, 2 },
+    { "sbquo;", "\342\200\232", 6, 3 },
+    { NULL, NULL, 0, 0 },
+    { "boxH;", "\342\225\220", 5, 3 },
+    { "Gcirc;", "\304\234", 6, 2 },
+    { "Leftarrow;", "\342\207\220", 10, 3 },
+    { "nexists;", "\342\210\204", 8, 3 },
+    { "ngsim;", "\342\211\265", 6, 3 },
+    { "Cayleys;", "\342\204\255", 8, 3 },
+    { "circleddash;", "\342\212\235", 12, 3 },
+    { "gsiml;", "\342\252\220", 6, 3 },
+    { "Colon;", "\342\210\267", 6, 3 },
+    { "frac78;", "\342\205\236", 7, 3 },
+    { "uuml", "\303\274", 4, 2 },
+    { "rmoust;", "\342\216\261", 7, 3 },
+    { "nsccue;", "\342\213\241", 7, 3 },
+    { "nrtrie;", "\342\213\255", 7, 3 },
+    { "nGt;", "\342\211\253\342\203\222", 4, 6 },
+    { "varr;", "\342\206\225", 5, 3 },
+    { "xsqcup;", "\342\250\206", 7, 3 },
+    { "cudarrl;", "\342\244\270", 8, 3 },
+    { NULL, NULL, 0, 0 },
+    { "vscr;", "\360\235\223\213", 5, 4 },
+    { "nLeftrightarrow;", "\342\207\216", 16, 3 },
+    { "YIcy;", "\320\207", 5, 2 },
+    { "period;", ".", 7, 1 },
+    { "RightTee;", "\342\212\242", 9, 3 },
+    { "larr;", "\342\206\220", 5, 3 },
+    { "ccaps;", "\342\251\215", 6, 3 },
+    { "flat;", "\342\231\255", 5, 3 },
+    { "lnapprox;", "\342\252\211", 9, 3 },
+    { "Jsercy;", "\320\210", 7, 2 },
+    { "sqsupseteq;", "\342\212\222", 11, 3 },
+    { "DownRightVectorBar;", "\342\245\227", 19, 3 },
+    { "fork;", "\342\213\224", 5, 3 },
+    { "Ecirc;", "\303\212", 6, 2 },
+    { "Icy;", "\320\230", 4, 2 },
+    { "eqcirc;", "\342\211\226", 7, 3 },
+    { "boxhU;", "\342\225\250", 6, 3 },
+    { "fallingdotseq;", "\342\211\222", 14, 3 },
+    { "lsh;", "\342\206\260", 4, 3 },
+    { "gjcy;", "\321\223", 5, 2 },
+    { "LongRightArrow;", "\342\237\266", 15, 3 },
+    { "lacute;", "\304\272", 7, 2 },
+    { "icirc;", "\303\256", 6, 2 },
+    { "capbrcup;", "\342\251\211", 9, 3 },
+    { "Ouml", "\303\226", 4, 2 },
+    { "lvertneqq;", "\342\211\250\357\270\200", 10, 6 },
+    { "vartriangleleft;", "\342\212\262", 16, 3 },
+    { NULL, NULL, 0, 0 },
+    { "Aacute;", "\303\201", 7, 2 },
+    { "tilde;", "\313\234", 6, 2 },
+    { "oslash", "\303\270", 6, 2 },
+    { "NotGreaterFullEqual;", "\342\211\247\314\270", 20, 5 },
+    { "fltns;", "\342\226\261", 6, 3 },
+    { "phiv;", "\317\225", 5, 2 },
+    { "sqcups;", "\342\212\224\357\270\200", 7, 6 },
+    { "lfloor;", "\342\214\212", 7, 3 },
+    { "integers;", "\342\204\244", 9, 3 },
+    { "boxvl;", "\342\224\244", 6, 3 },
+    { "slarr;", "\342\206\220", 6, 3 },
+    { "Nu;", "\316\235", 3, 2 },
+    { NULL, NULL, 0, 0 },
+    { "NotTildeTilde;", "\342\211\211", 14, 3 },
+    { "OverBar;", "\342\200\276", 8, 3 },
+    { NULL, NULL, 0, 0 },
+    { "ncap;", "\342\251\203", 5, 3 },
+    { "DifferentialD;", "\342\205\206", 14, 3 },
+    { "primes;", "\342\204\231", 7, 3 },
+    { "rarrtl;", "\342\206\243", 7, 3 },
+    { "plustwo;", "\342\250\247", 8, 3 },
+    { "Lacute;", "\304\271", 7, 2 },
+    { "Zdot;", "\305\273", 5, 2 },
+    { "zeta;", "\316\266", 5, 2 },
+    { "Ntilde", "\303\221", 6, 2 },
+    { "disin;", "\342\213\262", 6, 3 },
+    { "acy;", "\320\260", 4, 2 },
+    { "jmath;", "\310\267", 6, 2 },
+    { "CounterClockwiseContourIntegral;", "\342\210\263", 32, 3 },
+    { "updownarrow;", "\342\206\225", 12, 3 },
+    { NULL, NULL, 0, 0 },
+    { "LeftArrowRightArrow;", "\342\207\206", 20, 3 },
+    { NULL, NULL, 0, 0 },
+    { "Umacr;", "\305\252", 6, 2 },
+    { "uopf;", "\360\235\225\246", 5, 4 },
+    { "hercon;", "\342\212\271", 7, 3 },
+    { "DoubleRightTee;", "\342\212\250", 15, 3 },
+    { "niv;", "\342\210\213", 4, 3 },
+    { "blacktriangleright;", "\342\226\270", 19, 3 },
+    { "precneqq;", "\342\252\265", 9, 3 },
+    { "mstpos;", "\342\210\276", 7, 3 },
+    { "nles;", "\342\251\275\314\270", 5, 5 },
+    { NULL, NULL, 0, 0 },
+    { NULL, NULL, 0, 0 },
+    { "napprox;", "\342\211\211", 8, 3 },
+    { "latail;", "\342\244\231", 7, 3 },
+    { "spar;", "\342\210\245", 5, 3 },
+    { "jscr;", "\360\235\222\277", 5, 4 },
+    { "leftrightharpoons;", "\342\207\213", 18, 3 },
+    { "uuml;", "\303\274", 5, 2 },
+    { "fnof;", "\306\222", 5, 2 },
+    { "LessGreater;", "\342\211\266", 12, 3 },
+    { "uplus;", "\342\212\216", 6, 3 },
+    { "zopf;", "\360\235\225\253", 5, 4 },
+    { "Breve;", "\313\230", 6, 2 },
+    { "twoheadrightarrow;", "\342\206\240", 18, 3 },
+    { "bigsqcup;", "\342\250\206", 9, 3 },
+    { "Auml", "\303\204", 4, 2 },
+    { "nsubE;", "\342\253\205\314\270", 6, 5 },
+    { "utri;", "\342\226\265", 5, 3 },
+    { "leftharpoondown;", "\342\206\275", 16, 3 },
+    { "Ccedil;", "\303\207", 7, 2 },
+    { "acd;", "\342\210\277", 4, 3 },
+    { "rdldhar;", "\342\245\251", 8, 3 },
+    { "top;", "\342\212\244", 4, 3 },
+    { "wreath;", "\342\211\200", 7, 3 },
+    { "bumpeq;", "\342\211\217", 7, 3 },
+    { "Xscr;", "\360\235\222\263", 5, 4 },
+    { "sc;", "\342\211\273", 3, 3 },
+    { NULL, NULL, 0, 0 },
+    { NULL, NULL, 0, 0 },
+    { "LongLeftRightArrow;", "\342\237\267", 19, 3 },
+    { "NotPrecedesSlantEqual;", "\342\213\240", 22, 3 },
+    { "mid;", "\342\210\243", 4, 3 },
+    { "vsupne;", "\342\212\213\357\270\200", 7, 6 },
+    { "opar;", "\342\246\267", 5, 3 },
+    { "Mfr;", "\360\235\224\220", 4, 4 },
+    { "suphsub;", "\342\253\227", 8, 3 },
+    { "iiota;", "\342\204\251", 6, 3 },
+    { "vfr;", "\360\235\224\263", 4, 4 },
+    { "rAtail;", "\342\244\234", 7, 3 },
+    { "veeeq;", "\342\211\232", 6, 3 },
+    { "zfr;", "\360\235\224\267", 4, 4 },
+    { "larrhk;", "\342\206\251", 7, 3 },
+    { "Zeta;", "\316\226", 5, 2 },
+    { "Delta;", "\316\224", 6, 2 },
+    { "bigvee;", "\342\213\201", 7, 3 },
+};
@@ -0,0 +1,379 @@
+// Archivo generado por tools/gen_unicode_tables; no editar.
+#include "unicode_tables.h"
+
+const uint16_t unorm_stage1[256] = {
+    0, 1, 2, 3, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 5, 5, 5, 5,
+};
+
+const uint16_t unorm_stage2[1792] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42,
+    43, 44, 45, 46, 47, 48, 49, 0, 50, 51, 52, 53, 54, 55, 56, 57,
+    58, 59, 60, 61, 62, 63, 0, 64, 65, 66, 67, 68, 69, 70, 71, 72,
+    0, 73, 74, 75, 76, 77, 78, 0, 79, 80, 81, 82, 83, 84, 0, 84,
+    85, 86, 0, 0, 0, 0, 87, 88, 87, 88, 87, 88, 87, 88, 0, 0,
+    89, 90, 91, 92, 0, 0, 91, 92, 91, 92, 0, 0, 0, 0, 93, 94,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 95, 96, 0, 0, 95, 96,
+    97, 0, 0, 0, 0, 0, 0, 0, 0, 98, 99, 98, 99, 98, 99, 0,
+    0, 98, 99, 0, 0, 0, 0, 0, 0, 0, 0, 0, 100, 101, 0, 0,
+    100, 79, 102, 0, 103, 104, 103, 104, 103, 104, 105, 106, 0, 0, 105, 106,
+    105, 106, 107, 108, 107, 108, 0, 0, 0, 0, 109, 110, 0, 0, 109, 110,
+    109, 110, 109, 110, 0, 0, 0, 0, 55, 111, 112, 111, 112, 111, 112, 19,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 105, 106, 107, 108, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 55, 84, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113,
+    113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113,
+    113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113,
+    113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113,
+    113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113,
+    113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113,
+    113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 114, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130,
+    131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    147, 148, 149, 150, 151, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+const UnormRecord unorm_records[152] = {
+    { 0, 0, 0, 0, 0, 0, 0 },
+    { 1, 0, 0, 1, 0, 0, 0 },
+    { 2, 0, 0, 1, 0, 0, 0 },
+    { 3, 0, 0, 1, 0, 0, 0 },
+    { 4, 0, 0, 1, 0, 0, 0 },
+    { 5, 0, 0, 1, 0, 0, 0 },
+    { 6, 0, 0, 1, 0, 0, 0 },
+    { 7, 0, 0, 1, 0, 0, 0 },
+    { 8, 0, 0, 1, 0, 0, 0 },
+    { 9, 0, 0, 1, 0, 0, 0 },
+    { 10, 0, 0, 1, 0, 0, 0 },
+    { 11, 0, 0, 1, 0, 0, 0 },
+    { 12, 0, 0, 1, 0, 0, 0 },
+    { 13, 0, 0, 1, 0, 0, 0 },
+    { 14, 0, 0, 1, 0, 0, 0 },
+    { 15, 0, 0, 1, 0, 0, 0 },
+    { 16, 0, 0, 1, 0, 0, 0 },
+    { 17, 0, 0, 1, 0, 0, 0 },
+    { 18, 0, 0, 1, 0, 0, 0 },
+    { 19, 0, 0, 1, 0, 0, 0 },
+    { 20, 0, 0, 1, 0, 0, 0 },
+    { 21, 0, 0, 1, 0, 0, 0 },
+    { 22, 0, 0, 1, 0, 0, 0 },
+    { 23, 0, 0, 1, 0, 0, 0 },
+    { 24, 0, 0, 1, 0, 0, 0 },
+    { 25, 0, 0, 1, 0, 0, 0 },
+    { 26, 0, 0, 1, 0, 0, 0 },
+    { 27, 28, 29, 1, 1, 2, 0 },
+    { 31, 28, 32, 1, 1, 2, 0 },
+    { 34, 28, 35, 1, 1, 2, 0 },
+    { 37, 28, 38, 1, 1, 2, 0 },
+    { 40, 28, 41, 1, 1, 2, 0 },
+    { 43, 28, 44, 1, 1, 2, 0 },
+    { 46, 0, 0, 1, 0, 0, 0 },
+    { 47, 48, 49, 1, 1, 2, 0 },
+    { 51, 52, 53, 1, 1, 2, 0 },
+    { 55, 52, 56, 1, 1, 2, 0 },
+    { 58, 52, 59, 1, 1, 2, 0 },
+    { 61, 52, 62, 1, 1, 2, 0 },
+    { 64, 65, 66, 1, 1, 2, 0 },
+    { 68, 65, 69, 1, 1, 2, 0 },
+    { 71, 65, 72, 1, 1, 2, 0 },
+    { 74, 65, 75, 1, 1, 2, 0 },
+    { 77, 0, 0, 1, 0, 0, 0 },
+    { 78, 79, 80, 1, 1, 2, 0 },
+    { 82, 83, 84, 1, 1, 2, 0 },
+    { 86, 83, 87, 1, 1, 2, 0 },
+    { 89, 83, 90, 1, 1, 2, 0 },
+    { 92, 83, 93, 1, 1, 2, 0 },
+    { 95, 83, 96, 1, 1, 2, 0 },
+    { 98, 83, 0, 1, 1, 0, 0 },
+    { 99, 100, 101, 1, 1, 2, 0 },
+    { 103, 100, 104, 1, 1, 2, 0 },
+    { 106, 100, 107, 1, 1, 2, 0 },
+    { 109, 100, 110, 1, 1, 2, 0 },
+    { 0, 112, 0, 0, 1, 0, 0 },
+    { 113, 0, 0, 1, 0, 0, 0 },
+    { 114, 0, 0, 2, 0, 0, 0 },
+    { 0, 1, 116, 0, 1, 2, 0 },
+    { 0, 1, 118, 0, 1, 2, 0 },
+    { 0, 1, 120, 0, 1, 2, 0 },
+    { 0, 1, 122, 0, 1, 2, 0 },
+    { 0, 1, 124, 0, 1, 2, 0 },
+    { 0, 1, 126, 0, 1, 2, 0 },
+    { 0, 3, 128, 0, 1, 2, 0 },
+    { 0, 5, 130, 0, 1, 2, 0 },
+    { 0, 5, 132, 0, 1, 2, 0 },
+    { 0, 5, 134, 0, 1, 2, 0 },
+    { 0, 5, 136, 0, 1, 2, 0 },
+    { 0, 9, 138, 0, 1, 2, 0 },
+    { 0, 9, 140, 0, 1, 2, 0 },
+    { 0, 9, 142, 0, 1, 2, 0 },
+    { 0, 9, 144, 0, 1, 2, 0 },
+    { 0, 14, 146, 0, 1, 2, 0 },
+    { 0, 15, 148, 0, 1, 2, 0 },
+    { 0, 15, 150, 0, 1, 2, 0 },
+    { 0, 15, 152, 0, 1, 2, 0 },
+    { 0, 15, 154, 0, 1, 2, 0 },
+    { 0, 15, 156, 0, 1, 2, 0 },
+    { 0, 15, 0, 0, 1, 0, 0 },
+    { 0, 21, 158, 0, 1, 2, 0 },
+    { 0, 21, 160, 0, 1, 2, 0 },
+    { 0, 21, 162, 0, 1, 2, 0 },
+    { 0, 21, 164, 0, 1, 2, 0 },
+    { 0, 25, 0, 0, 1, 0, 0 },
+    { 0, 28, 0, 0, 1, 0, 0 },
+    { 0, 1, 166, 0, 1, 2, 0 },
+    { 0, 48, 0, 0, 1, 0, 0 },
+    { 0, 3, 0, 0, 1, 0, 0 },
+    { 0, 168, 0, 0, 1, 0, 0 },
+    { 0, 4, 0, 0, 1, 0, 0 },
+    { 0, 52, 0, 0, 1, 0, 0 },
+    { 0, 5, 0, 0, 1, 0, 0 },
+    { 0, 169, 0, 0, 1, 0, 0 },
+    { 0, 7, 0, 0, 1, 0, 0 },
+    { 0, 65, 0, 0, 1, 0, 0 },
+    { 0, 9, 0, 0, 1, 0, 0 },
+    { 170, 0, 0, 2, 0, 0, 0 },
+    { 0, 172, 0, 0, 1, 0, 0 },
+    { 0, 12, 0, 0, 1, 0, 0 },
+    { 0, 83, 0, 0, 1, 0, 0 },
+    { 0, 15, 173, 0, 1, 2, 0 },
+    { 175, 0, 0, 1, 0, 0, 0 },
+    { 0, 176, 0, 0, 1, 0, 0 },
+    { 0, 18, 0, 0, 1, 0, 0 },
+    { 0, 177, 0, 0, 1, 0, 0 },
+    { 0, 19, 0, 0, 1, 0, 0 },
+    { 0, 178, 0, 0, 1, 0, 0 },
+    { 0, 20, 0, 0, 1, 0, 0 },
+    { 0, 100, 0, 0, 1, 0, 0 },
+    { 0, 21, 0, 0, 1, 0, 0 },
+    { 0, 179, 0, 0, 1, 0, 0 },
+    { 0, 26, 0, 0, 1, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 1 },
+    { 180, 0, 0, 1, 0, 0, 0 },
+    { 181, 0, 0, 1, 0, 0, 0 },
+    { 182, 0, 0, 1, 0, 0, 0 },
+    { 183, 0, 0, 1, 0, 0, 0 },
+    { 184, 0, 0, 1, 0, 0, 0 },
+    { 185, 0, 0, 1, 0, 0, 0 },
+    { 186, 0, 0, 1, 0, 0, 0 },
+    { 187, 0, 0, 1, 0, 0, 0 },
+    { 188, 0, 0, 1, 0, 0, 0 },
+    { 189, 0, 0, 1, 0, 0, 0 },
+    { 190, 0, 0, 1, 0, 0, 0 },
+    { 191, 0, 0, 1, 0, 0, 0 },
+    { 192, 0, 0, 1, 0, 0, 0 },
+    { 193, 0, 0, 1, 0, 0, 0 },
+    { 194, 0, 0, 1, 0, 0, 0 },
+    { 195, 0, 0, 1, 0, 0, 0 },
+    { 196, 0, 0, 1, 0, 0, 0 },
+    { 197, 0, 0, 1, 0, 0, 0 },
+    { 198, 0, 0, 1, 0, 0, 0 },
+    { 199, 0, 0, 1, 0, 0, 0 },
+    { 200, 0, 0, 1, 0, 0, 0 },
+    { 201, 0, 0, 1, 0, 0, 0 },
+    { 202, 0, 0, 1, 0, 0, 0 },
+    { 203, 0, 0, 1, 0, 0, 0 },
+    { 204, 0, 0, 1, 0, 0, 0 },
+    { 205, 0, 0, 1, 0, 0, 0 },
+    { 206, 0, 0, 1, 0, 0, 0 },
+    { 207, 0, 0, 1, 0, 0, 0 },
+    { 208, 0, 0, 1, 0, 0, 0 },
+    { 209, 0, 0, 1, 0, 0, 0 },
+    { 210, 0, 0, 1, 0, 0, 0 },
+    { 211, 0, 0, 1, 0, 0, 0 },
+    { 212, 0, 0, 1, 0, 0, 0 },
+    { 213, 0, 0, 2, 0, 0, 0 },
+    { 215, 0, 0, 2, 0, 0, 0 },
+    { 217, 0, 0, 2, 0, 0, 0 },
+    { 214, 0, 0, 3, 0, 0, 0 },
+    { 219, 0, 0, 3, 0, 0, 0 },
+};
+
+const uint32_t unorm_pool[222] = {
+    0x0000, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+    0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+    0x0078, 0x0079, 0x007A, 0x00E0, 0x0041, 0x0041, 0x0300, 0x00E1,
+    0x0041, 0x0301, 0x00E2, 0x0041, 0x0302, 0x00E3, 0x0041, 0x0303,
+    0x00E4, 0x0041, 0x0308, 0x00E5, 0x0041, 0x030A, 0x00E6, 0x00E7,
+    0x0043, 0x0043, 0x0327, 0x00E8, 0x0045, 0x0045, 0x0300, 0x00E9,
+    0x0045, 0x0301, 0x00EA, 0x0045, 0x0302, 0x00EB, 0x0045, 0x0308,
+    0x00EC, 0x0049, 0x0049, 0x0300, 0x00ED, 0x0049, 0x0301, 0x00EE,
+    0x0049, 0x0302, 0x00EF, 0x0049, 0x0308, 0x00F0, 0x00F1, 0x004E,
+    0x004E, 0x0303, 0x00F2, 0x004F, 0x004F, 0x0300, 0x00F3, 0x004F,
+    0x0301, 0x00F4, 0x004F, 0x0302, 0x00F5, 0x004F, 0x0303, 0x00F6,
+    0x004F, 0x0308, 0x00F8, 0x00F9, 0x0055, 0x0055, 0x0300, 0x00FA,
+    0x0055, 0x0301, 0x00FB, 0x0055, 0x0302, 0x00FC, 0x0055, 0x0308,
+    0x0059, 0x00FE, 0x0073, 0x0073, 0x0061, 0x0300, 0x0061, 0x0301,
+    0x0061, 0x0302, 0x0061, 0x0303, 0x0061, 0x0308, 0x0061, 0x030A,
+    0x0063, 0x0327, 0x0065, 0x0300, 0x0065, 0x0301, 0x0065, 0x0302,
+    0x0065, 0x0308, 0x0069, 0x0300, 0x0069, 0x0301, 0x0069, 0x0302,
+    0x0069, 0x0308, 0x006E, 0x0303, 0x006F, 0x0300, 0x006F, 0x0301,
+    0x006F, 0x0302, 0x006F, 0x0303, 0x006F, 0x0308, 0x0075, 0x0300,
+    0x0075, 0x0301, 0x0075, 0x0302, 0x0075, 0x0308, 0x0061, 0x0304,
+    0x0044, 0x0047, 0x0069, 0x0307, 0x004C, 0x006F, 0x0304, 0x0153,
+    0x0052, 0x0053, 0x0054, 0x005A, 0x0451, 0x0430, 0x0431, 0x0432,
+    0x0433, 0x0434, 0x0435, 0x0436, 0x0437, 0x0438, 0x0439, 0x043A,
+    0x043B, 0x043C, 0x043D, 0x043E, 0x043F, 0x0440, 0x0441, 0x0442,
+    0x0443, 0x0444, 0x0445, 0x0446, 0x0447, 0x0448, 0x0449, 0x044A,
+    0x044B, 0x044C, 0x044D, 0x044E, 0x044F, 0x0066, 0x0066, 0x0066,
+    0x0069, 0x0066, 0x006C, 0x0066, 0x0066, 0x006C,
+};
+
+const UnormComposition unorm_compositions[52] = {
+    { 0x0041, 0x0300, 0x00C0 },
+    { 0x0041, 0x0301, 0x00C1 },
+    { 0x0041, 0x0302, 0x00C2 },
+    { 0x0041, 0x0303, 0x00C3 },
+    { 0x0041, 0x0308, 0x00C4 },
+    { 0x0041, 0x030A, 0x00C5 },
+    { 0x0043, 0x0327, 0x00C7 },
+    { 0x0045, 0x0300, 0x00C8 },
+    { 0x0045, 0x0301, 0x00C9 },
+    { 0x0045, 0x0302, 0x00CA },
+    { 0x0045, 0x0308, 0x00CB },
+    { 0x0049, 0x0300, 0x00CC },
+    { 0x0049, 0x0301, 0x00CD },
+    { 0x0049, 0x0302, 0x00CE },
+    { 0x0049, 0x0308, 0x00CF },
+    { 0x004E, 0x0303, 0x00D1 },
+    { 0x004F, 0x0300, 0x00D2 },
+    { 0x004F, 0x0301, 0x00D3 },
+    { 0x004F, 0x0302, 0x00D4 },
+    { 0x004F, 0x0303, 0x00D5 },
+    { 0x004F, 0x0308, 0x00D6 },
+    { 0x0055, 0x0300, 0x00D9 },
+    { 0x0055, 0x0301, 0x00DA },
+    { 0x0055, 0x0302, 0x00DB },
+    { 0x0055, 0x0308, 0x00DC },
+    { 0x0061, 0x0300, 0x00E0 },
+    { 0x0061, 0x0301, 0x00E1 },
+    { 0x0061, 0x0302, 0x00E2 },
+    { 0x0061, 0x0303, 0x00E3 },
+    { 0x0061, 0x0304, 0x0101 },
+    { 0x0061, 0x0308, 0x00E4 },
+    { 0x0061, 0x030A, 0x00E5 },
+    { 0x0063, 0x0327, 0x00E7 },
+    { 0x0065, 0x0300, 0x00E8 },
+    { 0x0065, 0x0301, 0x00E9 },
+    { 0x0065, 0x0302, 0x00EA },
+    { 0x0065, 0x0308, 0x00EB },
+    { 0x0069, 0x0300, 0x00EC },
+    { 0x0069, 0x0301, 0x00ED },
+    { 0x0069, 0x0302, 0x00EE },
+    { 0x0069, 0x0308, 0x00EF },
+    { 0x006E, 0x0303, 0x00F1 },
+    { 0x006F, 0x0300, 0x00F2 },
+    { 0x006F, 0x0301, 0x00F3 },
+    { 0x006F, 0x0302, 0x00F4 },
+    { 0x006F, 0x0303, 0x00F5 },
+    { 0x006F, 0x0304, 0x014D },
+    { 0x006F, 0x0308, 0x00F6 },
+    { 0x0075, 0x0300, 0x00F9 },
+    { 0x0075, 0x0301, 0x00FA },
+    { 0x0075, 0x0302, 0x00FB },
+    { 0x0075, 0x0308, 0x00FC },
+};
+
+const size_t unorm_composition_count = 52;
@@ -4,6 +4,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <stdint.h>
 
 //contadores para benchmarking
 static size_t kmp_char_comparisons = 0;
@@ -25,10 +26,54 @@ void computeLPSArray(const char *pat, size_t M, int *lps) {
     }
 }
 
-void searchKMP(const char *pattern, const char *text) {
+KmpPattern* compileKMP(const char *pattern) {
+    if (!pattern || pattern[0] == '\0') return NULL;
+    KmpPattern *p = malloc(sizeof(KmpPattern));
+    if (!p) return NULL;
+    p->M = strlen(pattern);
+    p->pat = malloc(p->M + 1);
+    p->lps = malloc(p->M * sizeof(int));
+    if (!p->pat || !p->lps) {
+        freeKMP(p);
+        return NULL;
+    }
+    memcpy(p->pat, pattern, p->M + 1);
+    computeLPSArray(p->pat, p->M, p->lps);
+    return p;
+}
+
+//lazo sin salida ni contadores de benchmarking; solo lee p
+size_t execKMP(const KmpPattern *p, const char *text, size_t N,
+               SearchMode mode, MatchCallback cb, void *ctx) {
+    if (!p || !text) return 0;
+    const char *pat = p->pat;
+    const int *lps = p->lps;
+    size_t M = p->M;
+    size_t count = 0, j = 0;
+    for (size_t i = 0; i < N; i++) {
+        while (j > 0 && pat[j] != text[i]) j = (size_t)lps[j - 1];
+        if (pat[j] == text[i]) j++;
+        if (j == M) {
+            count++;
+            if (cb && mode != SEARCH_COUNT) cb(i + 1 - M, ctx);
+            if (mode == SEARCH_FIRST) break;
+            j = (size_t)lps[j - 1];
+        }
+    }
+    return count;
+}
+
+void freeKMP(KmpPattern *p) {
+    if (!p) return;
+    free(p->pat);
+    free(p->lps);
+    free(p);
+}
+
+size_t searchKMP(const char *pattern, const char *text, SearchMode mode) {
     if (!pattern || !text) {
         printError("searchKMP: patrón o texto NULL");
-        return;
+        return 0;
     }
 
     //reinicia contadores
@@ -38,21 +83,31 @@ void searchKMP(const char *pattern, const char *text) {
     size_t M = strlen(pattern), N = strlen(text);
     if (M == 0) {
         printError("searchKMP: patrón vacío");
-        return;
+        return 0;
     }
     if (N == 0) {
         printError("searchKMP: texto vacío");
-        return;
+        return 0;
     }
-    if (M > N) return;
+    //con M > N no hay coincidencias, pero se informa el conteo como siempre
 
-    int *lps = malloc(M * sizeof(int));
-    if (!lps) {
+    KmpPattern *kp = compileKMP(pattern);
+    if (!kp) {
         printError("searchKMP: malloc lps falló");
-        return;
+        return 0;
+    }
+    const int *lps = kp->lps;
+
+    if (mode != SEARCH_ALL) {
+        size_t first = 0;
+        size_t count = execKMP(kp, text, N, mode, storeFirstMatch, &first);
+        freeKMP(kp);
+        if (mode == SEARCH_FIRST && count > 0) printMatch(first, "kmp");
+        else printMatchCount(count, "kmp");
+        return count;
     }
-    computeLPSArray(pattern, M, lps);
 
+    size_t matches = 0;
     size_t i = 0, j = 0;
     while (i < N) {
         //comparación de caracteres
@@ -62,6 +117,8 @@ void searchKMP(const char *pattern, const char *text) {
             j++;
         }
         if (j == M) {
+            matches++;
+
             //cada coincidencia como fila de tabla
             char pos[32];
             sprintf(pos, "%zu", i - j);
@@ -81,71 +138,162 @@ void searchKMP(const char *pattern, const char *text) {
             }
         }
     }
+    freeKMP(kp);
     printTableFooter(2);
-    free(lps);
 
     //imprime metricas
     printf("[KMP] Comparaciones: %zu, Accesos LPS: %zu\n",
            kmp_char_comparisons, kmp_lps_accesses);
+    return matches;
+}
+
+//lectura/escritura de transiciones segun el ancho de estado
+static inline size_t dfaGet(const KmpDfaPattern *p, size_t state, size_t cls) {
+    size_t k = state * p->K + cls;
+    return p->wide ? ((const uint16_t*)p->trans)[k] : ((const uint8_t*)p->trans)[k];
 }
 
-void buildDFA(const char *pat, size_t M, int R, int *dfa) {
-    if (!pat || !dfa || M == 0 || R <= 0) return;
-    size_t nStates = M + 1;
-    for (int c = 0; c < R; c++)
-        dfa[c * nStates + 0] = 0;
-    dfa[(unsigned char)pat[0] * nStates + 0] = 1;
-    int X = 0;
-    for (size_t j = 1; j < M; j++) {
-        for (int c = 0; c < R; c++)
-            dfa[c * nStates + j] = dfa[c * nStates + X];
-        dfa[(unsigned char)pat[j] * nStates + j] = (int)(j + 1);
-        X = dfa[(unsigned char)pat[j] * nStates + X];
-    }
-    //ultimo estado
-    for (int c = 0; c < R; c++)
-        dfa[c * nStates + M] = dfa[c * nStates + X];
+static inline void dfaSet(KmpDfaPattern *p, size_t state, size_t cls, size_t next) {
+    size_t k = state * p->K + cls;
+    if (p->wide) ((uint16_t*)p->trans)[k] = (uint16_t)next;
+    else ((uint8_t*)p->trans)[k] = (uint8_t)next;
 }
 
-void searchKMP_DFA(const char *pattern, const char *text) {
+int buildDFA(const char *pat, size_t M, KmpDfaPattern *p) {
+    if (!pat || !p || M == 0 || M > KMP_DFA_MAX_PATTERN) return -1;
+
+    //reduccion del alfabeto: una clase por byte distinto del patron y la
+    //clase 0 para el resto (si queda algun byte fuera del patron)
+    int seen[256] = {0};
+    size_t distinct = 0;
+    for (size_t j = 0; j < M; j++) {
+        unsigned char c = (unsigned char)pat[j];
+        if (!seen[c]) { seen[c] = 1; distinct++; }
+    }
+    size_t first = (distinct < 256) ? 1 : 0;
+    memset(p->classOf, 0, sizeof(p->classOf));
+    size_t next = first;
+    for (int c = 0; c < 256; c++) {
+        if (seen[c]) p->classOf[c] = (uint8_t)next++;
+    }
+
+    p->M = M;
+    p->K = distinct + first;
+    p->wide = (M > UINT8_MAX);
+    size_t cell = p->wide ? sizeof(uint16_t) : sizeof(uint8_t);
+    p->trans = calloc((M + 1) * p->K, cell);
+    if (!p->trans) return -1;
+
+    //filas por estado: trans[estado * K + clase]
+    dfaSet(p, 0, p->classOf[(unsigned char)pat[0]], 1);
+    size_t X = 0;
+    for (size_t j = 1; j <= M; j++) {
+        for (size_t c = 0; c < p->K; c++)
+            dfaSet(p, j, c, dfaGet(p, X, c));
+        if (j == M) break; //ultimo estado: copia de X
+        size_t cls = p->classOf[(unsigned char)pat[j]];
+        dfaSet(p, j, cls, j + 1);
+        X = dfaGet(p, X, cls);
+    }
+    return 0;
+}
+
+KmpDfaPattern* compileKMPDFA(const char *pattern) {
+    if (!pattern) return NULL;
+    KmpDfaPattern *p = calloc(1, sizeof(KmpDfaPattern));
+    if (!p) return NULL;
+    if (buildDFA(pattern, strlen(pattern), p) != 0) {
+        free(p);
+        return NULL;
+    }
+    return p;
+}
+
+//lazo principal, una version por ancho de estado
+#define KMP_DFA_SCAN(type)                                                  \
+    do {                                                                    \
+        const type *trans = (const type*)p->trans;                          \
+        size_t state = 0;                                                   \
+        for (size_t i = 0; i < N; i++) {                                    \
+            state = trans[state * K + classOf[(unsigned char)text[i]]];     \
+            if (mode == SEARCH_COUNT) {                                     \
+                count += (state == M);                                      \
+            } else if (state == M) {                                        \
+                count++;                                                    \
+                if (cb) cb(i + 1 - M, ctx);                                 \
+                if (mode == SEARCH_FIRST) break;                            \
+            }                                                               \
+        }                                                                   \
+    } while (0)
+
+size_t execKMPDFA(const KmpDfaPattern *p, const char *text, size_t N,
+                  SearchMode mode, MatchCallback cb, void *ctx) {
+    if (!p || !text) return 0;
+    const uint8_t *classOf = p->classOf;
+    size_t K = p->K, M = p->M, count = 0;
+    if (p->wide) KMP_DFA_SCAN(uint16_t);
+    else KMP_DFA_SCAN(uint8_t);
+    return count;
+}
+
+void freeKMPDFA(KmpDfaPattern *p) {
+    if (!p) return;
+    free(p->trans);
+    free(p);
+}
+
+//callback que imprime cada coincidencia como fila de tabla
+static void printDFARow(size_t s, void *ctx) {
+    (void)ctx;
+    char pos[32];
+    sprintf(pos, "%zu", s);
+    const char *cells[] = { "kmp_dfa", pos };
+    printTableRow(cells, 2);
+}
+
+size_t searchKMP_DFA(const char *pattern, const char *text, SearchMode mode) {
     if (!pattern || !text) {
         printError("searchKMP_DFA: patrón o texto NULL");
-        return;
+        return 0;
     }
     size_t M = strlen(pattern), N = strlen(text);
     if (M == 0) {
         printError("searchKMP_DFA: patrón vacío");
-        return;
+        return 0;
     }
     if (N == 0) {
         printError("searchKMP_DFA: texto vacío");
-        return;
+        return 0;
+    }
+    if (M > KMP_DFA_MAX_PATTERN) {
+        printError("searchKMP_DFA: patrón demasiado largo, se usa kmp");
+        return searchKMP(pattern, text, mode);
     }
-    if (M > N) return;
 
-    int R = 256;
-    size_t nStates = M + 1;
-    int *dfa = malloc(R * nStates * sizeof(int));
-    if (!dfa) {
+    KmpDfaPattern *dp = compileKMPDFA(pattern);
+    if (!dp) {
         printError("searchKMP_DFA: malloc dfa falló");
-        return;
-    }
-    buildDFA(pattern, M, R, dfa);
-
-    int state = 0;
-    while (state != (int)M) {
-        for (size_t i = 0; i < N; i++) {
-            unsigned char c = (unsigned char)text[i];
-            state = dfa[c * nStates + state];
-            if (state == (int)M) {
-                //coincidencia con DFA; imprimimos como fila
-                char pos[32];
-                sprintf(pos, "%zu", i - M + 1);
-                const char *cells[] = { "kmp_dfa", pos };
-                printTableRow(cells, 2);
-            }
-        }
+        return 0;
+    }
+
+    size_t first = 0;
+    size_t matches = execKMPDFA(dp, text, N, mode,
+                                mode == SEARCH_ALL ? printDFARow : storeFirstMatch,
+                                &first);
+    size_t states = dp->M + 1, classes = dp->K;
+    size_t tableBytes = states * classes * (dp->wide ? 2 : 1);
+    freeKMPDFA(dp);
+
+    if (mode != SEARCH_ALL) {
+        if (mode == SEARCH_FIRST && matches > 0) printMatch(first, "kmp_dfa");
+        else printMatchCount(matches, "kmp_dfa");
+        return matches;
     }
 
-    free(dfa);
-}
\ No newline at end of file
+    printTableFooter(2);
+
+    //imprime metricas
+    printf("[KMP DFA] Estados: %zu, Clases: %zu, Tabla: %zu bytes\n",
+           states, classes, tableBytes);
+    return matches;
+}
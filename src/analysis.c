@@ -0,0 +1,119 @@
+// Diego Galindo, Francisco Mercado
+#define _POSIX_C_SOURCE 200809L
+#include "analysis.h"
+#include "stemmer.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Listas ordenadas con strcmp (se buscan con bsearch) y ya normalizadas
+// como los términos del índice: sin tildes y sin palabras de una letra,
+// que el tokenizador ya descarta
+static const char *const SPANISH_STOPWORDS[] = {
+    "al", "algo", "algunas", "algunos", "alli", "ante", "antes", "aqui", "asi", "aunque",
+    "bajo", "cada", "como", "con", "contra", "cual", "cuales", "cuando", "cuya", "cuyo",
+    "de", "del", "desde", "donde", "durante", "el", "ella", "ellas", "ellos", "en",
+    "entre", "era", "eran", "eres", "es", "esa", "esas", "ese", "eso", "esos", "esta",
+    "estaba", "estabais", "estabamos", "estaban", "estabas", "estais", "estamos", "estan",
+    "estar", "estara", "estaran", "estaras", "estare", "estareis", "estaremos", "estas",
+    "este", "esteis", "estemos", "esten", "estes", "esto", "estos", "estoy", "estuve",
+    "estuvieron", "estuvimos", "estuvo", "fue", "fueron", "ha", "habeis", "habia",
+    "habian", "habra", "habria", "hace", "hacer", "han", "has", "hasta", "hay", "haya",
+    "hayamos", "hayan", "hayas", "he", "hemos", "la", "las", "le", "les", "lo", "los",
+    "mas", "me", "mi", "mia", "mias", "mientras", "mio", "mios", "mis", "mucho", "muchos",
+    "muy", "nada", "ni", "no", "nos", "nosotras", "nosotros", "nuestra", "nuestras",
+    "nuestro", "nuestros", "os", "otra", "otras", "otro", "otros", "para", "pero", "poco",
+    "por", "porque", "puede", "pueden", "que", "quien", "quienes", "se", "sea", "sean",
+    "segun", "ser", "si", "sido", "siendo", "sin", "sino", "sobre", "sois", "somos", "son",
+    "soy", "su", "sus", "suya", "suyas", "suyo", "suyos", "tambien", "tanto", "te",
+    "tenemos", "tener", "tengo", "tenia", "ti", "tiene", "tienen", "todo", "todos", "tras",
+    "tu", "tus", "tuvo", "tuya", "tuyas", "tuyo", "tuyos", "un", "una", "uno", "unos",
+    "vosotras", "vosotros", "vuestra", "vuestras", "vuestro", "vuestros", "ya", "yo"
+};
+
+static const char *const ENGLISH_STOPWORDS[] = {
+    "about", "above", "after", "again", "against", "all", "am", "an", "and", "any", "are",
+    "aren", "as", "at", "be", "because", "been", "before", "being", "below", "between",
+    "both", "but", "by", "can", "cannot", "cant", "could", "couldn", "did", "didn", "do",
+    "does", "doesn", "doing", "don", "down", "during", "each", "few", "for", "from",
+    "further", "had", "hadn", "has", "hasn", "have", "haven", "having", "he", "her",
+    "here", "hers", "herself", "him", "himself", "his", "how", "if", "in", "into", "is",
+    "isn", "it", "its", "itself", "just", "let", "me", "more", "most", "mustn", "my",
+    "myself", "no", "nor", "not", "now", "of", "off", "on", "once", "only", "or", "other",
+    "our", "ours", "ourselves", "out", "over", "own", "same", "shan", "she", "should",
+    "shouldn", "so", "some", "such", "than", "that", "the", "their", "theirs", "them",
+    "themselves", "then", "there", "these", "they", "this", "those", "through", "to",
+    "too", "under", "until", "up", "very", "was", "wasn", "we", "were", "weren", "what",
+    "when", "where", "which", "while", "who", "whom", "why", "will", "with", "won",
+    "would", "wouldn", "you", "your", "yours", "yourself", "yourselves"
+};
+
+#define COUNT_OF(list) (sizeof(list) / sizeof((list)[0]))
+
+uint32_t encodeAnalysis(const AnalysisConfig *config) {
+    return (config->stopwords & 0xFF) | ((config->stemmer & 0xFF) << 8);
+}
+
+void decodeAnalysis(uint32_t raw, AnalysisConfig *config) {
+    config->stopwords = raw & 0xFF;
+    config->stemmer = (raw >> 8) & 0xFF;
+}
+
+int parseAnalysisLanguages(const char *text, uint32_t *mask) {
+    *mask = 0;
+    if (!text) return -1;
+    char *copy = strdup(text);
+    if (!copy) return -1;
+
+    int result = 0;
+    char *saveptr = NULL;
+    for (char *lang = strtok_r(copy, ",", &saveptr); lang; lang = strtok_r(NULL, ",", &saveptr)) {
+        if (strcmp(lang, "es") == 0) *mask |= ANALYSIS_LANG_ES;
+        else if (strcmp(lang, "en") == 0) *mask |= ANALYSIS_LANG_EN;
+        else result = -1;
+    }
+    free(copy);
+    return *mask ? result : -1;
+}
+
+static const char* languageList(uint32_t mask) {
+    switch (mask) {
+        case ANALYSIS_LANG_ES: return "es";
+        case ANALYSIS_LANG_EN: return "en";
+        case ANALYSIS_LANG_ES | ANALYSIS_LANG_EN: return "es,en";
+        default: return "no";
+    }
+}
+
+void describeAnalysis(const AnalysisConfig *config, char *out, size_t size) {
+    snprintf(out, size, "palabras vacías: %s; stemming: %s",
+             languageList(config->stopwords), languageList(config->stemmer));
+}
+
+static int compareWord(const void *key, const void *item) {
+    return strcmp((const char*)key, *(const char *const *)item);
+}
+
+int isStopWord(uint32_t languages, const char *term) {
+    if ((languages & ANALYSIS_LANG_ES) &&
+        bsearch(term, SPANISH_STOPWORDS, COUNT_OF(SPANISH_STOPWORDS),
+                sizeof(char*), compareWord)) {
+        return 1;
+    }
+    if ((languages & ANALYSIS_LANG_EN) &&
+        bsearch(term, ENGLISH_STOPWORDS, COUNT_OF(ENGLISH_STOPWORDS),
+                sizeof(char*), compareWord)) {
+        return 1;
+    }
+    return 0;
+}
+
+int analyzeTerm(const AnalysisConfig *config, char *term) {
+    if (!config) return term[0] != '\0';
+    if (config->stopwords && isStopWord(config->stopwords, term)) return 0;
+
+    size_t len = strlen(term);
+    if (config->stemmer == ANALYSIS_LANG_ES) len = stemSpanish(term, len);
+    else if (config->stemmer == ANALYSIS_LANG_EN) len = stemEnglish(term, len);
+    return len > 0;
+}
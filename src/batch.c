@@ -0,0 +1,423 @@
+// Diego Galindo, Francisco Mercado
+#define _GNU_SOURCE
+#include "batch.h"
+#include "index_operations.h"
+#include "indexer.h"
+#include "persistence.h"
+#include "parallel.h"
+#include "planner.h"
+#include "utils.h"
+#include "KMP.h"
+#include "boyer_moore.h"
+#include "shift_and.h"
+#include "memchr_search.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+// Genera la salida de la consulta i en out
+typedef void (*BatchRender)(size_t i, FILE *out, void *ctx);
+
+typedef struct {
+    BatchRender render;
+    void *ctx;
+    size_t first;        // Primera consulta de la tanda
+    char **outputs;      // Salida de cada consulta de la tanda
+    size_t *lengths;
+} BatchChunk;
+
+// Posiciones de las coincidencias de un patrón
+typedef struct {
+    size_t *offsets;
+    size_t count;
+    size_t capacity;
+    const char *text;
+    const char *cursor;  // Solo bm: byte del code-point cursor_cp
+    size_t cursor_cp;
+} PatternMatches;
+
+typedef struct {
+    char **patterns;
+    size_t count;
+    const char *alg;
+    const char *text;
+    size_t text_len;
+    const uint32_t *cps; // Texto decodificado, solo si algún patrón usa bm
+    size_t cps_len;
+    const PlannerThresholds *thresholds;
+    const NormalizationOptions *norm_opts;
+    SearchMode mode;
+    BatchFormat format;
+} PatternBatch;
+
+typedef struct {
+    char **queries;
+    size_t count;
+    InvertedIndex *index;
+    DocumentCollection *collection;
+    BatchFormat format;
+} IndexBatch;
+
+int parseBatchFormat(const char *name, BatchFormat *format) {
+    if (strcmp(name, "jsonl") == 0) {
+        *format = BATCH_JSONL;
+    } else if (strcmp(name, "tsv") == 0) {
+        *format = BATCH_TSV;
+    } else {
+        return -1;
+    }
+    return 0;
+}
+
+// Lee las líneas no vacías de un archivo (sin el salto de línea)
+static char** readQueryLines(const char *filename, size_t *count) {
+    *count = 0;
+    FILE *file = fopen(filename, "r");
+    if (!file) {
+        perror("Error al abrir el archivo de consultas");
+        return NULL;
+    }
+
+    size_t capacity = 256;
+    char **lines = malloc(capacity * sizeof(char*));
+    char *line = NULL;
+    size_t line_cap = 0;
+    ssize_t len;
+    while (lines && (len = getline(&line, &line_cap, file)) >= 0) {
+        while (len > 0 && (line[len - 1] == '\n' || line[len - 1] == '\r')) line[--len] = '\0';
+        if (len == 0) continue;
+        if (*count == capacity) {
+            char **grown = realloc(lines, capacity * 2 * sizeof(char*));
+            if (!grown) break;
+            lines = grown;
+            capacity *= 2;
+        }
+        lines[*count] = strdup(line);
+        if (lines[*count]) (*count)++;
+    }
+    free(line);
+    fclose(file);
+    return lines;
+}
+
+static void freeQueryLines(char **lines, size_t count) {
+    for (size_t i = 0; i < count; i++) free(lines[i]);
+    free(lines);
+}
+
+// Cadena JSON con las comillas y los caracteres de control escapados
+static void writeJsonString(FILE *out, const char *s) {
+    fputc('"', out);
+    for (const unsigned char *p = (const unsigned char*)s; *p; p++) {
+        if (*p == '"' || *p == '\\') {
+            fputc('\\', out);
+            fputc(*p, out);
+        } else if (*p == '\t') {
+            fputs("\\t", out);
+        } else if (*p < 0x20) {
+            fprintf(out, "\\u%04x", *p);
+        } else {
+            fputc(*p, out);
+        }
+    }
+    fputc('"', out);
+}
+
+// En TSV los tabuladores de una celda se reemplazan por espacios
+static void writeTsvField(FILE *out, const char *s) {
+    for (; *s; s++) fputc(*s == '\t' ? ' ' : *s, out);
+}
+
+// ============================================================================
+// Ejecución por tandas
+// ============================================================================
+
+static void renderChunkItem(size_t i, void *arg) {
+    BatchChunk *chunk = arg;
+    chunk->outputs[i] = NULL;
+    chunk->lengths[i] = 0;
+    FILE *out = open_memstream(&chunk->outputs[i], &chunk->lengths[i]);
+    if (!out) return;
+    chunk->render(chunk->first + i, out, chunk->ctx);
+    fclose(out);
+}
+
+// Evalúa en paralelo de a BATCH_CHUNK consultas y escribe cada tanda en
+// orden, de modo que la salida empieza antes de terminar el lote
+static void runBatch(size_t count, int num_threads, BatchRender render, void *ctx) {
+    char *outputs[BATCH_CHUNK];
+    size_t lengths[BATCH_CHUNK];
+    BatchChunk chunk = { render, ctx, 0, outputs, lengths };
+
+    for (size_t first = 0; first < count; first += BATCH_CHUNK) {
+        size_t n = count - first < BATCH_CHUNK ? count - first : BATCH_CHUNK;
+        chunk.first = first;
+        parallelFor(n, num_threads, renderChunkItem, &chunk);
+        for (size_t i = 0; i < n; i++) {
+            if (outputs[i]) fwrite(outputs[i], 1, lengths[i], stdout);
+            free(outputs[i]);
+        }
+        fflush(stdout);
+    }
+}
+
+// ============================================================================
+// Términos contra el índice
+// ============================================================================
+
+static void renderIndexQuery(size_t i, FILE *out, void *arg) {
+    IndexBatch *batch = arg;
+    const char *query = batch->queries[i];
+
+    char *term = strdup(query);
+    if (!term) return;
+    convertir_a_minusculas(term);
+    limpiar_palabra(term);
+    PostingNode *results = searchTerm(batch->index, term);
+
+    if (batch->format == BATCH_JSONL) {
+        fputs("{\"query\":", out);
+        writeJsonString(out, query);
+        fputs(",\"term\":", out);
+        writeJsonString(out, term);
+        fputs(",\"hits\":[", out);
+    }
+    for (PostingNode *p = results; p; p = p->next) {
+        DocumentInfo *doc = getDocumentById(batch->collection, p->posting.doc_id);
+        const char *file = doc ? doc->filename : "";
+        if (batch->format == BATCH_JSONL) {
+            fprintf(out, "%s{\"doc_id\":%u,\"file\":", p == results ? "" : ",", p->posting.doc_id);
+            writeJsonString(out, file);
+            fprintf(out, ",\"occurrences\":%zu,\"positions\":[", p->posting.position_count);
+            for (size_t j = 0; j < p->posting.position_count; j++) {
+                fprintf(out, j ? ",%zu" : "%zu", p->posting.positions[j]);
+            }
+            fputs("]}", out);
+        } else {
+            writeTsvField(out, query);
+            fprintf(out, "\t%u\t", p->posting.doc_id);
+            writeTsvField(out, file);
+            fprintf(out, "\t%zu\t", p->posting.position_count);
+            for (size_t j = 0; j < p->posting.position_count; j++) {
+                fprintf(out, j ? ",%zu" : "%zu", p->posting.positions[j]);
+            }
+            fputc('\n', out);
+        }
+    }
+    if (batch->format == BATCH_JSONL) fputs("]}\n", out);
+    free(term);
+}
+
+int searchIndexBatch(const char *index_file, const char *queries_file,
+                     BatchFormat format, int num_threads) {
+    IndexBatch batch = {0};
+    batch.format = format;
+    batch.queries = readQueryLines(queries_file, &batch.count);
+    if (!batch.queries) return EXIT_FAILURE;
+
+    char *full_index_path = buildIndexPath(index_file);
+    if (!full_index_path) {
+        fprintf(stderr, "Error: No se pudo construir la ruta del índice\n");
+        freeQueryLines(batch.queries, batch.count);
+        return EXIT_FAILURE;
+    }
+
+    // stdout lleva solo resultados: los mensajes de carga van a stderr
+    fflush(stdout);
+    int saved_stdout = dup(STDOUT_FILENO);
+    dup2(STDERR_FILENO, STDOUT_FILENO);
+    int loaded = loadIndexFromBinary(&batch.index, &batch.collection, full_index_path);
+    fflush(stdout);
+    dup2(saved_stdout, STDOUT_FILENO);
+    close(saved_stdout);
+
+    if (loaded != 0) {
+        fprintf(stderr, "Error al cargar el índice desde: %s\n", full_index_path);
+        free(full_index_path);
+        freeQueryLines(batch.queries, batch.count);
+        return EXIT_FAILURE;
+    }
+    free(full_index_path);
+
+    if (num_threads <= 0) num_threads = defaultThreadCount();
+    runBatch(batch.count, num_threads, renderIndexQuery, &batch);
+    fprintf(stderr, "%zu consultas evaluadas\n", batch.count);
+
+    destroyIndex(batch.index);
+    destroyDocumentCollection(batch.collection);
+    freeQueryLines(batch.queries, batch.count);
+    return EXIT_SUCCESS;
+}
+
+// ============================================================================
+// Patrones contra un archivo
+// ============================================================================
+
+static void addMatch(PatternMatches *m, size_t offset) {
+    if (m->count >= m->capacity) {
+        size_t new_cap = m->capacity ? m->capacity * 2 : 16;
+        size_t *grown = realloc(m->offsets, new_cap * sizeof(size_t));
+        if (!grown) return;
+        m->offsets = grown;
+        m->capacity = new_cap;
+    }
+    m->offsets[m->count++] = offset;
+}
+
+static void onByteMatch(size_t pos, void *ctx) {
+    addMatch(ctx, pos);
+}
+
+// bm reporta code-points en orden creciente: se traducen a bytes avanzando
+// un cursor, como en index grep
+static void onCodePointMatch(size_t pos, void *ctx) {
+    PatternMatches *m = ctx;
+    m->cursor = advanceUTF8(m->cursor, pos - m->cursor_cp);
+    m->cursor_cp = pos;
+    addMatch(m, (size_t)(m->cursor - m->text));
+}
+
+// Resuelve "auto" con el planificador; el resto de nombres pasa tal cual
+static const char* resolveAlgorithm(const PatternBatch *batch, const char *pattern) {
+    if (strcmp(batch->alg, "auto") != 0) return batch->alg;
+    SearchPlan plan = planSearch(pattern, batch->text, batch->thresholds);
+    return plannedAlgorithmName(plan.alg);
+}
+
+// Ejecuta un patrón ya normalizado; -1 si el algoritmo no aplica
+static int runPattern(const PatternBatch *batch, const char *alg, const char *pattern,
+                      PatternMatches *m, size_t *count) {
+    SearchMode mode = batch->mode;
+    m->text = m->cursor = batch->text;
+    if (strcmp(alg, "kmp") == 0) {
+        KmpPattern *p = compileKMP(pattern);
+        if (!p) return -1;
+        *count = execKMP(p, batch->text, batch->text_len, mode, onByteMatch, m);
+        freeKMP(p);
+    } else if (strcmp(alg, "kmp_dfa") == 0) {
+        KmpDfaPattern *p = compileKMPDFA(pattern);
+        if (!p) return -1;
+        *count = execKMPDFA(p, batch->text, batch->text_len, mode, onByteMatch, m);
+        freeKMPDFA(p);
+    } else if (strcmp(alg, "shiftand") == 0) {
+        ShiftAndPattern *p = compileShiftAnd(pattern);
+        if (!p) return -1;
+        *count = execShiftAnd(p, batch->text, batch->text_len, mode, onByteMatch, m);
+        freeShiftAnd(p);
+    } else if (strcmp(alg, "bm") == 0) {
+        BMPattern *p = batch->cps ? compileBM(pattern) : NULL;
+        if (!p) return -1;
+        *count = execBM(p, batch->cps, batch->cps_len, mode, onCodePointMatch, m);
+        freeBM(p);
+    } else if (strcmp(alg, "memchr") == 0) {
+        size_t M = strlen(pattern);
+        if (M == 0 || M > 2) return -1;
+        *count = execMemchr(pattern, M, batch->text, batch->text_len, mode, onByteMatch, m);
+    } else {
+        return -1;
+    }
+    return 0;
+}
+
+static void renderPattern(size_t i, FILE *out, void *arg) {
+    PatternBatch *batch = arg;
+    const char *original = batch->patterns[i];
+
+    char *pattern = strdup(original);
+    if (!pattern) return;
+    normalizeString(&pattern, batch->norm_opts);
+
+    const char *alg = resolveAlgorithm(batch, pattern);
+    PatternMatches m = {0};
+    size_t count = 0;
+    int failed = runPattern(batch, alg, pattern, &m, &count) != 0;
+
+    if (batch->format == BATCH_JSONL) {
+        fputs("{\"pattern\":", out);
+        writeJsonString(out, original);
+        fputs(",\"algorithm\":", out);
+        writeJsonString(out, alg);
+        if (failed) {
+            fputs(",\"error\":\"patrón no válido para el algoritmo\"}\n", out);
+        } else {
+            fprintf(out, ",\"count\":%zu", count);
+            if (batch->mode != SEARCH_COUNT) {
+                fputs(",\"offsets\":[", out);
+                for (size_t j = 0; j < m.count; j++) fprintf(out, j ? ",%zu" : "%zu", m.offsets[j]);
+                fputc(']', out);
+            }
+            fputs("}\n", out);
+        }
+    } else if (failed) {
+        fprintf(stderr, "Patrón no válido para %s: %s\n", alg, original);
+    } else if (batch->mode == SEARCH_COUNT) {
+        writeTsvField(out, original);
+        fprintf(out, "\t%zu\n", count);
+    } else {
+        for (size_t j = 0; j < m.count; j++) {
+            writeTsvField(out, original);
+            fprintf(out, "\t%zu\n", m.offsets[j]);
+        }
+    }
+
+    free(m.offsets);
+    free(pattern);
+}
+
+int searchPatternsBatch(const char *alg, const char *patterns_file, const char *filename,
+                        const NormalizationOptions *norm_opts, SearchMode mode,
+                        BatchFormat format, int num_threads) {
+    const char *known[] = { "auto", "kmp", "kmp_dfa", "bm", "shiftand", "memchr" };
+    int valid = 0;
+    for (size_t k = 0; k < sizeof(known) / sizeof(known[0]); k++) {
+        if (strcmp(alg, known[k]) == 0) valid = 1;
+    }
+    if (!valid) {
+        fprintf(stderr, "Algoritmo no reconocido: %s (opciones: auto, kmp, kmp_dfa, bm, shiftand, memchr)\n", alg);
+        return EXIT_FAILURE;
+    }
+
+    PatternBatch batch = {0};
+    batch.alg = alg;
+    batch.norm_opts = norm_opts;
+    batch.mode = mode;
+    batch.format = format;
+    batch.patterns = readQueryLines(patterns_file, &batch.count);
+    if (!batch.patterns) return EXIT_FAILURE;
+
+    // Texto cargado, limpiado y normalizado una sola vez
+    char *text = loadFile(filename);
+    if (text && isHTMLFile(filename)) {
+        char *stripped = stripHTML(text);
+        free(text);
+        text = stripped;
+    }
+    if (!text) {
+        freeQueryLines(batch.patterns, batch.count);
+        return EXIT_FAILURE;
+    }
+    normalizeString(&text, norm_opts);
+    batch.text = text;
+    batch.text_len = strlen(text);
+
+    PlannerThresholds thresholds;
+    loadPlannerThresholds(PLANNER_CONFIG_FILE, &thresholds);
+    batch.thresholds = &thresholds;
+
+    // bm trabaja sobre code-points: el texto se decodifica una vez para todos
+    uint32_t *cps = NULL;
+    if (strcmp(alg, "bm") == 0 || strcmp(alg, "auto") == 0) {
+        cps = decodeUTF8(text, &batch.cps_len);
+        batch.cps = cps;
+    }
+
+    if (num_threads <= 0) num_threads = defaultThreadCount();
+    runBatch(batch.count, num_threads, renderPattern, &batch);
+    fprintf(stderr, "%zu patrones evaluados sobre %s\n", batch.count, filename);
+
+    free(cps);
+    free(text);
+    freeQueryLines(batch.patterns, batch.count);
+    return EXIT_SUCCESS;
+}
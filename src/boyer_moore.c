@@ -13,6 +13,35 @@
 static size_t bm_char_comparisons = 0;
 static size_t bm_shifts            = 0;
 
+//decodifica un code-point en p; devuelve los bytes consumidos
+//(0 si la secuencia no es valida y debe saltarse un byte)
+static size_t decodeOneUTF8(const unsigned char *p, uint32_t *cp) {
+    if (*p < 0x80) {
+        *cp = *p;
+        return 1;
+    } else if ((*p & 0xE0) == 0xC0 && (p[1] & 0xC0) == 0x80) {
+        *cp = ((*p & 0x1F) << 6) | (p[1] & 0x3F);
+        return 2;
+    } else if ((*p & 0xF0) == 0xE0 &&
+               (p[1] & 0xC0) == 0x80 &&
+               (p[2] & 0xC0) == 0x80) {
+        *cp = ((*p & 0x0F) << 12) |
+              ((p[1] & 0x3F) << 6) |
+              (p[2] & 0x3F);
+        return 3;
+    } else if ((*p & 0xF8) == 0xF0 &&
+               (p[1] & 0xC0) == 0x80 &&
+               (p[2] & 0xC0) == 0x80 &&
+               (p[3] & 0xC0) == 0x80) {
+        *cp = ((*p & 0x07) << 18) |
+              ((p[1] & 0x3F) << 12) |
+              ((p[2] & 0x3F) << 6) |
+              (p[3] & 0x3F);
+        return 4;
+    }
+    return 0;
+}
+
 uint32_t* decodeUTF8(const char *utf8, size_t *outLen) {
     size_t cap = 16, len = 0;
     uint32_t *arr = malloc(cap * sizeof(uint32_t));
@@ -20,31 +49,12 @@ uint32_t* decodeUTF8(const char *utf8, size_t *outLen) {
     const unsigned char *p = (const unsigned char*)utf8;
     while (*p) {
         uint32_t cp = 0;
-        if (*p < 0x80) {
-            cp = *p++;
-        } else if ((*p & 0xE0) == 0xC0 && (p[1] & 0xC0) == 0x80) {
-            cp = ((*p & 0x1F) << 6) | (p[1] & 0x3F);
-            p += 2;
-        } else if ((*p & 0xF0) == 0xE0 &&
-                   (p[1] & 0xC0) == 0x80 &&
-                   (p[2] & 0xC0) == 0x80) {
-            cp = ((*p & 0x0F) << 12) |
-                 ((p[1] & 0x3F) << 6) |
-                 (p[2] & 0x3F);
-            p += 3;
-        } else if ((*p & 0xF8) == 0xF0 &&
-                   (p[1] & 0xC0) == 0x80 &&
-                   (p[2] & 0xC0) == 0x80 &&
-                   (p[3] & 0xC0) == 0x80) {
-            cp = ((*p & 0x07) << 18) |
-                 ((p[1] & 0x3F) << 12) |
-                 ((p[2] & 0x3F) << 6) |
-                 (p[3] & 0x3F);
-            p += 4;
-        } else {
+        size_t used = decodeOneUTF8(p, &cp);
+        if (used == 0) {
             p++;
             continue;
         }
+        p += used;
         if (len + 1 >= cap) {
             cap *= 2;
             arr = realloc(arr, cap * sizeof(uint32_t));
@@ -56,6 +66,24 @@ uint32_t* decodeUTF8(const char *utf8, size_t *outLen) {
     return arr;
 }
 
+const char* advanceUTF8(const char *utf8, size_t count) {
+    const unsigned char *p = (const unsigned char*)utf8;
+    while (*p && count > 0) {
+        uint32_t cp;
+        size_t used = decodeOneUTF8(p, &cp);
+        if (used == 0) {
+            p++;
+            continue;
+        }
+        p += used;
+        count--;
+    }
+    //salta bytes invalidos para quedar sobre el siguiente code-point
+    uint32_t cp;
+    while (*p && decodeOneUTF8(p, &cp) == 0) p++;
+    return (const char*)p;
+}
+
 BMMapEntry* preprocessBadCharUnicode(const uint32_t *pat, size_t M, size_t *mapSize) {
     BMMapEntry *map = malloc(M * sizeof(BMMapEntry));
     if (!map) return NULL;
@@ -78,30 +106,31 @@ BMMapEntry* preprocessBadCharUnicode(const uint32_t *pat, size_t M, size_t *mapS
     return map;
 }
 
+//suffix[i] = largo del sufijo mas largo del patron que termina en i
+//(indices con signo: g puede llegar a -1)
 static void computeSuffixesUnicode(const uint32_t *pat, size_t M, size_t *suffix) {
+    ptrdiff_t m = (ptrdiff_t)M;
     suffix[M-1] = M;
-    size_t g = M-1, f = 0;
-    for (ptrdiff_t i = (ptrdiff_t)M - 2; i >= 0; i--) {
-        if ((size_t)i > g && suffix[i + M - 1 - f] < (size_t)(i - g)) {
-            suffix[i] = suffix[i + M - 1 - f];
+    ptrdiff_t g = m - 1, f = 0;
+    for (ptrdiff_t i = m - 2; i >= 0; i--) {
+        if (i > g && (ptrdiff_t)suffix[i + m - 1 - f] < i - g) {
+            suffix[i] = suffix[i + m - 1 - f];
         } else {
-            if ((size_t)i < g) g = (size_t)i;
-            f = (size_t)i;
-            while ((ptrdiff_t)g >= 0 && pat[g] == pat[g + M - 1 - f]) g--;
-            suffix[i] = f - g;
+            if (i < g) g = i;
+            f = i;
+            while (g >= 0 && pat[g] == pat[g + m - 1 - f]) g--;
+            suffix[i] = (size_t)(f - g);
         }
     }
 }
 
+//shiftGS[j] = desplazamiento good-suffix al fallar en la posicion j
+//(shiftGS[0] tambien es el desplazamiento tras una coincidencia completa)
 void preprocessGoodSuffixUnicode(const uint32_t *pat, size_t M, size_t *shiftGS) {
     size_t *suffix = malloc((M+1)*sizeof(size_t));
     if (!suffix) return;
     computeSuffixesUnicode(pat, M, suffix);
     for (size_t i = 0; i <= M; i++) shiftGS[i] = M;
-    for (size_t i = 0; i < M; i++) {
-        size_t sl = suffix[i];
-        if (sl > 0) shiftGS[M - sl] = M - 1 - i + sl;
-    }
     size_t j = 0;
     for (ptrdiff_t i = (ptrdiff_t)M - 1; i >= 0; i--) {
         if (suffix[i] == (size_t)(i + 1)) {
@@ -111,48 +140,88 @@ void preprocessGoodSuffixUnicode(const uint32_t *pat, size_t M, size_t *shiftGS)
             }
         }
     }
+    for (size_t i = 0; i + 1 < M; i++)
+        shiftGS[M - 1 - suffix[i]] = M - 1 - i;
     free(suffix);
 }
 
-void searchBoyerMooreUnicode(const char *patternUTF8, const char *textUTF8) {
-    if (!patternUTF8 || !textUTF8) {
-        printError("searchBMUnicode: patrón o texto NULL");
-        return;
-    }
-
-    //reinicia contadores
-    bm_char_comparisons = 0;
-    bm_shifts            = 0;
+static int compareBMEntry(const void *a, const void *b) {
+    uint32_t x = ((const BMMapEntry*)a)->cp, y = ((const BMMapEntry*)b)->cp;
+    return (x > y) - (x < y);
+}
 
-    size_t M, N;
-    uint32_t *pat = decodeUTF8(patternUTF8, &M);
-    uint32_t *txt = decodeUTF8(textUTF8, &N);
-    if (!pat || !txt) {
-        free(pat); free(txt);
-        printError("searchBMUnicode: fallo al decodificar UTF-8");
-        return;
-    }
-    if (M == 0 || N == 0 || M > N) {
-        free(pat); free(txt);
-        return;
+BMPattern* compileBM(const char *patternUTF8) {
+    if (!patternUTF8) return NULL;
+    BMPattern *p = calloc(1, sizeof(BMPattern));
+    if (!p) return NULL;
+    p->pat = decodeUTF8(patternUTF8, &p->M);
+    if (!p->pat || p->M == 0) {
+        freeBM(p);
+        return NULL;
     }
 
-    //bad-character dinámico
+    //bad-character: tabla directa para latin-1 y mapa ordenado para el resto
+    for (int c = 0; c < 256; c++) p->lastLatin1[c] = -1;
     size_t mapSize;
-    BMMapEntry *bmMap = preprocessBadCharUnicode(pat, M, &mapSize);
-    if (!bmMap) { free(pat); free(txt); return; }
+    BMMapEntry *map = preprocessBadCharUnicode(p->pat, p->M, &mapSize);
+    if (!map) {
+        freeBM(p);
+        return NULL;
+    }
+    size_t rest = 0;
+    for (size_t k = 0; k < mapSize; k++) {
+        if (map[k].cp < 256) p->lastLatin1[map[k].cp] = map[k].last;
+        else map[rest++] = map[k];
+    }
+    qsort(map, rest, sizeof(BMMapEntry), compareBMEntry);
+    p->bcMap = map;
+    p->mapSize = rest;
 
     //good-suffix
-    size_t *shiftGS = malloc((M+1)*sizeof(size_t));
-    if (!shiftGS) { free(pat); free(txt); free(bmMap); return; }
-    preprocessGoodSuffixUnicode(pat, M, shiftGS);
+    p->shiftGS = malloc((p->M + 1) * sizeof(size_t));
+    if (!p->shiftGS) {
+        freeBM(p);
+        return NULL;
+    }
+    preprocessGoodSuffixUnicode(p->pat, p->M, p->shiftGS);
+    return p;
+}
+
+void freeBM(BMPattern *p) {
+    if (!p) return;
+    free(p->pat);
+    free(p->bcMap);
+    free(p->shiftGS);
+    free(p);
+}
 
-    //busqueda en code-points
+//ultima posicion de c en el patron (-1 si no aparece)
+static inline ptrdiff_t lastOccurrence(const BMPattern *p, uint32_t c) {
+    if (c < 256) return p->lastLatin1[c];
+    size_t lo = 0, hi = p->mapSize;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (p->bcMap[mid].cp < c) lo = mid + 1;
+        else hi = mid;
+    }
+    if (lo < p->mapSize && p->bcMap[lo].cp == c) return p->bcMap[lo].last;
+    return -1;
+}
+
+//lazo de busqueda en code-points; cmps/shifts son opcionales (benchmarking)
+static size_t runBM(const BMPattern *p, const uint32_t *txt, size_t N,
+                    SearchMode mode, MatchCallback cb, void *ctx,
+                    size_t *cmps, size_t *shifts) {
+    const uint32_t *pat = p->pat;
+    size_t M = p->M;
+    if (M > N) return 0;
+
+    size_t matches = 0, nCmp = 0, nShift = 0;
     for (size_t s = 0; s <= N - M; ) {
         ptrdiff_t j = (ptrdiff_t)M - 1;
         //comparaciones de caracteres
         while (j >= 0) {
-            bm_char_comparisons++;
+            nCmp++;
             if (pat[j] == txt[s + j]) {
                 j--;
             } else {
@@ -160,37 +229,86 @@ void searchBoyerMooreUnicode(const char *patternUTF8, const char *textUTF8) {
             }
         }
         if (j < 0) {
-            //coincidencia: imprimir fila de tabla
-            char pos[32];
-            sprintf(pos, "%zu", s);
-            const char *cells[] = { "bm", pos };
-            printTableRow(cells, 2);
+            matches++;
+            if (cb && mode != SEARCH_COUNT) cb(s, ctx);
+            if (mode == SEARCH_FIRST) break;
 
             //shift por good-suffix
-            s += shiftGS[0];
-            bm_shifts++;
+            s += p->shiftGS[0];
+            nShift++;
         } else {
-            //shift bad-character o good-suffix
-            uint32_t c = txt[s + j];
-            ptrdiff_t last = -1;
-            for (size_t k = 0; k < mapSize; k++) {
-                if (bmMap[k].cp == c) { last = bmMap[k].last; break; }
-            }
-            size_t bcShift = (size_t)(j - (last < 0 ? -1 : last));
-            size_t gsShift = shiftGS[j + 1];
+            //shift bad-character o good-suffix; si la ultima aparicion esta
+            //a la derecha de j el desplazamiento bad-character queda en 0
+            ptrdiff_t bc = j - lastOccurrence(p, txt[s + j]);
+            size_t bcShift = bc > 0 ? (size_t)bc : 0;
+            size_t gsShift = p->shiftGS[j];
             s += (bcShift > gsShift ? bcShift : gsShift);
-            bm_shifts++;
+            nShift++;
         }
     }
+    if (cmps) *cmps = nCmp;
+    if (shifts) *shifts = nShift;
+    return matches;
+}
 
-    printTableFooter(2);
+size_t execBM(const BMPattern *p, const uint32_t *txt, size_t N,
+              SearchMode mode, MatchCallback cb, void *ctx) {
+    if (!p || !txt) return 0;
+    return runBM(p, txt, N, mode, cb, ctx, NULL, NULL);
+}
 
-    free(pat);
+//callback que imprime cada coincidencia como fila de tabla
+static void printBMRow(size_t s, void *ctx) {
+    (void)ctx;
+    char pos[32];
+    sprintf(pos, "%zu", s);
+    const char *cells[] = { "bm", pos };
+    printTableRow(cells, 2);
+}
+
+size_t searchBoyerMooreUnicode(const char *patternUTF8, const char *textUTF8,
+                               SearchMode mode) {
+    if (!patternUTF8 || !textUTF8) {
+        printError("searchBMUnicode: patrón o texto NULL");
+        return 0;
+    }
+
+    //reinicia contadores
+    bm_char_comparisons = 0;
+    bm_shifts            = 0;
+
+    size_t N;
+    BMPattern *bp = compileBM(patternUTF8);
+    uint32_t *txt = decodeUTF8(textUTF8, &N);
+    if (!bp || !txt) {
+        freeBM(bp); free(txt);
+        printError("searchBMUnicode: fallo al decodificar UTF-8");
+        return 0;
+    }
+    //con M > N runBM no hace nada, pero se informa el conteo como siempre
+    if (N == 0) {
+        freeBM(bp); free(txt);
+        return 0;
+    }
+
+    size_t first = 0;
+    size_t matches = runBM(bp, txt, N, mode,
+                           mode == SEARCH_ALL ? printBMRow : storeFirstMatch,
+                           &first, &bm_char_comparisons, &bm_shifts);
+
+    freeBM(bp);
     free(txt);
-    free(bmMap);
-    free(shiftGS);
+
+    if (mode != SEARCH_ALL) {
+        if (mode == SEARCH_FIRST && matches > 0) printMatch(first, "bm");
+        else printMatchCount(matches, "bm");
+        return matches;
+    }
+
+    printTableFooter(2);
 
     //imprime métricas
     printf("[BM Unicode] Comparaciones: %zu, Shifts: %zu\n",
            bm_char_comparisons, bm_shifts);
-}
\ No newline at end of file
+    return matches;
+}
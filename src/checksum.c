@@ -0,0 +1,71 @@
+// Diego Galindo, Francisco Mercado
+#include "checksum.h"
+#include <string.h>
+
+#if defined(__SSE4_2__)
+#include <nmmintrin.h>
+
+uint32_t crc32c(uint32_t crc, const void *data, size_t len) {
+    const unsigned char *p = data;
+    uint64_t c = ~crc & 0xFFFFFFFFu;
+
+    // 8 bytes por instrucción; una sola cadena ya da varios GB/s
+    while (len >= 8) {
+        uint64_t word;
+        memcpy(&word, p, 8);
+        c = _mm_crc32_u64(c, word);
+        p += 8;
+        len -= 8;
+    }
+    uint32_t c32 = (uint32_t)c;
+    while (len--) c32 = _mm_crc32_u8(c32, *p++);
+    return ~c32;
+}
+
+#else
+#include <pthread.h>
+
+// Polinomio reflejado de Castagnoli
+#define CRC32C_POLY 0x82F63B78u
+
+static uint32_t crc_table[8][256];
+static pthread_once_t crc_once = PTHREAD_ONCE_INIT;
+
+static void buildTables(void) {
+    for (uint32_t i = 0; i < 256; i++) {
+        uint32_t c = i;
+        for (int k = 0; k < 8; k++) c = (c >> 1) ^ (CRC32C_POLY & (0u - (c & 1)));
+        crc_table[0][i] = c;
+    }
+    for (uint32_t i = 0; i < 256; i++) {
+        for (int t = 1; t < 8; t++) {
+            uint32_t prev = crc_table[t - 1][i];
+            crc_table[t][i] = (prev >> 8) ^ crc_table[0][prev & 0xFF];
+        }
+    }
+}
+
+uint32_t crc32c(uint32_t crc, const void *data, size_t len) {
+    pthread_once(&crc_once, buildTables);
+
+    const unsigned char *p = data;
+    uint32_t c = ~crc;
+
+    // Slice-by-8: 8 bytes por iteración con 8 consultas independientes
+    while (len >= 8) {
+        uint32_t lo, hi;
+        memcpy(&lo, p, 4);
+        memcpy(&hi, p + 4, 4);
+        lo ^= c;
+        c = crc_table[7][lo & 0xFF] ^ crc_table[6][(lo >> 8) & 0xFF] ^
+            crc_table[5][(lo >> 16) & 0xFF] ^ crc_table[4][lo >> 24] ^
+            crc_table[3][hi & 0xFF] ^ crc_table[2][(hi >> 8) & 0xFF] ^
+            crc_table[1][(hi >> 16) & 0xFF] ^ crc_table[0][hi >> 24];
+        p += 8;
+        len -= 8;
+    }
+    while (len--) c = (c >> 8) ^ crc_table[0][(c ^ *p++) & 0xFF];
+    return ~c;
+}
+
+#endif
@@ -19,8 +19,10 @@ static bool use_color() {
 }
 
 static const char* colorForAlgorithm(const char* alg) {
-    if (strcmp(alg, "kmp") == 0)           return ANSI_BLUE;
+    if (strcmp(alg, "kmp") == 0
+     || strcmp(alg, "kmp_dfa") == 0)       return ANSI_BLUE;
     else if (strcmp(alg, "bm") == 0)       return ANSI_YELLOW;
+    else if (strcmp(alg, "memchr") == 0)   return ANSI_GREEN;
     else if (strcmp(alg, "sa") == 0
           || strcmp(alg, "shiftand") == 0) return ANSI_MAGENTA;
     else                                    return ANSI_RESET;
@@ -101,6 +103,17 @@ void printMatch(size_t position, const char *algorithm) {
     }
 }
 
+void printMatchCount(size_t count, const char *algorithm) {
+    if (use_color()) {
+        const char *c_alg = colorForAlgorithm(algorithm);
+        printf("%s%s%s: %s%zu%s coincidencias\n",
+               c_alg, algorithm, ANSI_RESET,
+               ANSI_GREEN, count, ANSI_RESET);
+    } else {
+        printf("%s: %zu coincidencias\n", algorithm, count);
+    }
+}
+
 void printError(const char *msg) {
     if (use_color()) {
         fprintf(stderr, ANSI_RED "Error: %s" ANSI_RESET "\n", msg);
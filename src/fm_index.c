@@ -0,0 +1,684 @@
+// Diego Galindo, Francisco Mercado
+#define _POSIX_C_SOURCE 200809L
+#include "fm_index.h"
+#include "suffix_array.h"
+#include "cli.h"
+#include "checksum.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <math.h>
+#include <fcntl.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+//la BWT tiene n + 1 filas (la fila 0 es el sufijo vacio, el del centinela).
+//la fila primary tiene el centinela en la BWT; el wavelet tree guarda las
+//otras n, asi que la fila r esta en la posicion r (r < primary) o r - 1.
+//occ(c, r) = apariciones de c en las filas [0, r) y LF(r) = C[c] + occ(c, r).
+
+#define FM_HEADER_SIZE 64
+#define FM_NODE_SIZE 16
+#define FM_BLOCK_BITS 512
+#define FM_MAX_CODE 64
+
+// ============================================================================
+// bitvector con rank
+// ============================================================================
+
+static int rbInit(RankBitvector *bv, size_t length) {
+    bv->length = length;
+    bv->words = length / 64 + 1;    //palabra extra: rank(length) no se sale
+    bv->bits = calloc(bv->words, sizeof(uint64_t));
+    bv->super = calloc((length >> 16) + 1, sizeof(uint64_t));
+    bv->blocks = calloc((length >> 9) + 1, sizeof(uint16_t));
+    return bv->bits && bv->super && bv->blocks ? 0 : -1;
+}
+
+static void rbFree(RankBitvector *bv) {
+    free(bv->bits);
+    free(bv->super);
+    free(bv->blocks);
+    memset(bv, 0, sizeof(*bv));
+}
+
+static inline void rbSet(RankBitvector *bv, uint64_t i) {
+    bv->bits[i >> 6] |= 1ULL << (i & 63);
+}
+
+static inline int rbGet(const RankBitvector *bv, uint64_t i) {
+    return (int)((bv->bits[i >> 6] >> (i & 63)) & 1);
+}
+
+//acumulados de los superbloques (128 bloques) y de cada bloque
+static void rbBuild(RankBitvector *bv) {
+    uint64_t total = 0, base = 0;
+    size_t blocks = (bv->length >> 9) + 1;
+    for (size_t b = 0; b < blocks; b++) {
+        if ((b & 127) == 0) {
+            bv->super[b >> 7] = total;
+            base = total;
+        }
+        bv->blocks[b] = (uint16_t)(total - base);
+        for (size_t w = b * 8; w < b * 8 + 8 && w < bv->words; w++) {
+            total += (uint64_t)__builtin_popcountll(bv->bits[w]);
+        }
+    }
+}
+
+//unos en [0, i)
+static inline uint64_t rbRank1(const RankBitvector *bv, uint64_t i) {
+    uint64_t w = i >> 6;
+    uint64_t r = bv->super[i >> 16] + bv->blocks[i >> 9];
+    for (uint64_t k = (i >> 9) << 3; k < w; k++) r += (uint64_t)__builtin_popcountll(bv->bits[k]);
+    return r + (uint64_t)__builtin_popcountll(bv->bits[w] & ((1ULL << (i & 63)) - 1));
+}
+
+static size_t rbBytes(const RankBitvector *bv) {
+    return bv->words * sizeof(uint64_t) + ((bv->length >> 16) + 1) * sizeof(uint64_t) +
+           ((bv->length >> 9) + 1) * sizeof(uint16_t);
+}
+
+// ============================================================================
+// wavelet tree con forma de Huffman
+// ============================================================================
+
+//arma el arbol de Huffman de las frecuencias; los nodos internos se crean en
+//orden y la raiz es el ultimo. con un solo byte distinto se agrega otro de
+//frecuencia 0 para que haya al menos un nivel
+static int buildHuffmanTree(const uint64_t *freq, FMIndex *fm) {
+    int32_t refs[256];
+    uint64_t weights[256];
+    size_t active = 0;
+    for (int c = 0; c < 256; c++) {
+        if (freq[c] == 0) continue;
+        refs[active] = -(c + 1);
+        weights[active++] = freq[c];
+    }
+    if (active == 1) {
+        refs[1] = refs[0] == -1 ? -2 : -1;
+        weights[1] = 0;
+        active = 2;
+    }
+    fm->nodes = calloc(active - 1, sizeof(WaveletNode));
+    if (!fm->nodes) return -1;
+    fm->node_count = 0;
+
+    while (active > 1) {
+        //los dos de menor peso
+        size_t a = weights[0] <= weights[1] ? 0 : 1, b = 1 - a;
+        for (size_t i = 2; i < active; i++) {
+            if (weights[i] < weights[a]) {
+                b = a;
+                a = i;
+            } else if (weights[i] < weights[b]) {
+                b = i;
+            }
+        }
+        WaveletNode *node = &fm->nodes[fm->node_count];
+        node->child[0] = refs[a];
+        node->child[1] = refs[b];
+        uint64_t w = weights[a] + weights[b];
+        //el nuevo nodo ocupa el lugar de a y el ultimo el de b
+        refs[a] = (int32_t)fm->node_count++;
+        weights[a] = w;
+        refs[b] = refs[active - 1];
+        weights[b] = weights[active - 1];
+        active--;
+    }
+    fm->root = refs[0];
+    return 0;
+}
+
+//codigos desde la raiz; falla si el arbol no es valido (archivo corrupto)
+static int assignCodes(FMIndex *fm, int32_t node, uint64_t code, unsigned depth) {
+    if (depth >= FM_MAX_CODE || node < 0 || (size_t)node >= fm->node_count) return -1;
+    for (int bit = 0; bit < 2; bit++) {
+        int32_t child = fm->nodes[node].child[bit];
+        uint64_t child_code = code | ((uint64_t)bit << depth);
+        if (child < 0) {
+            if (child < -256 || fm->code_length[-child - 1] != 0) return -1;
+            fm->codes[-child - 1] = child_code;
+            fm->code_length[-child - 1] = (uint8_t)(depth + 1);
+        } else if (assignCodes(fm, child, child_code, depth + 1) != 0) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+//bits de cada nodo: suma de las frecuencias de los bytes que pasan por el
+static void nodeLengths(const FMIndex *fm, const uint64_t *freq, uint64_t *lengths) {
+    memset(lengths, 0, fm->node_count * sizeof(uint64_t));
+    for (int c = 0; c < 256; c++) {
+        if (freq[c] == 0) continue;
+        int32_t node = fm->root;
+        for (unsigned d = 0; d < fm->code_length[c]; d++) {
+            lengths[node] += freq[c];
+            node = fm->nodes[node].child[(fm->codes[c] >> d) & 1];
+        }
+    }
+}
+
+//C a partir de las frecuencias (la fila 0 es la del centinela)
+static void fillCounts(FMIndex *fm, const uint64_t *freq) {
+    fm->C[0] = 1;
+    for (int c = 0; c < 256; c++) fm->C[c + 1] = fm->C[c] + freq[c];
+}
+
+//apariciones de c en las primeras j posiciones del wavelet tree
+static uint64_t waveletRank(const FMIndex *fm, unsigned c, uint64_t j) {
+    int32_t node = fm->root;
+    uint64_t code = fm->codes[c];
+    for (unsigned d = 0; d < fm->code_length[c]; d++) {
+        const WaveletNode *w = &fm->nodes[node];
+        uint64_t ones = rbRank1(&fm->tree, w->offset + j) - w->ones_before;
+        int bit = (int)((code >> d) & 1);
+        j = bit ? ones : j - ones;
+        node = w->child[bit];
+    }
+    return j;
+}
+
+//byte en la posicion j y cuantas veces aparece antes (un solo recorrido)
+static unsigned waveletAccess(const FMIndex *fm, uint64_t j, uint64_t *rank) {
+    int32_t node = fm->root;
+    for (;;) {
+        const WaveletNode *w = &fm->nodes[node];
+        uint64_t ones = rbRank1(&fm->tree, w->offset + j) - w->ones_before;
+        int bit = rbGet(&fm->tree, w->offset + j);
+        j = bit ? ones : j - ones;
+        node = w->child[bit];
+        if (node < 0) {
+            *rank = j;
+            return (unsigned)(-node - 1);
+        }
+    }
+}
+
+// ============================================================================
+// busqueda
+// ============================================================================
+
+static inline uint64_t occ(const FMIndex *fm, unsigned c, uint64_t row) {
+    return waveletRank(fm, c, row <= fm->primary ? row : row - 1);
+}
+
+void fmBackwardSearch(const FMIndex *fm, const char *pat, size_t M,
+                      uint64_t *sp, uint64_t *ep) {
+    uint64_t a = 0, b = fm->n + 1;
+    for (size_t i = M; i > 0 && a < b; i--) {
+        unsigned c = (unsigned char)pat[i - 1];
+        if (fm->C[c + 1] == fm->C[c]) {
+            a = b = 0;
+            break;
+        }
+        a = fm->C[c] + occ(fm, c, a);
+        b = fm->C[c] + occ(fm, c, b);
+    }
+    *sp = a;
+    *ep = a < b ? b : a;
+}
+
+uint64_t fmLocate(const FMIndex *fm, uint64_t row) {
+    //la fila primary (posicion 0) siempre esta marcada: el ciclo termina
+    uint64_t steps = 0;
+    while (!rbGet(&fm->marks, row)) {
+        uint64_t rank;
+        unsigned c = waveletAccess(fm, row < fm->primary ? row : row - 1, &rank);
+        row = fm->C[c] + rank;
+        steps++;
+    }
+    return fm->samples[rbRank1(&fm->marks, row)] + steps;
+}
+
+size_t fmIndexBytes(const FMIndex *fm) {
+    return rbBytes(&fm->tree) + rbBytes(&fm->marks) + fm->sample_count * sizeof(uint32_t) +
+           fm->node_count * sizeof(WaveletNode);
+}
+
+void freeFMIndex(FMIndex *fm) {
+    if (!fm) return;
+    free(fm->nodes);
+    free(fm->samples);
+    rbFree(&fm->tree);
+    rbFree(&fm->marks);
+    memset(fm, 0, sizeof(*fm));
+}
+
+static double elapsedMs(const struct timespec *a, const struct timespec *b) {
+    return (double)(b->tv_sec - a->tv_sec) * 1e3 + (double)(b->tv_nsec - a->tv_nsec) / 1e6;
+}
+
+static int compareU64(const void *a, const void *b) {
+    uint64_t x = *(const uint64_t*)a, y = *(const uint64_t*)b;
+    return (x > y) - (x < y);
+}
+
+size_t searchFMIndex(const FMIndex *fm, const char *pattern, SearchMode mode) {
+    if (!fm || !pattern || pattern[0] == '\0') {
+        printError("fm-search: patrón vacío");
+        return 0;
+    }
+    uint64_t sp, ep;
+    struct timespec t0, t1, t2;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    fmBackwardSearch(fm, pattern, strlen(pattern), &sp, &ep);
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    size_t matches = (size_t)(ep - sp);
+
+    if (mode == SEARCH_COUNT || matches == 0) {
+        printMatchCount(matches, "fm-search");
+    } else if (mode == SEARCH_FIRST) {
+        //el rango esta en orden lexicografico: hay que localizarlas todas
+        uint64_t first = fmLocate(fm, sp);
+        for (uint64_t row = sp + 1; row < ep; row++) {
+            uint64_t pos = fmLocate(fm, row);
+            if (pos < first) first = pos;
+        }
+        printMatch((size_t)first, "fm-search");
+    } else {
+        uint64_t *positions = malloc(matches * sizeof(uint64_t));
+        if (!positions) {
+            printError("fm-search: memoria insuficiente");
+            return 0;
+        }
+        for (size_t i = 0; i < matches; i++) positions[i] = fmLocate(fm, sp + i);
+        qsort(positions, matches, sizeof(uint64_t), compareU64);
+        for (size_t i = 0; i < matches; i++) {
+            char pos[32];
+            sprintf(pos, "%llu", (unsigned long long)positions[i]);
+            const char *cells[] = { "fm-search", pos };
+            printTableRow(cells, 2);
+        }
+        printTableFooter(2);
+        free(positions);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t2);
+    printf("[FM] Rango [%llu, %llu) de %llu filas: conteo en %.3f ms, total %.3f ms\n",
+           (unsigned long long)sp, (unsigned long long)ep, (unsigned long long)fm->n + 1,
+           elapsedMs(&t0, &t1), elapsedMs(&t0, &t2));
+    return matches;
+}
+
+// ============================================================================
+// archivo .fm
+// ============================================================================
+//header de FM_HEADER_SIZE bytes: magic, version (u32), largo del texto (u64),
+//mtime del texto (i64), sample (u32), raiz (i32), primary (u64), nodos (u32),
+//CRC32C (u32), muestras (u64), bits del wavelet tree (u64). luego las 256
+//frecuencias (u64), los nodos (hijos i32 y offset u64), los bits del wavelet
+//tree y de las marcas (u64) y las muestras (u32), todo little-endian. los
+//codigos, C y los directorios de rank se recalculan al cargar. el CRC32C
+//cubre el header (con ese campo en 0) y todo lo que sigue: un bit cambiado
+//en el wavelet tree no se detecta de otra forma y cambia los conteos.
+
+static void putLE32(unsigned char *p, uint32_t v) {
+    p[0] = (unsigned char)v;
+    p[1] = (unsigned char)(v >> 8);
+    p[2] = (unsigned char)(v >> 16);
+    p[3] = (unsigned char)(v >> 24);
+}
+
+static uint32_t getLE32(const unsigned char *p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static void putLE64(unsigned char *p, uint64_t v) {
+    putLE32(p, (uint32_t)v);
+    putLE32(p + 4, (uint32_t)(v >> 32));
+}
+
+static uint64_t getLE64(const unsigned char *p) {
+    return (uint64_t)getLE32(p) | ((uint64_t)getLE32(p + 4) << 32);
+}
+
+//arreglos de u64 / u32 por tramos; *crc acumula el CRC32C de los bytes
+static int writeWords(FILE *file, const uint64_t *values, size_t n, uint32_t *crc) {
+    unsigned char buffer[65536];
+    size_t used = 0;
+    for (size_t i = 0; i < n; i++) {
+        putLE64(buffer + used, values[i]);
+        used += 8;
+        if (used == sizeof(buffer) || i + 1 == n) {
+            if (fwrite(buffer, 1, used, file) != used) return -1;
+            *crc = crc32c(*crc, buffer, used);
+            used = 0;
+        }
+    }
+    return 0;
+}
+
+static int readWords(FILE *file, uint64_t *values, size_t n, uint32_t *crc) {
+    unsigned char buffer[65536];
+    for (size_t i = 0; i < n;) {
+        size_t chunk = n - i < sizeof(buffer) / 8 ? n - i : sizeof(buffer) / 8;
+        if (fread(buffer, 8, chunk, file) != chunk) return -1;
+        *crc = crc32c(*crc, buffer, 8 * chunk);
+        for (size_t k = 0; k < chunk; k++) values[i + k] = getLE64(buffer + 8 * k);
+        i += chunk;
+    }
+    return 0;
+}
+
+static int writeU32s(FILE *file, const uint32_t *values, size_t n, uint32_t *crc) {
+    unsigned char buffer[65536];
+    size_t used = 0;
+    for (size_t i = 0; i < n; i++) {
+        putLE32(buffer + used, values[i]);
+        used += 4;
+        if (used == sizeof(buffer) || i + 1 == n) {
+            if (fwrite(buffer, 1, used, file) != used) return -1;
+            *crc = crc32c(*crc, buffer, used);
+            used = 0;
+        }
+    }
+    return 0;
+}
+
+static int readU32s(FILE *file, uint32_t *values, size_t n, uint32_t *crc) {
+    unsigned char buffer[65536];
+    for (size_t i = 0; i < n;) {
+        size_t chunk = n - i < sizeof(buffer) / 4 ? n - i : sizeof(buffer) / 4;
+        if (fread(buffer, 4, chunk, file) != chunk) return -1;
+        *crc = crc32c(*crc, buffer, 4 * chunk);
+        for (size_t k = 0; k < chunk; k++) values[i + k] = getLE32(buffer + 4 * k);
+        i += chunk;
+    }
+    return 0;
+}
+
+static int writeFMFile(const char *path, const FMIndex *fm, const uint64_t *freq) {
+    FILE *file = fopen(path, "wb");
+    if (!file) return -1;
+    unsigned char header[FM_HEADER_SIZE] = {0};
+    putLE32(header, FM_FILE_MAGIC);
+    putLE32(header + 4, FM_FILE_VERSION);
+    putLE64(header + 8, fm->n);
+    putLE64(header + 16, (uint64_t)fm->mtime);
+    putLE32(header + 24, fm->sample);
+    putLE32(header + 28, (uint32_t)fm->root);
+    putLE64(header + 32, fm->primary);
+    putLE32(header + 40, (uint32_t)fm->node_count);
+    putLE64(header + 48, (uint64_t)fm->sample_count);
+    putLE64(header + 56, (uint64_t)fm->tree.length);
+    //el CRC se escribe al final, en el header, con el resto ya calculado
+    uint32_t crc = crc32c(0, header, FM_HEADER_SIZE);
+    int failed = fwrite(header, 1, FM_HEADER_SIZE, file) != FM_HEADER_SIZE ||
+                 writeWords(file, freq, 256, &crc) != 0;
+    for (size_t i = 0; !failed && i < fm->node_count; i++) {
+        unsigned char node[FM_NODE_SIZE];
+        putLE32(node, (uint32_t)fm->nodes[i].child[0]);
+        putLE32(node + 4, (uint32_t)fm->nodes[i].child[1]);
+        putLE64(node + 8, fm->nodes[i].offset);
+        failed = fwrite(node, 1, FM_NODE_SIZE, file) != FM_NODE_SIZE;
+        crc = crc32c(crc, node, FM_NODE_SIZE);
+    }
+    if (!failed) {
+        failed = writeWords(file, fm->tree.bits, fm->tree.words, &crc) != 0 ||
+                 writeWords(file, fm->marks.bits, fm->marks.words, &crc) != 0 ||
+                 writeU32s(file, fm->samples, fm->sample_count, &crc) != 0;
+    }
+    if (!failed) {
+        unsigned char raw[4];
+        putLE32(raw, crc);
+        failed = fseek(file, 44, SEEK_SET) != 0 || fwrite(raw, 1, 4, file) != 4;
+    }
+    if (fclose(file) != 0) failed = 1;
+    return failed ? -1 : 0;
+}
+
+int loadFMIndex(const char *filename, FMIndex *fm) {
+    memset(fm, 0, sizeof(*fm));
+    char path[1024];
+    snprintf(path, sizeof(path), "%s%s", filename, FM_FILE_SUFFIX);
+    FILE *file = fopen(path, "rb");
+    if (!file) {
+        fprintf(stderr, "fm-search: no se encontró %s; ejecuta fm-build %s\n", path, filename);
+        return -1;
+    }
+
+    unsigned char header[FM_HEADER_SIZE];
+    uint64_t freq[256];
+    uint32_t stored_crc = 0, crc = 0;
+    int failed = fread(header, 1, FM_HEADER_SIZE, file) != FM_HEADER_SIZE ||
+                 getLE32(header) != FM_FILE_MAGIC || getLE32(header + 4) != FM_FILE_VERSION;
+    if (!failed) {
+        stored_crc = getLE32(header + 44);
+        memset(header + 44, 0, 4);
+        crc = crc32c(0, header, FM_HEADER_SIZE);
+        failed = readWords(file, freq, 256, &crc) != 0;
+    }
+    if (!failed) {
+        fm->n = getLE64(header + 8);
+        fm->mtime = (int64_t)getLE64(header + 16);
+        fm->sample = getLE32(header + 24);
+        fm->root = (int32_t)getLE32(header + 28);
+        fm->primary = getLE64(header + 32);
+        fm->node_count = getLE32(header + 40);
+        fm->sample_count = (size_t)getLE64(header + 48);
+        uint64_t total = 0;
+        for (int c = 0; c < 256; c++) total += freq[c];
+        failed = total != fm->n || fm->n == 0 || fm->n > SA_MAX_TEXT || fm->primary > fm->n ||
+                 fm->node_count == 0 || fm->node_count > 255 || fm->sample == 0 ||
+                 fm->sample_count > fm->n + 1 ||
+                 getLE64(header + 56) > fm->n * FM_MAX_CODE + 256 * FM_BLOCK_BITS ||
+                 rbInit(&fm->tree, (size_t)getLE64(header + 56)) != 0 ||
+                 rbInit(&fm->marks, (size_t)fm->n + 1) != 0;
+    }
+    if (!failed) {
+        fm->nodes = calloc(fm->node_count, sizeof(WaveletNode));
+        fm->samples = malloc((fm->sample_count + 1) * sizeof(uint32_t));
+        failed = !fm->nodes || !fm->samples;
+    }
+    for (size_t i = 0; !failed && i < fm->node_count; i++) {
+        unsigned char node[FM_NODE_SIZE];
+        failed = fread(node, 1, FM_NODE_SIZE, file) != FM_NODE_SIZE;
+        crc = crc32c(crc, node, FM_NODE_SIZE);
+        fm->nodes[i].child[0] = (int32_t)getLE32(node);
+        fm->nodes[i].child[1] = (int32_t)getLE32(node + 4);
+        fm->nodes[i].offset = getLE64(node + 8);
+    }
+    if (!failed) {
+        failed = readWords(file, fm->tree.bits, fm->tree.words, &crc) != 0 ||
+                 readWords(file, fm->marks.bits, fm->marks.words, &crc) != 0 ||
+                 readU32s(file, fm->samples, fm->sample_count, &crc) != 0;
+    }
+    fclose(file);
+    if (!failed && crc != stored_crc) {
+        fprintf(stderr, "fm-search: %s está dañado (CRC32C no coincide); ejecuta fm-build %s\n",
+                path, filename);
+        freeFMIndex(fm);
+        return -1;
+    }
+
+    //el arbol y los offsets tienen que caber en los bits leidos
+    uint64_t *lengths = failed ? NULL : malloc(fm->node_count * sizeof(uint64_t));
+    if (!failed) failed = !lengths || assignCodes(fm, fm->root, 0, 0) != 0;
+    for (int c = 0; !failed && c < 256; c++) failed = freq[c] != 0 && fm->code_length[c] == 0;
+    if (!failed) {
+        nodeLengths(fm, freq, lengths);
+        for (size_t i = 0; !failed && i < fm->node_count; i++) {
+            failed = fm->nodes[i].offset > fm->tree.length ||
+                     lengths[i] > fm->tree.length - fm->nodes[i].offset;
+        }
+    }
+    free(lengths);
+    if (!failed) {
+        rbBuild(&fm->tree);
+        rbBuild(&fm->marks);
+        failed = rbRank1(&fm->marks, fm->marks.length) != fm->sample_count ||
+                 !rbGet(&fm->marks, fm->primary);
+        for (size_t i = 0; !failed && i < fm->node_count; i++) {
+            fm->nodes[i].ones_before = rbRank1(&fm->tree, fm->nodes[i].offset);
+        }
+        fillCounts(fm, freq);
+    }
+    if (failed) {
+        fprintf(stderr, "fm-search: %s no es un FM-index válido; ejecuta fm-build %s\n",
+                path, filename);
+        freeFMIndex(fm);
+        return -1;
+    }
+
+    //es un autoindice: sin el texto se busca igual, pero si esta y cambio
+    //el indice ya no le corresponde
+    struct stat st;
+    if (stat(filename, &st) == 0 &&
+        ((uint64_t)st.st_size != fm->n || (int64_t)st.st_mtime != fm->mtime)) {
+        fprintf(stderr, "fm-search: %s cambió desde fm-build; ejecuta fm-build %s\n",
+                filename, filename);
+        freeFMIndex(fm);
+        return -1;
+    }
+    return 0;
+}
+
+// ============================================================================
+// construccion
+// ============================================================================
+
+//llena el wavelet tree, las marcas y las muestras recorriendo SA fila a fila
+static int fillFromSuffixArray(FMIndex *fm, const unsigned char *text, const int32_t *SA,
+                               const uint64_t *freq) {
+    size_t n = (size_t)fm->n;
+    uint64_t *lengths = malloc(fm->node_count * sizeof(uint64_t));
+    uint64_t *fill = calloc(fm->node_count, sizeof(uint64_t));
+    if (!lengths || !fill) {
+        free(lengths);
+        free(fill);
+        return -1;
+    }
+    //cada nodo empieza en un bloque propio: rank dentro del nodo = resta de dos rank
+    nodeLengths(fm, freq, lengths);
+    uint64_t offset = 0;
+    for (size_t i = 0; i < fm->node_count; i++) {
+        fm->nodes[i].offset = offset;
+        offset += (lengths[i] + FM_BLOCK_BITS - 1) / FM_BLOCK_BITS * FM_BLOCK_BITS;
+    }
+    free(lengths);
+
+    size_t sample_capacity = n / fm->sample + 2;
+    fm->samples = malloc(sample_capacity * sizeof(uint32_t));
+    if (!fm->samples || rbInit(&fm->tree, (size_t)offset) != 0 ||
+        rbInit(&fm->marks, n + 1) != 0) {
+        free(fill);
+        return -1;
+    }
+
+    //la fila 0 es el sufijo vacio (posicion n) y la fila r, SA[r - 1]
+    fm->sample_count = 0;
+    for (size_t row = 0; row <= n; row++) {
+        size_t pos = row == 0 ? n : (size_t)SA[row - 1];
+        if (pos % fm->sample == 0) {
+            rbSet(&fm->marks, row);
+            fm->samples[fm->sample_count++] = (uint32_t)pos;
+        }
+        if (pos == 0) {
+            fm->primary = row;
+            continue;
+        }
+        unsigned c = text[pos - 1];
+        int32_t node = fm->root;
+        for (unsigned d = 0; d < fm->code_length[c]; d++) {
+            int bit = (int)((fm->codes[c] >> d) & 1);
+            if (bit) rbSet(&fm->tree, fm->nodes[node].offset + fill[node]);
+            fill[node]++;
+            node = fm->nodes[node].child[bit];
+        }
+    }
+    free(fill);
+
+    rbBuild(&fm->tree);
+    rbBuild(&fm->marks);
+    for (size_t i = 0; i < fm->node_count; i++) {
+        fm->nodes[i].ones_before = rbRank1(&fm->tree, fm->nodes[i].offset);
+    }
+    fillCounts(fm, freq);
+    return 0;
+}
+
+int buildFMIndexFile(const char *filename, uint32_t sample) {
+    int fd = open(filename, O_RDONLY);
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) != 0 || st.st_size <= 0) {
+        fprintf(stderr, "fm-build: no se pudo leer %s: %s\n", filename,
+                fd < 0 ? strerror(errno) : "archivo vacío");
+        if (fd >= 0) close(fd);
+        return -1;
+    }
+    size_t n = (size_t)st.st_size;
+    if (n > SA_MAX_TEXT) {
+        fprintf(stderr, "fm-build: %s supera el máximo de %u bytes\n", filename, SA_MAX_TEXT);
+        close(fd);
+        return -1;
+    }
+    const unsigned char *text = mmap(NULL, n, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (text == MAP_FAILED) {
+        fprintf(stderr, "fm-build: no se pudo mapear %s: %s\n", filename, strerror(errno));
+        return -1;
+    }
+
+    FMIndex fm;
+    memset(&fm, 0, sizeof(fm));
+    fm.n = n;
+    fm.mtime = (int64_t)st.st_mtime;
+    fm.sample = sample ? sample : FM_DEFAULT_SAMPLE;
+
+    uint64_t freq[256] = {0};
+    for (size_t i = 0; i < n; i++) freq[text[i]]++;
+
+    //el SA solo hace falta durante la construccion
+    struct timespec t0, t1, t2;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    int32_t *SA = malloc((n + 1) * sizeof(int32_t));
+    int failed = !SA || buildSuffixArray(text, n, SA) != 0;
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    if (!failed) {
+        failed = buildHuffmanTree(freq, &fm) != 0 || assignCodes(&fm, fm.root, 0, 0) != 0 ||
+                 fillFromSuffixArray(&fm, text, SA, freq) != 0;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t2);
+    free(SA);
+    munmap((void*)text, n);
+
+    //se escribe a un temporal y se renombra: los lectores nunca ven un .fm a medias
+    char path[1024], tmp_path[1100];
+    snprintf(path, sizeof(path), "%s%s", filename, FM_FILE_SUFFIX);
+    snprintf(tmp_path, sizeof(tmp_path), "%s.tmp.%ld", path, (long)getpid());
+    if (!failed) {
+        failed = writeFMFile(tmp_path, &fm, freq) != 0 || rename(tmp_path, path) != 0;
+        if (failed) unlink(tmp_path);
+    }
+    if (failed) {
+        fprintf(stderr, "fm-build: error al construir o escribir %s\n", path);
+        freeFMIndex(&fm);
+        return -1;
+    }
+
+    //entropia de orden 0 contra el largo medio del codigo de Huffman
+    double h0 = 0.0, code_bits = 0.0;
+    for (int c = 0; c < 256; c++) {
+        if (freq[c] == 0) continue;
+        double p = (double)freq[c] / (double)n;
+        h0 -= p * log2(p);
+        code_bits += p * fm.code_length[c];
+    }
+    struct stat fm_st;
+    size_t memory = fmIndexBytes(&fm);
+    printf("[FM] %s: %zu bytes\n", filename, n);
+    printf("[FM] SA-IS: %.2f ms, BWT y wavelet tree: %.2f ms\n",
+           elapsedMs(&t0, &t1), elapsedMs(&t1, &t2));
+    printf("[FM] H0: %.2f bits/byte, código de Huffman medio: %.2f bits/byte\n", h0, code_bits);
+    printf("[FM] SA muestreado cada %u posiciones: %zu muestras\n", fm.sample, fm.sample_count);
+    printf("[FM] Guardado en %s (%lld bytes)\n", path,
+           stat(path, &fm_st) == 0 ? (long long)fm_st.st_size : -1LL);
+    printf("[FM] En memoria: %zu bytes (%.2f bits por byte del texto)\n", memory,
+           8.0 * (double)memory / (double)n);
+    freeFMIndex(&fm);
+    return 0;
+}
@@ -0,0 +1,400 @@
+// Diego Galindo, Francisco Mercado
+#include "html_stripper.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <stdint.h>
+
+// Estados de la máquina
+enum {
+    ST_TEXT,
+    ST_TAG_OPEN,      // Después de '<'
+    ST_END_TAG_OPEN,  // Después de "</"
+    ST_TAG_NAME,
+    ST_TAG,           // Atributos hasta '>'
+    ST_BOGUS,         // <!DOCTYPE ...>, <?xml ...?>: se ignora hasta '>'
+    ST_MARKUP,        // Después de "<!"
+    ST_COMMENT,
+    ST_CDATA,
+    ST_RAWTEXT,       // Contenido de <script>/<style>
+    ST_RAWTEXT_END,   // Se leyó "</script", falta confirmar el fin del nombre
+    ST_ENTITY
+};
+
+// Elementos de bloque: al abrirlos o cerrarlos se emite un separador para
+// que "<p>hola</p><p>mundo</p>" no se convierta en una sola palabra
+static const char *const block_tags[] = {
+    "address", "article", "aside", "blockquote", "body", "br", "dd", "div",
+    "dl", "dt", "footer", "form", "h1", "h2", "h3", "h4", "h5", "h6", "head",
+    "header", "hr", "html", "li", "main", "nav", "ol", "option", "p", "pre",
+    "section", "table", "td", "th", "title", "tr", "ul"
+};
+
+static int compareTagName(const void *key, const void *elem) {
+    return strcmp((const char*)key, *(const char *const*)elem);
+}
+
+const HtmlEntity* lookupHtmlEntity(const char *name, size_t len) {
+    uint32_t bucket = htmlEntityHash(name, len, 0) % html_entity_bucket_count;
+    uint32_t slot = htmlEntityHash(name, len, html_entity_disp[bucket]) % html_entity_slot_count;
+    const HtmlEntity *e = &html_entity_slots[slot];
+    if (!e->name || e->name_len != len || memcmp(e->name, name, len) != 0) return NULL;
+    return e;
+}
+
+void initHTMLStripper(HtmlStripper *s, HtmlTextSink sink, void *ctx) {
+    memset(s, 0, sizeof(*s));
+    s->sink = sink;
+    s->ctx = ctx;
+    s->state = ST_TEXT;
+}
+
+static void flushOutput(HtmlStripper *s) {
+    if (s->out_len > 0 && s->sink) s->sink(s->out, s->out_len, s->ctx);
+    s->out_len = 0;
+}
+
+static void emitBytes(HtmlStripper *s, const char *data, size_t len) {
+    if (len == 0) return;
+    s->last = data[len - 1];
+    while (len > 0) {
+        size_t room = HTML_STRIPPER_BUFFER - s->out_len;
+        size_t n = len < room ? len : room;
+        memcpy(s->out + s->out_len, data, n);
+        s->out_len += n;
+        data += n;
+        len -= n;
+        if (s->out_len == HTML_STRIPPER_BUFFER) flushOutput(s);
+    }
+}
+
+static void emitByte(HtmlStripper *s, char c) {
+    emitBytes(s, &c, 1);
+}
+
+static void emitSeparator(HtmlStripper *s) {
+    if (s->last && !isspace((unsigned char)s->last)) emitByte(s, ' ');
+}
+
+static void emitCodePoint(HtmlStripper *s, uint32_t cp) {
+    char buf[4];
+    size_t n;
+    if (cp < 0x80) { buf[0] = (char)cp; n = 1; }
+    else if (cp < 0x800) {
+        buf[0] = (char)(0xC0 | (cp >> 6));
+        buf[1] = (char)(0x80 | (cp & 0x3F));
+        n = 2;
+    } else if (cp < 0x10000) {
+        buf[0] = (char)(0xE0 | (cp >> 12));
+        buf[1] = (char)(0x80 | ((cp >> 6) & 0x3F));
+        buf[2] = (char)(0x80 | (cp & 0x3F));
+        n = 3;
+    } else {
+        buf[0] = (char)(0xF0 | (cp >> 18));
+        buf[1] = (char)(0x80 | ((cp >> 12) & 0x3F));
+        buf[2] = (char)(0x80 | ((cp >> 6) & 0x3F));
+        buf[3] = (char)(0x80 | (cp & 0x3F));
+        n = 4;
+    }
+    emitBytes(s, buf, n);
+}
+
+// Emite la entidad sin decodificar
+static void emitVerbatim(HtmlStripper *s, int semicolon) {
+    emitByte(s, '&');
+    emitBytes(s, s->name, s->name_len);
+    if (semicolon) emitByte(s, ';');
+}
+
+// Decodifica &#123; / &#x7B; (el ';' es opcional, como en HTML5)
+static void resolveNumeric(HtmlStripper *s, int semicolon) {
+    int hex = s->name_len > 1 && (s->name[1] == 'x' || s->name[1] == 'X');
+    size_t i = hex ? 2 : 1;
+    if (i == s->name_len) {
+        emitVerbatim(s, semicolon);
+        return;
+    }
+    uint32_t cp = 0;
+    for (; i < s->name_len; i++) {
+        char c = s->name[i];
+        uint32_t digit;
+        if (c >= '0' && c <= '9') digit = (uint32_t)(c - '0');
+        else if (hex && isxdigit((unsigned char)c)) digit = (uint32_t)(tolower((unsigned char)c) - 'a' + 10);
+        else {
+            emitVerbatim(s, semicolon);
+            return;
+        }
+        cp = cp * (hex ? 16 : 10) + digit;
+        if (cp > 0x10FFFF) cp = 0x110000;  // Evita desbordes; se reemplaza abajo
+    }
+    // Nulos, sustitutos y valores fuera de rango se convierten en U+FFFD
+    if (cp == 0 || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF)) cp = 0xFFFD;
+    emitCodePoint(s, cp);
+}
+
+static void resolveEntity(HtmlStripper *s, int semicolon) {
+    if (s->name_len == 0) {
+        emitByte(s, '&');
+        if (semicolon) emitByte(s, ';');
+        return;
+    }
+    if (s->name[0] == '#') {
+        resolveNumeric(s, semicolon);
+        return;
+    }
+    if (semicolon) {
+        s->name[s->name_len] = ';';
+        const HtmlEntity *e = lookupHtmlEntity(s->name, s->name_len + 1);
+        if (e) {
+            emitBytes(s, e->utf8, e->utf8_len);
+            return;
+        }
+    }
+    // Formas heredadas sin ';' (&copy, &amp...): prefijo más largo conocido
+    for (size_t k = s->name_len; k > 0; k--) {
+        const HtmlEntity *e = lookupHtmlEntity(s->name, k);
+        if (e) {
+            emitBytes(s, e->utf8, e->utf8_len);
+            emitBytes(s, s->name + k, s->name_len - k);
+            if (semicolon) emitByte(s, ';');
+            return;
+        }
+    }
+    emitVerbatim(s, semicolon);
+}
+
+static void endTag(HtmlStripper *s) {
+    s->name[s->name_len] = '\0';
+    if (!s->closing && (strcmp(s->name, "script") == 0 || strcmp(s->name, "style") == 0)) {
+        s->raw_end = (s->name[1] == 'c') ? "script" : "style";
+        s->match = 0;
+        s->state = ST_RAWTEXT;
+        return;
+    }
+    if (bsearch(s->name, block_tags, sizeof(block_tags) / sizeof(block_tags[0]),
+                sizeof(block_tags[0]), compareTagName)) {
+        emitSeparator(s);
+    }
+    s->state = ST_TEXT;
+}
+
+// Procesa un byte fuera del estado de texto; devuelve 0 si debe volver a
+// procesarse en el nuevo estado
+static int step(HtmlStripper *s, char c) {
+    unsigned char u = (unsigned char)c;
+    switch (s->state) {
+    case ST_TAG_OPEN:
+        if (isalpha(u)) {
+            s->closing = 0;
+            s->name[0] = (char)tolower(u);
+            s->name_len = 1;
+            s->state = ST_TAG_NAME;
+        } else if (c == '/') {
+            s->state = ST_END_TAG_OPEN;
+        } else if (c == '!') {
+            s->match = 0;
+            s->expect = NULL;
+            s->state = ST_MARKUP;
+        } else if (c == '?') {
+            s->state = ST_BOGUS;
+        } else {
+            // '<' suelto, como en "a < b"
+            emitByte(s, '<');
+            s->state = ST_TEXT;
+            return 0;
+        }
+        return 1;
+
+    case ST_END_TAG_OPEN:
+        if (isalpha(u)) {
+            s->closing = 1;
+            s->name[0] = (char)tolower(u);
+            s->name_len = 1;
+            s->state = ST_TAG_NAME;
+        } else {
+            s->state = (c == '>') ? ST_TEXT : ST_BOGUS;
+        }
+        return 1;
+
+    case ST_TAG_NAME:
+        if (c == '>') {
+            endTag(s);
+        } else if (isspace(u) || c == '/') {
+            s->quote = 0;
+            s->after_equals = 0;
+            s->state = ST_TAG;
+        } else if (s->name_len < HTML_ENTITY_MAX_NAME) {
+            s->name[s->name_len++] = (char)tolower(u);
+        }
+        return 1;
+
+    case ST_TAG:
+        if (s->quote) {
+            if (c == s->quote) s->quote = 0;
+        } else if (c == '>') {
+            endTag(s);
+        } else if (s->after_equals && (c == '"' || c == '\'')) {
+            s->quote = c;
+            s->after_equals = 0;
+        } else if (c == '=') {
+            s->after_equals = 1;
+        } else if (!isspace(u)) {
+            s->after_equals = 0;
+        }
+        return 1;
+
+    case ST_BOGUS:
+        if (c == '>') s->state = ST_TEXT;
+        return 1;
+
+    case ST_MARKUP:
+        if (!s->expect) {
+            if (c == '-') s->expect = "--";
+            else if (c == '[') s->expect = "[CDATA[";
+            else {
+                s->state = ST_BOGUS;
+                return 0;
+            }
+        }
+        if (c != s->expect[s->match]) {
+            s->state = ST_BOGUS;
+            return 0;
+        }
+        if (s->expect[++s->match] == '\0') {
+            s->state = (s->expect[0] == '-') ? ST_COMMENT : ST_CDATA;
+            s->match = 0;
+        }
+        return 1;
+
+    case ST_COMMENT:
+        if (c == '-') s->match++;
+        else if (c == '>' && s->match >= 2) s->state = ST_TEXT;
+        else s->match = 0;
+        return 1;
+
+    case ST_CDATA:
+        // Los ']' se retienen hasta saber si forman "]]>"
+        if (c == ']') {
+            s->match++;
+        } else if (c == '>' && s->match >= 2) {
+            for (size_t k = 2; k < s->match; k++) emitByte(s, ']');
+            s->match = 0;
+            s->state = ST_TEXT;
+        } else {
+            for (size_t k = 0; k < s->match; k++) emitByte(s, ']');
+            s->match = 0;
+            emitByte(s, c);
+        }
+        return 1;
+
+    case ST_RAWTEXT: {
+        // Busca "</script" o "</style" sin distinguir mayúsculas
+        char expected = (s->match == 0) ? '<' : (s->match == 1) ? '/' : s->raw_end[s->match - 2];
+        if ((char)tolower(u) == expected) {
+            s->match++;
+            if (s->match == strlen(s->raw_end) + 2) s->state = ST_RAWTEXT_END;
+        } else {
+            s->match = (c == '<') ? 1 : 0;
+        }
+        return 1;
+    }
+
+    case ST_RAWTEXT_END:
+        if (c == '>') {
+            s->state = ST_TEXT;
+        } else if (isspace(u) || c == '/') {
+            s->closing = 1;
+            s->name_len = 0;
+            s->quote = 0;
+            s->after_equals = 0;
+            s->state = ST_TAG;
+        } else {
+            // Era otro nombre ("</scripts"): sigue el contenido crudo
+            s->match = 0;
+            s->state = ST_RAWTEXT;
+            return 0;
+        }
+        return 1;
+
+    case ST_ENTITY: {
+        int allowed;
+        if (s->name_len == 0) allowed = isalnum(u) || c == '#';
+        else if (s->name_len == 1 && s->name[0] == '#') allowed = isdigit(u) || c == 'x' || c == 'X';
+        else allowed = isalnum(u);
+        if (allowed && s->name_len < HTML_ENTITY_MAX_NAME - 1) {
+            s->name[s->name_len++] = c;
+            return 1;
+        }
+        s->state = ST_TEXT;
+        if (c == ';') {
+            resolveEntity(s, 1);
+            return 1;
+        }
+        resolveEntity(s, 0);
+        return 0;
+    }
+    }
+    return 1;
+}
+
+void feedHTMLStripper(HtmlStripper *s, const char *data, size_t len) {
+    size_t i = 0;
+    while (i < len) {
+        if (s->state == ST_TEXT) {
+            // Camino rápido: copia el tramo hasta el siguiente '<' o '&'
+            size_t start = i;
+            while (i < len && data[i] != '<' && data[i] != '&') i++;
+            emitBytes(s, data + start, i - start);
+            if (i == len) break;
+            s->state = (data[i] == '<') ? ST_TAG_OPEN : ST_ENTITY;
+            s->name_len = 0;
+            i++;
+            continue;
+        }
+        if (step(s, data[i])) i++;
+    }
+}
+
+void finishHTMLStripper(HtmlStripper *s) {
+    if (s->state == ST_ENTITY) resolveEntity(s, 0);
+    else if (s->state == ST_TAG_OPEN) emitByte(s, '<');
+    else if (s->state == ST_CDATA) {
+        for (size_t k = 0; k < s->match; k++) emitByte(s, ']');
+    }
+    s->state = ST_TEXT;
+    flushOutput(s);
+}
+
+int stripHTMLFile(const char *path, HtmlTextSink sink, void *ctx) {
+    FILE *fp = fopen(path, "rb");
+    if (!fp) {
+        perror("stripHTMLFile: no se pudo abrir el archivo");
+        return -1;
+    }
+    HtmlStripper stripper;
+    initHTMLStripper(&stripper, sink, ctx);
+
+    char chunk[65536];
+    size_t n;
+    int first = 1;
+    while ((n = fread(chunk, 1, sizeof(chunk), fp)) > 0) {
+        const char *data = chunk;
+        // Omite el BOM UTF-8, igual que loadFile
+        if (first && n >= 3 && (unsigned char)chunk[0] == 0xEF &&
+            (unsigned char)chunk[1] == 0xBB && (unsigned char)chunk[2] == 0xBF) {
+            data += 3;
+            n -= 3;
+        }
+        first = 0;
+        feedHTMLStripper(&stripper, data, n);
+    }
+    int failed = ferror(fp);
+    fclose(fp);
+    finishHTMLStripper(&stripper);
+    if (failed) {
+        fprintf(stderr, "stripHTMLFile: error de lectura en %s\n", path);
+        return -1;
+    }
+    return 0;
+}
@@ -0,0 +1,304 @@
+// Diego Galindo, Francisco Mercado
+#include "index_grep.h"
+#include "index_operations.h"
+#include "indexer.h"
+#include "persistence.h"
+#include "parallel.h"
+#include "utils.h"
+#include "KMP.h"
+#include "boyer_moore.h"
+#include "shift_and.h"
+#include "trigram_index.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+// Mismos delimitadores que usa tokenize()
+#define GREP_DELIMITERS " \t\n\r\f\v.,;:!?()[]{}\"'"
+
+typedef enum {
+    GREP_KMP,
+    GREP_KMP_DFA,
+    GREP_BM,
+    GREP_SHIFTAND
+} GrepAlgorithm;
+
+// Coincidencias de un documento (offsets en bytes)
+typedef struct {
+    size_t *offsets;
+    size_t count;
+    size_t capacity;
+} GrepDocResult;
+
+typedef struct {
+    GrepAlgorithm alg;
+    const KmpPattern *kmp;
+    const KmpDfaPattern *dfa;
+    const ShiftAndPattern *sa;
+    const BMPattern *bm;
+    DocumentInfo **docs;      // Documentos candidatos
+    GrepDocResult *results;   // Un resultado por candidato
+} GrepJob;
+
+// Contexto del callback de coincidencias
+typedef struct {
+    GrepDocResult *result;
+    const char *text;
+    const char *cursor;       // Solo bm: posición en bytes del code-point cursor_cp
+    size_t cursor_cp;
+} GrepMatchCtx;
+
+static void addOffset(GrepDocResult *result, size_t offset) {
+    if (result->count >= result->capacity) {
+        size_t new_cap = result->capacity ? result->capacity * 2 : 16;
+        size_t *grown = realloc(result->offsets, new_cap * sizeof(size_t));
+        if (!grown) return;
+        result->offsets = grown;
+        result->capacity = new_cap;
+    }
+    result->offsets[result->count++] = offset;
+}
+
+static void onByteMatch(size_t pos, void *ctx) {
+    GrepMatchCtx *m = ctx;
+    addOffset(m->result, pos);
+}
+
+// bm reporta code-points; las coincidencias llegan en orden creciente, así que
+// basta con avanzar un cursor para traducirlas a bytes
+static void onCodePointMatch(size_t pos, void *ctx) {
+    GrepMatchCtx *m = ctx;
+    m->cursor = advanceUTF8(m->cursor, pos - m->cursor_cp);
+    m->cursor_cp = pos;
+    addOffset(m->result, (size_t)(m->cursor - m->text));
+}
+
+static void grepDocument(size_t i, void *arg) {
+    GrepJob *job = arg;
+    char *text = loadFile(job->docs[i]->filename);
+    if (!text) return;
+
+    GrepMatchCtx ctx = { &job->results[i], text, text, 0 };
+    switch (job->alg) {
+        case GREP_KMP:
+            execKMP(job->kmp, text, strlen(text), SEARCH_ALL, onByteMatch, &ctx);
+            break;
+        case GREP_KMP_DFA:
+            execKMPDFA(job->dfa, text, strlen(text), SEARCH_ALL, onByteMatch, &ctx);
+            break;
+        case GREP_SHIFTAND:
+            execShiftAnd(job->sa, text, strlen(text), SEARCH_ALL, onByteMatch, &ctx);
+            break;
+        case GREP_BM: {
+            size_t n;
+            uint32_t *cps = decodeUTF8(text, &n);
+            if (cps) {
+                execBM(job->bm, cps, n, SEARCH_ALL, onCodePointMatch, &ctx);
+                free(cps);
+            }
+            break;
+        }
+    }
+    free(text);
+}
+
+// Palabras completas del patrón: las que tienen un delimitador a ambos lados
+// dentro del propio patrón. Un documento que contenga el patrón debe contener
+// esas palabras como tokens, así que deben estar en su vocabulario.
+static char** requiredTerms(const char* pattern, size_t* count) {
+    size_t len = strlen(pattern);
+    char** terms = malloc((len / 2 + 1) * sizeof(char*));
+    *count = 0;
+    if (!terms) return NULL;
+
+    size_t i = 0;
+    while (i < len) {
+        size_t start = i + strspn(pattern + i, GREP_DELIMITERS);
+        size_t end = start + strcspn(pattern + start, GREP_DELIMITERS);
+        if (start >= len) break;
+        i = end;
+        if (start == 0 || end >= len) continue;
+
+        // Mismo filtro que tokenize(): al menos 2 bytes y una letra
+        size_t word_len = end - start;
+        int has_letter = 0;
+        for (size_t k = start; k < end; k++) {
+            if (isalpha((unsigned char)pattern[k])) {
+                has_letter = 1;
+                break;
+            }
+        }
+        if (word_len < 2 || !has_letter) continue;
+
+        char* term = malloc(word_len + 1);
+        if (!term) continue;
+        memcpy(term, pattern + start, word_len);
+        term[word_len] = '\0';
+        convertir_a_minusculas(term);
+        limpiar_palabra(term);
+        if (term[0] == '\0') {
+            free(term);
+            continue;
+        }
+        terms[(*count)++] = term;
+    }
+    return terms;
+}
+
+// Marca en candidate[doc_id] los documentos que contienen todos los términos
+// obligatorios; devuelve -1 si no hay términos (todos son candidatos)
+static int filterByVocabulary(InvertedIndex* index, const char* pattern,
+                              unsigned char* candidate, size_t id_limit) {
+    size_t term_count;
+    char** terms = requiredTerms(pattern, &term_count);
+    if (!terms || term_count == 0) {
+        free(terms);
+        return -1;
+    }
+
+    uint32_t* hits = calloc(id_limit, sizeof(uint32_t));
+    if (!hits) {
+        freeTokens(terms, term_count);
+        return -1;
+    }
+
+    // Las palabras vacías no están en el índice: no filtran nada
+    size_t required = 0;
+    for (size_t t = 0; t < term_count; t++) {
+        if (isStopWord(index->analysis.stopwords, terms[t])) continue;
+        required++;
+        for (PostingNode* node = searchTerm(index, terms[t]); node; node = node->next) {
+            if (node->posting.doc_id < id_limit) hits[node->posting.doc_id]++;
+        }
+    }
+    for (size_t id = 0; id < id_limit; id++) {
+        candidate[id] = (hits[id] == required);
+    }
+
+    free(hits);
+    freeTokens(terms, term_count);
+    return 0;
+}
+
+int grepIndex(const char* index_file, const char* alg, const char* pattern) {
+    GrepJob job = {0};
+    if (strcmp(alg, "kmp") == 0) {
+        job.alg = GREP_KMP;
+    } else if (strcmp(alg, "kmp_dfa") == 0) {
+        job.alg = GREP_KMP_DFA;
+    } else if (strcmp(alg, "bm") == 0) {
+        job.alg = GREP_BM;
+    } else if (strcmp(alg, "shiftand") == 0) {
+        job.alg = GREP_SHIFTAND;
+    } else {
+        fprintf(stderr, "Algoritmo no reconocido: %s (opciones: kmp, kmp_dfa, bm, shiftand)\n", alg);
+        return EXIT_FAILURE;
+    }
+
+    KmpPattern* kmp = NULL;
+    KmpDfaPattern* dfa = NULL;
+    ShiftAndPattern* sa = NULL;
+    BMPattern* bm = NULL;
+    if (job.alg == GREP_KMP) job.kmp = kmp = compileKMP(pattern);
+    else if (job.alg == GREP_KMP_DFA) job.dfa = dfa = compileKMPDFA(pattern);
+    else if (job.alg == GREP_SHIFTAND) job.sa = sa = compileShiftAnd(pattern);
+    else job.bm = bm = compileBM(pattern);
+
+    if (!kmp && !dfa && !sa && !bm) {
+        fprintf(stderr, "Error: No se pudo compilar el patrón \"%s\"\n", pattern);
+        return EXIT_FAILURE;
+    }
+
+    char* full_index_path = buildIndexPath(index_file);
+    if (!full_index_path) {
+        fprintf(stderr, "Error: No se pudo construir la ruta del índice\n");
+        freeKMP(kmp); freeKMPDFA(dfa); freeShiftAnd(sa); freeBM(bm);
+        return EXIT_FAILURE;
+    }
+
+    InvertedIndex* index = NULL;
+    DocumentCollection* collection = NULL;
+    if (loadIndexFromBinary(&index, &collection, full_index_path) != 0) {
+        fprintf(stderr, "Error al cargar el índice desde: %s\n", full_index_path);
+        free(full_index_path);
+        freeKMP(kmp); freeKMPDFA(dfa); freeShiftAnd(sa); freeBM(bm);
+        return EXIT_FAILURE;
+    }
+
+    // Documentos candidatos según el vocabulario del índice y, si el índice
+    // tiene trigramas, según los trigramas del patrón
+    size_t id_limit = (size_t)index->next_doc_id + 1;
+    unsigned char* candidate = malloc(id_limit);
+    unsigned char* trigram_candidate = malloc(id_limit);
+    job.docs = malloc((collection->count + 1) * sizeof(DocumentInfo*));
+    if (!candidate || !trigram_candidate || !job.docs) {
+        fprintf(stderr, "Error de memoria\n");
+        free(full_index_path);
+        free(candidate);
+        free(trigram_candidate);
+        free(job.docs);
+        destroyIndex(index);
+        destroyDocumentCollection(collection);
+        freeKMP(kmp); freeKMPDFA(dfa); freeShiftAnd(sa); freeBM(bm);
+        return EXIT_FAILURE;
+    }
+    int filtered = filterByVocabulary(index, pattern, candidate, id_limit) == 0;
+    TrigramIndex* trigrams = openTrigramIndex(full_index_path);
+    int trigram_filtered = trigramCandidates(trigrams, pattern, trigram_candidate, id_limit) == 0;
+    closeTrigramIndex(trigrams);
+    free(full_index_path);
+
+    size_t doc_count = 0, vocabulary_skipped = 0, trigram_skipped = 0;
+    for (size_t i = 0; i < collection->count; i++) {
+        uint32_t id = collection->docs[i].doc_id;
+        // Los HTML se indexan sin marcado ni entidades, pero grep recorre el
+        // archivo crudo: el vocabulario no sirve para descartarlos (los
+        // trigramas sí, porque salen del archivo crudo)
+        if (filtered && !isHTMLFile(collection->docs[i].filename) &&
+            !(id < id_limit && candidate[id])) {
+            vocabulary_skipped++;
+        } else if (trigram_filtered && !(id < id_limit && trigram_candidate[id])) {
+            trigram_skipped++;
+        } else {
+            job.docs[doc_count++] = &collection->docs[i];
+        }
+    }
+    free(candidate);
+    free(trigram_candidate);
+
+    job.results = calloc(doc_count + 1, sizeof(GrepDocResult));
+    if (!job.results) {
+        fprintf(stderr, "Error de memoria\n");
+        free(job.docs);
+        destroyIndex(index);
+        destroyDocumentCollection(collection);
+        freeKMP(kmp); freeKMPDFA(dfa); freeShiftAnd(sa); freeBM(bm);
+        return EXIT_FAILURE;
+    }
+
+    parallelFor(doc_count, defaultThreadCount(), grepDocument, &job);
+
+    // Resultados en el orden de la colección
+    size_t total = 0, docs_with_matches = 0;
+    for (size_t i = 0; i < doc_count; i++) {
+        GrepDocResult* r = &job.results[i];
+        for (size_t k = 0; k < r->count; k++) {
+            printf("%s:%zu\n", job.docs[i]->filename, r->offsets[k]);
+        }
+        total += r->count;
+        if (r->count > 0) docs_with_matches++;
+        free(r->offsets);
+    }
+
+    printf("\n%zu coincidencias en %zu documentos (%zu examinados, %zu descartados por vocabulario, "
+           "%zu por trigramas)\n",
+           total, docs_with_matches, doc_count, vocabulary_skipped, trigram_skipped);
+
+    free(job.results);
+    free(job.docs);
+    destroyIndex(index);
+    destroyDocumentCollection(collection);
+    freeKMP(kmp); freeKMPDFA(dfa); freeShiftAnd(sa); freeBM(bm);
+    return EXIT_SUCCESS;
+}
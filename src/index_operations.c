@@ -1,16 +1,24 @@
 // Diego Galindo, Francisco Mercado
+#define _POSIX_C_SOURCE 200809L  // open_memstream
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <dirent.h>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <time.h>
+#include <unistd.h>
 #include "index_operations.h"
 #include "search_algorithms.h"
 #include "utils.h"
 #include "indexer.h"
 #include "persistence.h"
+#include "segments.h"
 #include "similarity.h"
+#include "index_grep.h"
+#include "batch.h"
+#include "query_cache.h"
+#include "trigram_index.h"
 
 // Definir DT_REG si no está disponible
 #ifndef DT_REG
@@ -84,20 +92,31 @@ char* buildDocsPath(const char* input_path) {
 void printIndexUsage(const char* program_name) {
     fprintf(stderr,
         "Gestión de índices y análisis de similitud:\n"
-        "  %s index create <directorio> [archivo_indice.idx]\n"
-        "  %s index search <archivo_indice.idx> <término>\n"
-        "  %s index info <archivo_indice.idx>\n"
+        "  %s index create <directorio> [archivo_indice.idx] [--stopwords es,en] [--stem es|en] [--trigrams]\n"
+        "  %s index search <archivo_indice.idx> <término> [--cache]\n"
+        "  %s index search <archivo_indice.idx> --batch <consultas.txt> [--format jsonl|tsv] [--threads N]\n"
+        "  %s index info <archivo_indice.idx> [--verify]\n"
         "  %s index export <archivo_indice.idx> <archivo_salida.txt>\n"
         "  %s index backup <archivo_indice.idx> <directorio_backup>\n"
         "  %s index similarity <índice> <doc_id1> <doc_id2>\n"
-        "  %s index similarity-indexed <índice> <doc_id> [top_k]\n"
+        "  %s index similarity-indexed <índice> <doc_id> [top_k] [--cache]\n"
+        "  %s index vector <índice> <doc_id> [top_n]\n"
+        "  %s index terms <índice> <prefijo*|patrón con * y ?>\n"
+        "  %s index terms <índice> --range <desde> <hasta>\n"
+        "  %s index grep <índice> <kmp|kmp_dfa|bm|shiftand> <patrón>\n"
+        "  %s index update <índice> <directorio_o_archivo>\n"
+        "  %s index remove <índice> <archivo_o_directorio>\n"
+        "  %s index merge <índice>\n"
         "\n"
         "Ejemplos:\n"
         "  %s index similarity index.idx 1 5\n"
-        "  %s index similarity-indexed index.idx 3 10\n",
+        "  %s index similarity-indexed index.idx 3 10\n"
+        "  %s index terms index.idx 'algorit*'\n",
         program_name, program_name, program_name, 
         program_name, program_name, program_name, program_name,
-        program_name, program_name
+        program_name, program_name, program_name, program_name, program_name,
+        program_name, program_name, program_name, program_name, program_name,
+        program_name
     );
 }
 
@@ -119,7 +138,21 @@ int isTextFile(const char* filename) {
     return 0;
 }
 
-int indexDirectory(const char* dir_path, const char* index_file) {
+// ID de creación: distinto en cada "index create" aunque se repita la generación
+static uint32_t newBuildId(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_REALTIME, &now);
+    uint64_t x = ((uint64_t)now.tv_sec << 32) ^ (uint64_t)now.tv_nsec ^ ((uint64_t)getpid() << 16);
+    // Mezcla de splitmix64
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    x ^= x >> 31;
+    uint32_t id = (uint32_t)(x ^ (x >> 32));
+    return id ? id : 1;
+}
+
+int indexDirectory(const char* dir_path, const char* index_file, const AnalysisConfig* analysis,
+                   int build_trigrams) {
     printf("Creando índice desde directorio: %s\n", dir_path);
     
     // Construir ruta completa para el archivo de índice y documentación
@@ -141,12 +174,22 @@ int indexDirectory(const char* dir_path, const char* index_file) {
         free(full_index_path);
         return EXIT_FAILURE;
     }
+    if (analysis) index->analysis = *analysis;
+    
+    // Trigramas del contenido crudo de cada archivo (para index grep)
+    TrigramBuilder trigrams = {0};
+    int trigrams_ok = 0;
+    if (build_trigrams) {
+        trigrams_ok = initTrigramBuilder(&trigrams) == 0;
+        if (!trigrams_ok) fprintf(stderr, "Advertencia: sin memoria para el índice de trigramas\n");
+    }
     
     DIR* dir = opendir(dir_path);
     if (!dir) {
         perror("Error al abrir directorio");
         destroyIndex(index);
         destroyDocumentCollection(collection);
+        freeTrigramBuilder(&trigrams);
         free(full_index_path);
         return EXIT_FAILURE;
     }
@@ -161,6 +204,18 @@ int indexDirectory(const char* dir_path, const char* index_file) {
             
             printf("Procesando: %s\n", filepath);
             
+            // HTML: se quita el marcado en streaming mientras se tokeniza
+            if (isHTMLFile(entry->d_name)) {
+                uint32_t doc_id = addHTMLDocument(index, collection, filepath, entry->d_name);
+                if (doc_id != 0) {
+                    files_processed++;
+                    if (trigrams_ok) addTrigramFile(&trigrams, doc_id, filepath);
+                } else {
+                    fprintf(stderr, "Advertencia: No se pudo procesar %s\n", filepath);
+                }
+                continue;
+            }
+            
             FILE* file = fopen(filepath, "r");
             if (!file) {
                 fprintf(stderr, "Advertencia: No se pudo abrir %s\n", filepath);
@@ -183,6 +238,7 @@ int indexDirectory(const char* dir_path, const char* index_file) {
             fclose(file);
             
             uint32_t doc_id = addDocument(index, collection, filepath, content, entry->d_name);
+            if (doc_id != 0 && trigrams_ok) addTrigramText(&trigrams, doc_id, content, strlen(content));
             free(content);
             
             if (doc_id != 0) {
@@ -199,6 +255,7 @@ int indexDirectory(const char* dir_path, const char* index_file) {
         printf("No se encontraron archivos de texto para indexar\n");
         destroyIndex(index);
         destroyDocumentCollection(collection);
+        freeTrigramBuilder(&trigrams);
         free(full_index_path);
         return EXIT_FAILURE;
     }
@@ -206,14 +263,27 @@ int indexDirectory(const char* dir_path, const char* index_file) {
     printf("\nArchivos procesados: %d\n", files_processed);
     printf("Términos únicos: %zu\n", index->size);
     
-    // Guardar índice usando la ruta completa
+    // Guardar índice usando la ruta completa; al recrearlo se avanza la
+    // generación para invalidar las cachés del índice anterior y se le da un
+    // ID de creación nuevo (la generación vuelve a 1 si se borró el .idx)
+    index->generation = indexGeneration(full_index_path) + 1;
+    index->build_id = newBuildId();
     if (saveIndexToBinary(index, collection, full_index_path) != 0) {
         fprintf(stderr, "Error al guardar el índice\n");
         destroyIndex(index);
         destroyDocumentCollection(collection);
+        freeTrigramBuilder(&trigrams);
         free(full_index_path);
         return EXIT_FAILURE;
     }
+    // El índice recién creado reemplaza a los segmentos anteriores, a sus
+    // trigramas (los doc IDs vuelven a empezar) y a su caché de consultas
+    clearIndexSegments(full_index_path);
+    removeQueryCache(full_index_path);
+    if (!trigrams_ok || saveTrigramIndex(&trigrams, full_index_path) != 0) {
+        removeTrigramIndex(full_index_path);
+    }
+    freeTrigramBuilder(&trigrams);
     
     destroyIndex(index);
     destroyDocumentCollection(collection);
@@ -224,7 +294,97 @@ int indexDirectory(const char* dir_path, const char* index_file) {
     return EXIT_SUCCESS;
 }
 
-int searchInIndex(const char* index_file, const char* term) {
+// Encabezado de "index search" con el término tal como lo escribió el usuario;
+// va fuera de la caché, cuya clave es el término normalizado
+static void printSearchHeader(const char* term, const char* normalized_term, int found) {
+    if (!found) {
+        printf("No se encontraron resultados para: \"%s\"\n", term);
+        return;
+    }
+    printf("=== Resultados de búsqueda ===\n");
+    printf("Término: \"%s\" (normalizado: \"%s\")\n", term, normalized_term);
+    printf("Documentos encontrados:\n\n");
+}
+
+// Escribe las filas de resultados de "index search" (lo que se guarda en caché;
+// vacío si no hubo resultados)
+static void renderSearchResults(FILE* out, PostingNode* results, DocumentCollection* collection) {
+    PostingNode* current = results;
+    int doc_count = 0;
+    
+    while (current) {
+        doc_count++;
+        fprintf(out, "Documento %d:\n", doc_count);
+        
+        // Access PostingList members directly (posting is not a pointer)
+        fprintf(out, "  ID: %u\n", current->posting.doc_id);
+        
+        // Buscar información del documento en la colección
+        DocumentInfo* doc = getDocumentById(collection, current->posting.doc_id);
+        if (doc) {
+            fprintf(out, "  Archivo: %s\n", doc->filename);
+            if (doc->title) {
+                fprintf(out, "  Título: %s\n", doc->title);
+            }
+        }
+        
+        fprintf(out, "  Ocurrencias: %zu\n", current->posting.position_count);
+        
+        fprintf(out, "  Posiciones: ");
+        for (size_t j = 0; j < current->posting.position_count && j < 10; j++) {
+            if (current->posting.positions) {
+                fprintf(out, "%zu", current->posting.positions[j]);
+                if (j < current->posting.position_count - 1 && j < 9) fprintf(out, ", ");
+            }
+        }
+        if (current->posting.position_count > 10) {
+            fprintf(out, " ... (%zu más)", current->posting.position_count - 10);
+        }
+        fprintf(out, "\n\n");
+        
+        current = current->next;
+    }
+}
+
+// Caché persistente de la consulta (NULL si no se pidió --cache). La
+// generación se toma del disco sin cargar el índice.
+static QueryCache* openQueryCache(const char* full_index_path, int use_cache) {
+    if (!use_cache) return NULL;
+    IndexFileHeader header;
+    uint32_t build_id = readIndexHeader(full_index_path, &header) == 0 ? header.build_id : 0;
+    QueryCache* cache = createQueryCache(QUERY_CACHE_MAX_ENTRIES, QUERY_CACHE_MAX_BYTES,
+                                         indexGeneration(full_index_path), build_id);
+    if (cache) loadQueryCache(cache, full_index_path);
+    return cache;
+}
+
+// Resultado guardado (liberar con free) o NULL; avisa del acierto
+static char* fetchCachedResult(QueryCache* cache, const char* key, size_t* len) {
+    char* cached = queryCacheGet(cache, key, len);
+    if (cached) printf("(Resultado desde caché, generación %u)\n", cache->generation);
+    return cached;
+}
+
+// Imprime el resultado guardado, si lo hay; 1 si hubo acierto
+static int printCachedResult(QueryCache* cache, const char* key) {
+    size_t len;
+    char* cached = fetchCachedResult(cache, key, &len);
+    if (!cached) return 0;
+    fwrite(cached, 1, len, stdout);
+    free(cached);
+    return 1;
+}
+
+// Imprime el resultado recién calculado y lo guarda en la caché
+static void storeResult(QueryCache* cache, const char* full_index_path, const char* key,
+                        const char* result, size_t len) {
+    fwrite(result, 1, len, stdout);
+    if (!cache) return;
+    queryCachePut(cache, key, result, len);
+    saveQueryCache(cache, full_index_path);
+}
+
+int searchInIndex(const char* index_file, const char* term, int use_cache) {
     // Construir ruta completa para buscar el archivo de índice
     char* full_index_path = buildIndexPath(index_file);
     if (!full_index_path) {
@@ -232,6 +392,37 @@ int searchInIndex(const char* index_file, const char* term) {
         return EXIT_FAILURE;
     }
     
+    // Normalizar término de búsqueda
+    char* normalized_term = malloc(strlen(term) + 1);
+    char* key = malloc(strlen(term) + 16);
+    if (!normalized_term || !key) {
+        fprintf(stderr, "Error de memoria\n");
+        free(normalized_term);
+        free(key);
+        free(full_index_path);
+        return EXIT_FAILURE;
+    }
+    
+    strcpy(normalized_term, term);
+    convertir_a_minusculas(normalized_term);
+    limpiar_palabra(normalized_term);
+    sprintf(key, "search\t%s", normalized_term);
+    
+    // Con un acierto en caché no hace falta cargar el índice
+    QueryCache* cache = openQueryCache(full_index_path, use_cache);
+    size_t cached_len;
+    char* cached = cache ? fetchCachedResult(cache, key, &cached_len) : NULL;
+    if (cached) {
+        printSearchHeader(term, normalized_term, cached_len > 0);
+        fwrite(cached, 1, cached_len, stdout);
+        free(cached);
+        destroyQueryCache(cache);
+        free(key);
+        free(normalized_term);
+        free(full_index_path);
+        return EXIT_SUCCESS;
+    }
+    
     InvertedIndex* index = NULL;
     DocumentCollection* collection = NULL;
     
@@ -239,80 +430,111 @@ int searchInIndex(const char* index_file, const char* term) {
     
     if (loadIndexFromBinary(&index, &collection, full_index_path) != 0) {
         fprintf(stderr, "Error al cargar el índice desde: %s\n", full_index_path);
+        destroyQueryCache(cache);
+        free(key);
+        free(normalized_term);
         free(full_index_path);
         return EXIT_FAILURE;
     }
     
+    printf("Buscando término: \"%s\"\n\n", term);
+    
+    // Buscar en el índice
+    PostingNode* results = searchTerm(index, normalized_term);
+    
+    char* rendered = NULL;
+    size_t rendered_len = 0;
+    FILE* out = open_memstream(&rendered, &rendered_len);
+    if (out) {
+        renderSearchResults(out, results, collection);
+        fclose(out);
+        printSearchHeader(term, normalized_term, results != NULL);
+        storeResult(cache, full_index_path, key, rendered, rendered_len);
+        free(rendered);
+    }
+    
+    destroyQueryCache(cache);
+    free(key);
+    free(normalized_term);
     free(full_index_path);
+    destroyIndex(index);
+    destroyDocumentCollection(collection);
     
-    printf("Buscando término: \"%s\"\n\n", term);
+    return EXIT_SUCCESS;
+}
+
+int searchTermsInIndex(const char* index_file, const TermQuery* query) {
+    char* full_index_path = buildIndexPath(index_file);
+    if (!full_index_path) {
+        fprintf(stderr, "Error: No se pudo construir la ruta del índice\n");
+        return EXIT_FAILURE;
+    }
     
-    // Normalizar término de búsqueda
-    char* normalized_term = malloc(strlen(term) + 1);
-    if (!normalized_term) {
+    // Solo se leen del disco los términos de la consulta
+    InvertedIndex* index = NULL;
+    DocumentCollection* collection = NULL;
+    if (loadIndexTerms(full_index_path, query, &index, &collection) != 0) {
+        fprintf(stderr, "Error al cargar el índice desde: %s\n", full_index_path);
+        free(full_index_path);
+        return EXIT_FAILURE;
+    }
+    
+    IndexEntry** sorted = malloc((index->size + 1) * sizeof(IndexEntry*));
+    unsigned char* seen = calloc((size_t)index->next_doc_id + 1, 1);
+    if (!sorted || !seen) {
         fprintf(stderr, "Error de memoria\n");
+        free(sorted);
+        free(seen);
         destroyIndex(index);
         destroyDocumentCollection(collection);
+        free(full_index_path);
         return EXIT_FAILURE;
     }
+    size_t count = 0;
+    for (size_t i = 0; i < index->capacity; i++) {
+        if (index->entries[i].term && index->entries[i].head) sorted[count++] = &index->entries[i];
+    }
+    qsort(sorted, count, sizeof(IndexEntry*), compareIndexEntries);
     
-    strcpy(normalized_term, term);
-    convertir_a_minusculas(normalized_term);
-    limpiar_palabra(normalized_term);
+    const char* kinds[] = { "prefijo", "rango", "comodines" };
+    printf("=== Términos del diccionario ===\n");
+    if (query->kind == TERM_QUERY_RANGE) {
+        printf("Consulta: [\"%s\", \"%s\"] (%s)\n", query->pattern,
+               query->high[0] ? query->high : "...", kinds[query->kind]);
+    } else {
+        printf("Consulta: \"%s\" (%s)\n", query->pattern, kinds[query->kind]);
+    }
+    printf("Términos encontrados: %zu\n\n", count);
     
-    // Buscar en el índice
-    PostingNode* results = searchTerm(index, normalized_term);
+    for (size_t i = 0; i < count; i++) {
+        printf("  %s (df=%u): ", sorted[i]->term, sorted[i]->doc_frequency);
+        size_t shown = 0;
+        for (PostingNode* p = sorted[i]->head; p; p = p->next) {
+            if (p->posting.doc_id <= index->next_doc_id) seen[p->posting.doc_id] = 1;
+            if (shown < 10) printf(shown ? ", %u" : "%u", p->posting.doc_id);
+            else if (shown == 10) printf(", ...");
+            shown++;
+        }
+        printf("\n");
+    }
     
-    if (!results) {
-        printf("No se encontraron resultados para: \"%s\"\n", term);
-    } else {
-        printf("=== Resultados de búsqueda ===\n");
-        printf("Término: \"%s\" (normalizado: \"%s\")\n", term, normalized_term);
-        printf("Documentos encontrados:\n\n");
-        
-        PostingNode* current = results;
-        int doc_count = 0;
-        
-        while (current) {
-            doc_count++;
-            printf("Documento %d:\n", doc_count);
-            
-            // Access PostingList members directly (posting is not a pointer)
-            printf("  ID: %u\n", current->posting.doc_id);
-            
-            // Buscar información del documento en la colección
-            for (size_t i = 0; i < collection->count; i++) {
-                if (collection->docs && collection->docs[i].doc_id == current->posting.doc_id) {
-                    printf("  Archivo: %s\n", collection->docs[i].filename);
-                    if (collection->docs[i].title) {
-                        printf("  Título: %s\n", collection->docs[i].title);
-                    }
-                    break;
-                }
-            }
-            
-            printf("  Ocurrencias: %zu\n", current->posting.position_count);
-            
-            printf("  Posiciones: ");
-            for (size_t j = 0; j < current->posting.position_count && j < 10; j++) {
-                if (current->posting.positions) {
-                    printf("%zu", current->posting.positions[j]);
-                    if (j < current->posting.position_count - 1 && j < 9) printf(", ");
-                }
-            }
-            if (current->posting.position_count > 10) {
-                printf(" ... (%zu más)", current->posting.position_count - 10);
-            }
-            printf("\n\n");
-            
-            current = current->next;
+    size_t docs = 0;
+    for (size_t i = 0; i < collection->count; i++) {
+        if (collection->docs[i].doc_id <= index->next_doc_id && seen[collection->docs[i].doc_id]) docs++;
+    }
+    printf("\nDocumentos con algún término: %zu\n", docs);
+    for (size_t i = 0; i < collection->count; i++) {
+        DocumentInfo* doc = &collection->docs[i];
+        if (doc->doc_id <= index->next_doc_id && seen[doc->doc_id]) {
+            printf("  [ID: %u] %s\n", doc->doc_id, doc->filename);
         }
     }
     
-    free(normalized_term);
+    free(sorted);
+    free(seen);
     destroyIndex(index);
     destroyDocumentCollection(collection);
-    
+    free(full_index_path);
     return EXIT_SUCCESS;
 }
 
@@ -332,9 +554,34 @@ int handleIndexCommands(int argc, char* argv[]) {
         }
         
         const char* directory = argv[3];
-        const char* index_file = (argc >= 5) ? argv[4] : "index.idx";
+        const char* index_file = "index.idx";
+        int i = 4;
+        if (i < argc && strncmp(argv[i], "--", 2) != 0) index_file = argv[i++];
         
-        return indexDirectory(directory, index_file);
+        // La cadena de análisis queda en el header del índice; los trigramas
+        // van aparte, en <índice>.trigrams
+        AnalysisConfig analysis = {0};
+        int build_trigrams = 0;
+        for (; i < argc; i++) {
+            uint32_t mask;
+            if (strcmp(argv[i], "--trigrams") == 0) {
+                build_trigrams = 1;
+            } else if (strcmp(argv[i], "--stopwords") == 0 && i + 1 < argc &&
+                parseAnalysisLanguages(argv[i + 1], &mask) == 0) {
+                analysis.stopwords = mask;
+                i++;
+            } else if (strcmp(argv[i], "--stem") == 0 && i + 1 < argc &&
+                       parseAnalysisLanguages(argv[i + 1], &mask) == 0 &&
+                       (mask == ANALYSIS_LANG_ES || mask == ANALYSIS_LANG_EN)) {
+                analysis.stemmer = mask;
+                i++;
+            } else {
+                fprintf(stderr, "Opción no válida: %s (--stopwords es,en | --stem es|en | --trigrams)\n", argv[i]);
+                return EXIT_FAILURE;
+            }
+        }
+        
+        return indexDirectory(directory, index_file, &analysis, build_trigrams);
         
     } else if (strcmp(command, "search") == 0) {
         if (argc < 5) {
@@ -346,7 +593,27 @@ int handleIndexCommands(int argc, char* argv[]) {
         const char* index_file = argv[3];
         const char* term = argv[4];
         
-        return searchInIndex(index_file, term);
+        // --batch: un término por línea, con el índice cargado una vez
+        if (strcmp(term, "--batch") == 0) {
+            if (argc < 6) {
+                fprintf(stderr, "Error: Falta el archivo de consultas\n");
+                return EXIT_FAILURE;
+            }
+            BatchFormat format = BATCH_JSONL;
+            int threads = 0;
+            for (int i = 6; i + 1 < argc; i += 2) {
+                if (strcmp(argv[i], "--format") == 0 && parseBatchFormat(argv[i + 1], &format) != 0) {
+                    fprintf(stderr, "Formato no reconocido: %s (opciones: jsonl, tsv)\n", argv[i + 1]);
+                    return EXIT_FAILURE;
+                } else if (strcmp(argv[i], "--threads") == 0) {
+                    threads = atoi(argv[i + 1]);
+                }
+            }
+            return searchIndexBatch(index_file, argv[5], format, threads);
+        }
+        
+        int use_cache = argc >= 6 && strcmp(argv[5], "--cache") == 0;
+        return searchInIndex(index_file, term, use_cache);
         
     } else if (strcmp(command, "info") == 0) {
         if (argc < 4) {
@@ -366,7 +633,20 @@ int handleIndexCommands(int argc, char* argv[]) {
         int result = EXIT_FAILURE;
         if (validateIndexFile(full_index_path) == 0) {
             printIndexFileInfo(full_index_path);
+            printSegmentInfo(full_index_path);
+            TrigramIndex* trigrams = openTrigramIndex(full_index_path);
+            if (trigrams) {
+                printf("Trigramas: %zu distintos, %zu documentos cubiertos\n",
+                       trigrams->count, trigrams->doc_count);
+                closeTrigramIndex(trigrams);
+            }
             result = EXIT_SUCCESS;
+            
+            // --verify: comprobar los CRC de la base y de cada segmento
+            if (argc > 4 && strcmp(argv[4], "--verify") == 0 &&
+                verifyIndexWithSegments(full_index_path) != 0) {
+                result = EXIT_FAILURE;
+            }
         }
         
         free(full_index_path);
@@ -461,9 +741,51 @@ int handleIndexCommands(int argc, char* argv[]) {
     
         const char* index_file = argv[3];
         const char* target_doc_id = argv[4];
-        int top_k = (argc >= 6) ? atoi(argv[5]) : 5;
+        int top_k = 5;
+        int use_cache = 0;
+        for (int i = 5; i < argc; i++) {
+            if (strcmp(argv[i], "--cache") == 0) use_cache = 1;
+            else top_k = atoi(argv[i]);
+        }
     
-        return findSimilarDocuments(index_file, target_doc_id, top_k);
+        return findSimilarDocuments(index_file, target_doc_id, top_k, use_cache);
+    } else if (strcmp(command, "vector") == 0) {
+        if (argc < 5) {
+            fprintf(stderr, "Error: Faltan argumentos para vector\n");
+            printIndexUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+        
+        int top_n = argc > 5 ? atoi(argv[5]) : 20;
+        return printDocumentVector(argv[3], argv[4], top_n);
+    } else if (strcmp(command, "terms") == 0) {
+        if (argc < 5 || (strcmp(argv[4], "--range") == 0 && argc < 7)) {
+            fprintf(stderr, "Error: Faltan argumentos para terms\n");
+            printIndexUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+        
+        TermQuery query;
+        int parsed = strcmp(argv[4], "--range") == 0 ? parseTermRange(argv[5], argv[6], &query)
+                                                     : parseTermPattern(argv[4], &query);
+        if (parsed != 0) {
+            fprintf(stderr, "Error de memoria\n");
+            return EXIT_FAILURE;
+        }
+        int result = searchTermsInIndex(argv[3], &query);
+        freeTermQuery(&query);
+        return result;
+    } else if (strcmp(command, "grep") == 0) {
+        if (argc < 6) {
+            fprintf(stderr, "Error: Faltan argumentos para grep\n");
+            printIndexUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+
+        const char* index_file = argv[3];
+        const char* alg = argv[4];
+        const char* pattern = argv[5];
+        return grepIndex(index_file, alg, pattern);
     } else if (strcmp(command, "update") == 0) {
         if (argc < 5) {
             fprintf(stderr, "Error: Faltan argumentos para actualización\n");
@@ -474,6 +796,28 @@ int handleIndexCommands(int argc, char* argv[]) {
         const char* index_file = argv[3];
         const char* new_docs = argv[4];
         return updateIndex(index_file, new_docs);
+    } else if (strcmp(command, "remove") == 0) {
+        if (argc < 5) {
+            fprintf(stderr, "Error: Faltan argumentos para borrar\n");
+            fprintf(stderr, "Uso: %s index remove <archivo_indice.idx> <archivo_o_directorio>\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+        return removeFromIndex(argv[3], argv[4]);
+    } else if (strcmp(command, "merge") == 0) {
+        if (argc < 4) {
+            fprintf(stderr, "Error: Falta el archivo de índice\n");
+            fprintf(stderr, "Uso: %s index merge <archivo_indice.idx>\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+        
+        char* full_index_path = buildIndexPath(argv[3]);
+        if (!full_index_path) {
+            fprintf(stderr, "Error: No se pudo construir la ruta del índice\n");
+            return EXIT_FAILURE;
+        }
+        int result = compactIndex(full_index_path) == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+        free(full_index_path);
+        return result;
     } else {
         fprintf(stderr, "Comando de índice no reconocido: %s\n", command);
         printIndexUsage(argv[0]);
@@ -507,13 +851,11 @@ int calculateDocumentSimilarity(const char* index_file, const char* doc_id1, con
         return EXIT_FAILURE;
     }
     
-    // Cargar contenidos
-    char* content1 = loadFile(doc1->filename);
-    char* content2 = loadFile(doc2->filename);
-    
-    if (!content1 || !content2) {
-        free(content1);
-        free(content2);
+    // Vectores del índice directo: no se relee ningún archivo
+    const TermVector* vector1 = forwardVector(&index->forward, id1);
+    const TermVector* vector2 = forwardVector(&index->forward, id2);
+    if (!vector1 || !vector2) {
+        fprintf(stderr, "Documento(s) sin vector en el índice directo\n");
         destroyIndex(index);
         destroyDocumentCollection(collection);
         free(full_index_path);
@@ -521,8 +863,8 @@ int calculateDocumentSimilarity(const char* index_file, const char* doc_id1, con
     }
     
     // Calcular similitudes
-    double jaccard = jaccard_similarity(content1, content2);
-    double cosine = cosine_similarity(content1, content2);
+    double jaccard = jaccardTermVectors(vector1, vector2);
+    double cosine = cosineTermVectors(vector1, vector2);
     
     printf("\n=== Análisis de Similitud ===\n");
     printf("Documento 1: %s (%s)\n", doc1->filename, doc1->title);
@@ -531,17 +873,25 @@ int calculateDocumentSimilarity(const char* index_file, const char* doc_id1, con
     printf("Coseno:  %.4f\n", cosine);
     
     // Liberar recursos
-    free(content1);
-    free(content2);
     destroyIndex(index);
     destroyDocumentCollection(collection);
     free(full_index_path);
     return EXIT_SUCCESS;
 }
 
-// Función para encontrar documentos similares
-int findSimilarDocuments(const char* index_file, const char* target_doc_id, int top_k) {
-    // Cargar índice
+typedef struct {
+    const char* term;
+    uint32_t count;
+} TermFrequency;
+
+static int compareTermFrequency(const void* a, const void* b) {
+    const TermFrequency* fa = (const TermFrequency*)a;
+    const TermFrequency* fb = (const TermFrequency*)b;
+    if (fa->count != fb->count) return fa->count > fb->count ? -1 : 1;
+    return strcmp(fa->term, fb->term);
+}
+
+int printDocumentVector(const char* index_file, const char* doc_id, int top_n) {
     InvertedIndex* index = NULL;
     DocumentCollection* collection = NULL;
     char* full_index_path = buildIndexPath(index_file);
@@ -551,56 +901,109 @@ int findSimilarDocuments(const char* index_file, const char* target_doc_id, int
         free(full_index_path);
         return EXIT_FAILURE;
     }
+    free(full_index_path);
+    
+    uint32_t id = atoi(doc_id);
+    DocumentInfo* doc = getDocumentById(collection, id);
+    const TermVector* vector = doc ? forwardVector(&index->forward, id) : NULL;
+    TermFrequency* terms = vector ? malloc((vector->length + 1) * sizeof(TermFrequency)) : NULL;
+    if (!terms) {
+        fprintf(stderr, doc ? "Error: sin memoria\n" : "Documento no encontrado\n");
+        destroyIndex(index);
+        destroyDocumentCollection(collection);
+        return EXIT_FAILURE;
+    }
+    
+    for (size_t i = 0; i < vector->length; i++) {
+        terms[i].term = termString(&index->terms, vector->ids[i]);
+        terms[i].count = vector->counts[i];
+    }
+    qsort(terms, vector->length, sizeof(TermFrequency), compareTermFrequency);
+    
+    size_t shown = top_n > 0 && (size_t)top_n < vector->length ? (size_t)top_n : vector->length;
+    printf("\nDocumento %u: %s\n", id, doc->filename);
+    printf("Términos distintos: %zu, apariciones: %zu\n", vector->length, vector->total);
+    for (size_t i = 0; i < shown; i++) {
+        printf("%8u  %s\n", terms[i].count, terms[i].term);
+    }
+    
+    free(terms);
+    destroyIndex(index);
+    destroyDocumentCollection(collection);
+    return EXIT_SUCCESS;
+}
+
+// Función para encontrar documentos similares
+int findSimilarDocuments(const char* index_file, const char* target_doc_id, int top_k, int use_cache) {
+    char* full_index_path = buildIndexPath(index_file);
+    if (!full_index_path) return EXIT_FAILURE;
     
     // Buscar documento objetivo
     uint32_t target_id = atoi(target_doc_id);
-    DocumentInfo* target_doc = getDocumentById(collection, target_id);
     
-    if (!target_doc) {
-        fprintf(stderr, "Documento objetivo no encontrado\n");
-        destroyIndex(index);
-        destroyDocumentCollection(collection);
+    // Con un acierto en caché no hace falta cargar el índice ni los documentos
+    char key[64];
+    snprintf(key, sizeof(key), "similar\t%u\t%d", target_id, top_k);
+    QueryCache* cache = openQueryCache(full_index_path, use_cache);
+    if (cache && printCachedResult(cache, key)) {
+        destroyQueryCache(cache);
+        free(full_index_path);
+        return EXIT_SUCCESS;
+    }
+    
+    // Cargar índice
+    InvertedIndex* index = NULL;
+    DocumentCollection* collection = NULL;
+    
+    if (loadIndexFromBinary(&index, &collection, full_index_path) != 0) {
+        destroyQueryCache(cache);
         free(full_index_path);
         return EXIT_FAILURE;
     }
     
-    // Cargar contenido objetivo
-    char* target_content = loadFile(target_doc->filename);
-    if (!target_content) {
+    DocumentInfo* target_doc = getDocumentById(collection, target_id);
+    
+    if (!target_doc) {
+        fprintf(stderr, "Documento objetivo no encontrado\n");
+        destroyQueryCache(cache);
         destroyIndex(index);
         destroyDocumentCollection(collection);
         free(full_index_path);
         return EXIT_FAILURE;
     }
     
-    printf("\nBuscando documentos similares a: %s (%s)\n", 
-           target_doc->filename, target_doc->title);
+    const TermVector* target_vector = forwardVector(&index->forward, target_id);
     
     // Crear array de resultados
-    SimilarityResult* results = calloc(collection->count, sizeof(SimilarityResult));
-    if (!results) {
-        free(target_content);
+    SimilarityResult* results = target_vector ? calloc(collection->count + 1, sizeof(SimilarityResult)) : NULL;
+    char* rendered = NULL;
+    size_t rendered_len = 0;
+    FILE* out = results ? open_memstream(&rendered, &rendered_len) : NULL;
+    if (!out) {
+        free(results);
+        destroyQueryCache(cache);
         destroyIndex(index);
         destroyDocumentCollection(collection);
         free(full_index_path);
         return EXIT_FAILURE;
     }
     
+    fprintf(out, "\nBuscando documentos similares a: %s (%s)\n", 
+            target_doc->filename, target_doc->title);
+    
     size_t valid_results = 0;
     
-    // Calcular similitud con cada documento
+    // Calcular similitud con cada documento desde el índice directo
     for (size_t i = 0; i < collection->count; i++) {
         if (collection->docs[i].doc_id == target_id) continue;
         
-        char* content = loadFile(collection->docs[i].filename);
-        if (!content) continue;
+        const TermVector* vector = forwardVector(&index->forward, collection->docs[i].doc_id);
+        if (!vector) continue;
         
         results[valid_results].doc_id = collection->docs[i].doc_id;
         results[valid_results].filename = collection->docs[i].filename;
-        results[valid_results].similarity = cosine_similarity(target_content, content);
+        results[valid_results].similarity = cosineTermVectors(target_vector, vector);
         valid_results++;
-        
-        free(content);
     }
     
     // Ordenar resultados por similitud
@@ -613,18 +1016,21 @@ int findSimilarDocuments(const char* index_file, const char* target_doc_id, int
     }
     
     // Mostrar top K resultados
-    printf("\nTop %d documentos similares:\n", top_k);
+    fprintf(out, "\nTop %d documentos similares:\n", top_k);
     for (size_t i = 0; i < display_count; i++) {
         DocumentInfo* doc = getDocumentById(collection, results[i].doc_id);
         if (doc) {
-            printf("%zu. [ID: %u] %s (%.4f)\n", 
-                   i+1, results[i].doc_id, doc->filename, results[i].similarity);
+            fprintf(out, "%zu. [ID: %u] %s (%.4f)\n", 
+                    i+1, results[i].doc_id, doc->filename, results[i].similarity);
         }
     }
+    fclose(out);
+    storeResult(cache, full_index_path, key, rendered, rendered_len);
     
     // Liberar recursos
+    free(rendered);
     free(results);
-    free(target_content);
+    destroyQueryCache(cache);
     destroyIndex(index);
     destroyDocumentCollection(collection);
     free(full_index_path);
@@ -1,8 +1,12 @@
 // Diego Galindo, Francisco Mercado
+#define _GNU_SOURCE
 #include "indexer.h"
 #include "index_operations.h"
 #include "persistence.h"
+#include "segments.h"
 #include "utils.h"
+#include "html_stripper.h"
+#include "trigram_index.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -34,14 +38,19 @@ InvertedIndex* createIndex(size_t initial_capacity) {
     if (!index) return NULL;
     
     index->entries = calloc(initial_capacity, sizeof(IndexEntry));
-    if (!index->entries) {
+    if (!index->entries || initTermDictionary(&index->terms, initial_capacity) != 0) {
+        free(index->entries);
         free(index);
         return NULL;
     }
     
+    memset(&index->forward, 0, sizeof(index->forward));
+    memset(&index->analysis, 0, sizeof(index->analysis));
     index->size = 0;
     index->capacity = initial_capacity;
     index->next_doc_id = 1;
+    index->generation = 0;
+    index->build_id = 0;
     
     return index;
 }
@@ -51,45 +60,74 @@ void destroyIndex(InvertedIndex *index) {
     if (!index) return;
     
     for (size_t i = 0; i < index->capacity; i++) {
-        if (index->entries[i].term) {
-            free(index->entries[i].term);
-            
-            PostingNode *current = index->entries[i].head;
-            while (current) {
-                PostingNode *next = current->next;
-                free(current->posting.positions);
-                free(current);
-                current = next;
-            }
+        PostingNode *current = index->entries[i].head;
+        while (current) {
+            PostingNode *next = current->next;
+            free(current->posting.positions);
+            free(current);
+            current = next;
         }
     }
     
+    // Las cadenas de los términos son del diccionario
+    freeForwardIndex(&index->forward);
+    freeTermDictionary(&index->terms);
     free(index->entries);
     free(index);
 }
 
-// Tokenizar texto en palabras
-char** tokenize(const char *text, size_t *token_count) {
-    if (!text || !token_count) return NULL;
-    
-    size_t len = strlen(text);
-    if (len == 0) {
-        *token_count = 0;
-        return NULL;
+#define TOKEN_DELIMITERS " \t\n\r\f\v.,;:!?()[]{}\"'"
+
+// Al menos una letra: descarta números y símbolos sueltos
+static int hasLetter(const char *token) {
+    for (size_t i = 0; token[i]; i++) {
+        if (isalpha((unsigned char)token[i])) return 1;
     }
-    
-    // Crear una copia del texto para modificar
+    return 0;
+}
+
+// Siguiente token aceptado (al menos 2 bytes y una letra), normalizado en
+// su lugar. strtok_r: el modo servidor tokeniza desde varios hilos.
+static char* nextToken(char *text, char **saveptr) {
+    char *token = strtok_r(text, TOKEN_DELIMITERS, saveptr);
+    while (token) {
+        if (strlen(token) >= 2 && hasLetter(token)) {
+            convertir_a_minusculas(token);
+            limpiar_palabra(token);
+            return token;
+        }
+        token = strtok_r(NULL, TOKEN_DELIMITERS, saveptr);
+    }
+    return NULL;
+}
+
+// Copia del texto para strtok_r y cota del número de tokens
+static char* prepareTokenize(const char *text, size_t *estimated_tokens) {
+    size_t len = strlen(text);
     char *text_copy = malloc(len + 1);
     if (!text_copy) return NULL;
-    strcpy(text_copy, text);
+    memcpy(text_copy, text, len + 1);
     
-    // Contar tokens aproximadamente
-    size_t estimated_tokens = 1;
-    for (size_t i = 0; text_copy[i]; i++) {
+    size_t estimated = 1;
+    for (size_t i = 0; i < len; i++) {
         if (isspace((unsigned char)text_copy[i]) || ispunct((unsigned char)text_copy[i])) {
-            estimated_tokens++;
+            estimated++;
         }
     }
+    *estimated_tokens = estimated;
+    return text_copy;
+}
+
+// Tokenizar texto en palabras
+char** tokenize(const char *text, size_t *token_count) {
+    if (!text || !token_count) return NULL;
+    
+    *token_count = 0;
+    if (text[0] == '\0') return NULL;
+    
+    size_t estimated_tokens;
+    char *text_copy = prepareTokenize(text, &estimated_tokens);
+    if (!text_copy) return NULL;
     
     char **tokens = malloc(estimated_tokens * sizeof(char*));
     if (!tokens) {
@@ -98,32 +136,14 @@ char** tokenize(const char *text, size_t *token_count) {
     }
     
     size_t count = 0;
-    char *token = strtok(text_copy, " \t\n\r\f\v.,;:!?()[]{}\"'");
-    
-    while (token && count < estimated_tokens) {
-        // Filtrar tokens muy cortos o que no son palabras
-        if (strlen(token) >= 2) {
-            // Verificar que el token contiene al menos una letra
-            int has_letter = 0;
-            for (size_t i = 0; token[i]; i++) {
-                if (isalpha((unsigned char)token[i])) {
-                    has_letter = 1;
-                    break;
-                }
-            }
-            
-            if (has_letter) {
-                tokens[count] = malloc(strlen(token) + 1);
-                if (tokens[count]) {
-                    strcpy(tokens[count], token);
-                    // Normalizar el token
-                    convertir_a_minusculas(tokens[count]);
-                    limpiar_palabra(tokens[count]);
-                    count++;
-                }
-            }
+    char *saveptr = NULL;
+    for (char *token = nextToken(text_copy, &saveptr); token && count < estimated_tokens;
+         token = nextToken(NULL, &saveptr)) {
+        tokens[count] = malloc(strlen(token) + 1);
+        if (tokens[count]) {
+            strcpy(tokens[count], token);
+            count++;
         }
-        token = strtok(NULL, " \t\n\r\f\v.,;:!?()[]{}\"'");
     }
     
     free(text_copy);
@@ -131,6 +151,38 @@ char** tokenize(const char *text, size_t *token_count) {
     return tokens;
 }
 
+// Tokenizar texto en ids del diccionario, sin una cadena por token
+uint32_t* tokenizeIds(TermDictionary *dict, const AnalysisConfig *analysis,
+                      const char *text, size_t *token_count) {
+    if (!dict || !text || !token_count) return NULL;
+    
+    *token_count = 0;
+    if (text[0] == '\0') return NULL;
+    
+    size_t estimated_tokens;
+    char *text_copy = prepareTokenize(text, &estimated_tokens);
+    if (!text_copy) return NULL;
+    
+    uint32_t *ids = malloc(estimated_tokens * sizeof(uint32_t));
+    if (!ids) {
+        free(text_copy);
+        return NULL;
+    }
+    
+    size_t count = 0;
+    char *saveptr = NULL;
+    for (char *token = nextToken(text_copy, &saveptr); token && count < estimated_tokens;
+         token = nextToken(NULL, &saveptr)) {
+        // Las palabras vacías ocupan su posición aunque no se indexen
+        ids[count++] = analyzeTerm(analysis, token) ?
+                       internTerm(dict, token, strlen(token)) : TERM_ID_NONE;
+    }
+    
+    free(text_copy);
+    *token_count = count;
+    return ids;
+}
+
 // Liberar array de tokens
 void freeTokens(char **tokens, size_t count) {
     if (!tokens) return;
@@ -140,147 +192,215 @@ void freeTokens(char **tokens, size_t count) {
     free(tokens);
 }
 
-// Añadir un término al índice
-void addTermToIndex(InvertedIndex *index, const char *term, uint32_t doc_id, size_t position) {
-    if (!index || !term || strlen(term) == 0) return;
-    
-    uint32_t hash = hash_function(term, index->capacity);
-    size_t original_hash = hash;
-    
-    // Resolución de colisiones por sondeo lineal
-    while (index->entries[hash].term) {
-        if (strcmp(index->entries[hash].term, term) == 0) {
-            // Término ya existe, buscar el documento en la lista de postings
-            PostingNode *current = index->entries[hash].head;
-            PostingNode *prev = NULL;
-            
-            while (current && current->posting.doc_id < doc_id) {
-                prev = current;
-                current = current->next;
-            }
-            
-            if (current && current->posting.doc_id == doc_id) {
-                // Documento ya existe, añadir posición
-                if (current->posting.position_count >= current->posting.position_cap) {
-                    current->posting.position_cap *= 2;
-                    current->posting.positions = realloc(current->posting.positions,
-                        current->posting.position_cap * sizeof(size_t));
-                }
-                current->posting.positions[current->posting.position_count++] = position;
-            } else {
-                // Nuevo documento para este término
-                PostingNode *new_node = malloc(sizeof(PostingNode));
-                if (!new_node) return;
-                
-                new_node->posting.doc_id = doc_id;
-                new_node->posting.position_cap = 4;
-                new_node->posting.positions = malloc(4 * sizeof(size_t));
-                if (!new_node->posting.positions) {
-                    free(new_node);
-                    return;
-                }
-                new_node->posting.positions[0] = position;
-                new_node->posting.position_count = 1;
-                
-                // Insertar en orden por doc_id
-                if (!prev) {
-                    new_node->next = index->entries[hash].head;
-                    index->entries[hash].head = new_node;
-                } else {
-                    new_node->next = current;
-                    prev->next = new_node;
-                }
-                
-                index->entries[hash].doc_frequency++;
-            }
-            return;
-        }
-        
-        hash = (hash + 1) % index->capacity;
-        if (hash == original_hash) {
-            // Tabla llena, necesita redimensionar
-            fprintf(stderr, "Warning: Hash table full\n");
-            return;
-        }
+// Añadir una aparición de un término (por id) al índice
+void addTermIdToIndex(InvertedIndex *index, uint32_t term_id, uint32_t doc_id, size_t position) {
+    if (!index || term_id >= index->terms.count) return;
+    
+    // Las entradas crecen con el diccionario
+    if (term_id >= index->capacity) {
+        size_t capacity = index->capacity * 2;
+        while (capacity <= term_id) capacity *= 2;
+        IndexEntry *grown = realloc(index->entries, capacity * sizeof(IndexEntry));
+        if (!grown) return;
+        memset(grown + index->capacity, 0, (capacity - index->capacity) * sizeof(IndexEntry));
+        index->entries = grown;
+        index->capacity = capacity;
     }
+    IndexEntry *entry = &index->entries[term_id];
     
-    // Nuevo término
-    index->entries[hash].term = malloc(strlen(term) + 1);
-    if (!index->entries[hash].term) return;
-    strcpy(index->entries[hash].term, term);
+    // Buscar el documento en la lista de postings
+    PostingNode *current = entry->head;
+    PostingNode *prev = NULL;
     
-    PostingNode *new_node = malloc(sizeof(PostingNode));
-    if (!new_node) {
-        free(index->entries[hash].term);
-        index->entries[hash].term = NULL;
+    while (current && current->posting.doc_id < doc_id) {
+        prev = current;
+        current = current->next;
+    }
+    
+    if (current && current->posting.doc_id == doc_id) {
+        // Documento ya existe, añadir posición
+        if (current->posting.position_count >= current->posting.position_cap) {
+            current->posting.position_cap *= 2;
+            current->posting.positions = realloc(current->posting.positions,
+                current->posting.position_cap * sizeof(size_t));
+        }
+        current->posting.positions[current->posting.position_count++] = position;
         return;
     }
     
+    // Nuevo documento para este término
+    PostingNode *new_node = malloc(sizeof(PostingNode));
+    if (!new_node) return;
+    
     new_node->posting.doc_id = doc_id;
     new_node->posting.position_cap = 4;
     new_node->posting.positions = malloc(4 * sizeof(size_t));
     if (!new_node->posting.positions) {
         free(new_node);
-        free(index->entries[hash].term);
-        index->entries[hash].term = NULL;
         return;
     }
     new_node->posting.positions[0] = position;
     new_node->posting.position_count = 1;
-    new_node->next = NULL;
     
-    index->entries[hash].head = new_node;
-    index->entries[hash].doc_frequency = 1;
-    index->size++;
-}
-
-// Añadir un documento al índice
-uint32_t addDocument(InvertedIndex *index, DocumentCollection *collection, 
-                     const char *filename, const char *content, const char *title) {
-    if (!index || !collection || !filename || !content) return 0;
-    
-    uint32_t doc_id = index->next_doc_id++;
-    
-    // Añadir documento a la colección
-    if (collection->count >= collection->capacity) {
-        collection->capacity *= 2;
-        collection->docs = realloc(collection->docs, 
-            collection->capacity * sizeof(DocumentInfo));
-        if (!collection->docs) return 0;
+    // Insertar en orden por doc_id
+    if (!prev) {
+        new_node->next = entry->head;
+        entry->head = new_node;
+    } else {
+        new_node->next = current;
+        prev->next = new_node;
     }
     
-    DocumentInfo *doc = &collection->docs[collection->count];
-    doc->doc_id = doc_id;
-    doc->filename = malloc(strlen(filename) + 1);
-    if (!doc->filename) return 0;
-    strcpy(doc->filename, filename);
+    // Primer posting: el término pasa a estar en el índice
+    if (!entry->term) {
+        entry->term = index->terms.terms[term_id];
+        index->size++;
+    }
+    entry->doc_frequency++;
+}
+
+// Añadir un término al índice
+void addTermToIndex(InvertedIndex *index, const char *term, uint32_t doc_id, size_t position) {
+    if (!index || !term || term[0] == '\0') return;
+    addTermIdToIndex(index, internTerm(&index->terms, term, strlen(term)), doc_id, position);
+}
+
+// Guarda tamaño, fecha de modificación y hash del archivo del documento
+static void stampDocument(DocumentInfo *doc, const char *filename) {
+    struct stat st;
+    doc->file_size = 0;
+    doc->mtime = 0;
+    doc->content_hash = 0;
+    if (stat(filename, &st) != 0) return;
+    doc->file_size = (uint64_t)st.st_size;
+    doc->mtime = (int64_t)st.st_mtime;
+    hashFile(filename, &doc->content_hash);
+}
+
+// Registra un documento en la colección; devuelve NULL si falla la memoria
+static DocumentInfo* registerDocument(InvertedIndex *index, DocumentCollection *collection,
+                                      const char *filename, const char *title) {
+    DocumentInfo doc;
+    doc.doc_id = index->next_doc_id++;
+    doc.word_count = 0;
+    doc.filename = malloc(strlen(filename) + 1);
+    if (!doc.filename) return NULL;
+    strcpy(doc.filename, filename);
+    stampDocument(&doc, filename);
     
     if (title) {
-        doc->title = malloc(strlen(title) + 1);
-        if (doc->title) strcpy(doc->title, title);
+        doc.title = malloc(strlen(title) + 1);
+        if (doc.title) strcpy(doc.title, title);
     } else {
-        doc->title = NULL;
+        doc.title = NULL;
     }
     
-    collection->count++;
+    DocumentInfo *added = appendDocumentInfo(collection, &doc);
+    if (!added) {
+        free(doc.filename);
+        free(doc.title);
+    }
+    return added;
+}
+
+// Añadir un documento al índice
+uint32_t addDocument(InvertedIndex *index, DocumentCollection *collection, 
+                     const char *filename, const char *content, const char *title) {
+    if (!index || !collection || !filename || !content) return 0;
+    
+    DocumentInfo *doc = registerDocument(index, collection, filename, title);
+    if (!doc) return 0;
+    uint32_t doc_id = doc->doc_id;
     
     // Tokenizar y añadir al índice
     size_t token_count;
-    char **tokens = tokenize(content, &token_count);
-    if (!tokens) return doc_id;
+    uint32_t *ids = tokenizeIds(&index->terms, &index->analysis, content, &token_count);
+    if (!ids) return doc_id;
     
     doc->word_count = token_count;
     
     for (size_t i = 0; i < token_count; i++) {
-        if (tokens[i] && strlen(tokens[i]) > 0) {
-            addTermToIndex(index, tokens[i], doc_id, i);
-        }
+        if (ids[i] != TERM_ID_NONE) addTermIdToIndex(index, ids[i], doc_id, i);
     }
     
-    freeTokens(tokens, token_count);
+    free(ids);
     return doc_id;
 }
 
+// Tokenizador incremental: recibe el texto limpio por tramos desde el
+// stripper HTML y aplica las mismas reglas que tokenize()
+typedef struct {
+    InvertedIndex *index;
+    uint32_t doc_id;
+    size_t position;   // Tokens aceptados hasta ahora
+    char *token;       // Token en curso (puede cruzar tramos)
+    size_t len;
+    size_t cap;
+} TokenStream;
+
+static int isTokenDelimiter(unsigned char c) {
+    return c != '\0' && strchr(TOKEN_DELIMITERS, c) != NULL;
+}
+
+static void emitStreamToken(TokenStream *ts) {
+    if (ts->len == 0) return;
+    ts->token[ts->len] = '\0';
+    ts->len = 0;
+    
+    // Filtrar tokens muy cortos o que no son palabras
+    if (strlen(ts->token) < 2 || !hasLetter(ts->token)) return;
+    
+    convertir_a_minusculas(ts->token);
+    limpiar_palabra(ts->token);
+    if (analyzeTerm(&ts->index->analysis, ts->token)) {
+        addTermToIndex(ts->index, ts->token, ts->doc_id, ts->position);
+    }
+    ts->position++;
+}
+
+static void streamTokens(const char *text, size_t len, void *ctx) {
+    TokenStream *ts = ctx;
+    for (size_t i = 0; i < len; i++) {
+        unsigned char c = (unsigned char)text[i];
+        if (isTokenDelimiter(c)) {
+            emitStreamToken(ts);
+            continue;
+        }
+        if (ts->len + 1 >= ts->cap) {
+            size_t cap = ts->cap ? ts->cap * 2 : 64;
+            char *grown = realloc(ts->token, cap);
+            if (!grown) continue;  // Se descarta el byte; el token queda truncado
+            ts->token = grown;
+            ts->cap = cap;
+        }
+        ts->token[ts->len++] = (char)c;
+    }
+}
+
+// Añadir un documento HTML leyéndolo por bloques: el stripper alimenta al
+// tokenizador directamente, sin materializar el texto limpio
+uint32_t addHTMLDocument(InvertedIndex *index, DocumentCollection *collection,
+                         const char *filepath, const char *title) {
+    if (!index || !collection || !filepath) return 0;
+    
+    DocumentInfo *doc = registerDocument(index, collection, filepath, title);
+    if (!doc) return 0;
+    
+    TokenStream ts = { index, doc->doc_id, 0, NULL, 0, 0 };
+    int status = stripHTMLFile(filepath, streamTokens, &ts);
+    emitStreamToken(&ts);
+    free(ts.token);
+    
+    doc->word_count = ts.position;
+    return status == 0 ? doc->doc_id : 0;
+}
+
+int isHTMLFile(const char *filename) {
+    size_t len = strlen(filename);
+    return (len >= 5 && strcmp(filename + len - 5, ".html") == 0) ||
+           (len >= 4 && strcmp(filename + len - 4, ".htm") == 0);
+}
+
 // Buscar un término en el índice
 PostingNode* searchTerm(InvertedIndex *index, const char *term) {
     if (!index || !term) return NULL;
@@ -292,27 +412,122 @@ PostingNode* searchTerm(InvertedIndex *index, const char *term) {
     convertir_a_minusculas(normalized_term);
     limpiar_palabra(normalized_term);
     
-    uint32_t hash = hash_function(normalized_term, index->capacity);
-    size_t original_hash = hash;
-    
-    while (index->entries[hash].term) {
-        if (strcmp(index->entries[hash].term, normalized_term) == 0) {
-            free(normalized_term);
-            return index->entries[hash].head;
+    uint32_t id = analyzeTerm(&index->analysis, normalized_term) ?
+                  lookupTerm(&index->terms, normalized_term) : TERM_ID_NONE;
+    free(normalized_term);
+    return id < index->capacity ? index->entries[id].head : NULL;
+}
+
+// ============================================================================
+// Índice directo
+// ============================================================================
+
+void freeForwardIndex(ForwardIndex *forward) {
+    if (!forward) return;
+    for (size_t i = 0; forward->vectors && i < forward->count; i++) {
+        freeTermVector(&forward->vectors[i]);
+    }
+    free(forward->vectors);
+    memset(forward, 0, sizeof(*forward));
+}
+
+const TermVector* forwardVector(const ForwardIndex *forward, uint32_t doc_id) {
+    if (!forward || !forward->vectors || doc_id < forward->first_doc_id) return NULL;
+    size_t slot = doc_id - forward->first_doc_id;
+    return slot < forward->count ? &forward->vectors[slot] : NULL;
+}
+
+TermVector* forwardSlot(ForwardIndex *forward, uint32_t doc_id) {
+    if (!forward->vectors) {
+        forward->vectors = calloc(1, sizeof(TermVector));
+        if (!forward->vectors) return NULL;
+        forward->first_doc_id = doc_id;
+        forward->count = 1;
+        return forward->vectors;
+    }
+
+    // Se amplía el rango hacia abajo o hacia arriba
+    uint32_t first = doc_id < forward->first_doc_id ? doc_id : forward->first_doc_id;
+    size_t end = (size_t)forward->first_doc_id + forward->count;
+    if ((size_t)doc_id + 1 > end) end = (size_t)doc_id + 1;
+    size_t count = end - first;
+    if (count > forward->count) {
+        TermVector *grown = realloc(forward->vectors, count * sizeof(TermVector));
+        if (!grown) return NULL;
+        size_t shift = forward->first_doc_id - first;
+        memmove(grown + shift, grown, forward->count * sizeof(TermVector));
+        memset(grown, 0, shift * sizeof(TermVector));
+        memset(grown + shift + forward->count, 0,
+               (count - shift - forward->count) * sizeof(TermVector));
+        forward->vectors = grown;
+        forward->first_doc_id = first;
+        forward->count = count;
+    }
+    return &forward->vectors[doc_id - forward->first_doc_id];
+}
+
+// Entrada del término en la posición k del recorrido (order o todas)
+static const IndexEntry* forwardEntry(const InvertedIndex *index, const uint32_t *order, size_t k) {
+    uint32_t id = order ? order[k] : (uint32_t)k;
+    if (id >= index->capacity || !index->entries[id].term) return NULL;
+    return &index->entries[id];
+}
+
+// Dos pasadas sobre los postings: tamaños y luego contenido. Recorrer los
+// términos en orden deja cada vector ya ordenado por id.
+int buildForwardIndex(const InvertedIndex *index, const uint32_t *order, size_t order_count,
+                      ForwardIndex *forward) {
+    memset(forward, 0, sizeof(*forward));
+    size_t terms = order ? order_count : index->capacity;
+    uint32_t first = UINT32_MAX, last = 0;
+    for (size_t k = 0; k < terms; k++) {
+        const IndexEntry *entry = forwardEntry(index, order, k);
+        for (PostingNode *p = entry ? entry->head : NULL; p; p = p->next) {
+            if (p->posting.doc_id < first) first = p->posting.doc_id;
+            if (p->posting.doc_id > last) last = p->posting.doc_id;
         }
-        
-        hash = (hash + 1) % index->capacity;
-        if (hash == original_hash) break;
     }
-    
-    free(normalized_term);
-    return NULL;
+    if (first > last) first = last = 0;
+
+    forward->first_doc_id = first;
+    forward->count = (size_t)(last - first) + 1;
+    forward->vectors = calloc(forward->count, sizeof(TermVector));
+    if (!forward->vectors) return -1;
+
+    for (size_t k = 0; k < terms; k++) {
+        const IndexEntry *entry = forwardEntry(index, order, k);
+        for (PostingNode *p = entry ? entry->head : NULL; p; p = p->next) {
+            forward->vectors[p->posting.doc_id - first].length++;
+        }
+    }
+    for (size_t i = 0; i < forward->count; i++) {
+        TermVector *vector = &forward->vectors[i];
+        if (vector->length == 0) continue;
+        vector->ids = malloc(vector->length * sizeof(uint32_t));
+        vector->counts = malloc(vector->length * sizeof(uint32_t));
+        if (!vector->ids || !vector->counts) {
+            freeForwardIndex(forward);
+            return -1;
+        }
+        vector->length = 0;
+    }
+
+    for (size_t k = 0; k < terms; k++) {
+        const IndexEntry *entry = forwardEntry(index, order, k);
+        for (PostingNode *p = entry ? entry->head : NULL; p; p = p->next) {
+            TermVector *vector = &forward->vectors[p->posting.doc_id - first];
+            vector->ids[vector->length] = (uint32_t)k;
+            vector->counts[vector->length++] = (uint32_t)p->posting.position_count;
+            vector->total += p->posting.position_count;
+        }
+    }
+    return 0;
 }
 
 DocumentCollection* createDocumentCollection(size_t initial_capacity) {
     if (initial_capacity == 0) initial_capacity = 64;
     
-    DocumentCollection *collection = malloc(sizeof(DocumentCollection));
+    DocumentCollection *collection = calloc(1, sizeof(DocumentCollection));
     if (!collection) return NULL;
     
     collection->docs = malloc(initial_capacity * sizeof(DocumentInfo));
@@ -336,16 +551,93 @@ void destroyDocumentCollection(DocumentCollection *collection) {
     }
     
     free(collection->docs);
+    free(collection->slot_by_id);
+    free(collection->filename_slots);
     free(collection);
 }
 
+// Inserta la posición slot en la tabla de nombres (sin crecer); un nombre
+// repetido apunta al documento más reciente
+static void insertFilenameSlot(size_t *table, size_t capacity,
+                               const DocumentInfo *docs, size_t slot) {
+    size_t mask = capacity - 1;
+    size_t h = hash_function(docs[slot].filename, UINT32_MAX) & mask;
+    while (table[h] && strcmp(docs[table[h] - 1].filename, docs[slot].filename) != 0) {
+        h = (h + 1) & mask;
+    }
+    table[h] = slot + 1;
+}
+
+// Registra la posición del último documento en los índices por ID y nombre
+static int indexDocumentSlot(DocumentCollection *collection, size_t slot) {
+    uint32_t doc_id = collection->docs[slot].doc_id;
+    if (doc_id >= collection->id_capacity) {
+        size_t capacity = collection->id_capacity ? collection->id_capacity : 64;
+        while (capacity <= doc_id) capacity *= 2;
+        size_t *grown = realloc(collection->slot_by_id, capacity * sizeof(size_t));
+        if (!grown) return -1;
+        memset(grown + collection->id_capacity, 0,
+               (capacity - collection->id_capacity) * sizeof(size_t));
+        collection->slot_by_id = grown;
+        collection->id_capacity = capacity;
+    }
+    collection->slot_by_id[doc_id] = slot + 1;
+    
+    // Factor de carga máximo del 50%
+    if ((slot + 1) * 2 > collection->filename_capacity) {
+        size_t capacity = collection->filename_capacity ? collection->filename_capacity * 2 : 64;
+        while ((slot + 1) * 2 > capacity) capacity *= 2;
+        size_t *table = calloc(capacity, sizeof(size_t));
+        if (!table) return -1;
+        for (size_t i = 0; i < collection->filename_capacity; i++) {
+            if (collection->filename_slots[i]) {
+                insertFilenameSlot(table, capacity, collection->docs,
+                                   collection->filename_slots[i] - 1);
+            }
+        }
+        free(collection->filename_slots);
+        collection->filename_slots = table;
+        collection->filename_capacity = capacity;
+    }
+    insertFilenameSlot(collection->filename_slots, collection->filename_capacity,
+                       collection->docs, slot);
+    return 0;
+}
+
+DocumentInfo* appendDocumentInfo(DocumentCollection *collection, const DocumentInfo *doc) {
+    if (!collection || !doc || !doc->filename) return NULL;
+    
+    if (collection->count >= collection->capacity) {
+        size_t capacity = collection->capacity * 2;
+        DocumentInfo *grown = realloc(collection->docs, capacity * sizeof(DocumentInfo));
+        if (!grown) return NULL;
+        collection->docs = grown;
+        collection->capacity = capacity;
+    }
+    
+    size_t slot = collection->count;
+    collection->docs[slot] = *doc;
+    if (indexDocumentSlot(collection, slot) != 0) return NULL;
+    collection->count++;
+    return &collection->docs[slot];
+}
+
 DocumentInfo* getDocumentById(DocumentCollection *collection, uint32_t doc_id) {
-    if (!collection) return NULL;
+    if (!collection || doc_id >= collection->id_capacity) return NULL;
     
-    for (size_t i = 0; i < collection->count; i++) {
-        if (collection->docs[i].doc_id == doc_id) {
-            return &collection->docs[i];
-        }
+    size_t slot = collection->slot_by_id[doc_id];
+    return slot ? &collection->docs[slot - 1] : NULL;
+}
+
+DocumentInfo* getDocumentByFilename(DocumentCollection *collection, const char *filename) {
+    if (!collection || !filename || collection->filename_capacity == 0) return NULL;
+    
+    size_t mask = collection->filename_capacity - 1;
+    size_t h = hash_function(filename, UINT32_MAX) & mask;
+    while (collection->filename_slots[h]) {
+        DocumentInfo *doc = &collection->docs[collection->filename_slots[h] - 1];
+        if (strcmp(doc->filename, filename) == 0) return doc;
+        h = (h + 1) & mask;
     }
     
     return NULL;
@@ -358,7 +650,85 @@ int isDirectory(const char* path) {
     return S_ISDIR(statbuf.st_mode);
 }
 
-// Actualizar índice con nuevos documentos
+// Doc IDs que quedarán marcados con tombstone
+typedef struct {
+    uint32_t *ids;
+    size_t count;
+    size_t capacity;
+} DocIdList;
+
+static int pushDocId(DocIdList *list, uint32_t id) {
+    if (list->count == list->capacity) {
+        size_t capacity = list->capacity ? list->capacity * 2 : 16;
+        uint32_t *grown = realloc(list->ids, capacity * sizeof(uint32_t));
+        if (!grown) return -1;
+        list->ids = grown;
+        list->capacity = capacity;
+    }
+    list->ids[list->count++] = id;
+    return 0;
+}
+
+typedef struct {
+    int added;
+    int modified;
+    int removed;
+    int unchanged;
+} UpdateStats;
+
+// 1 si el archivo no cambió desde que se indexó el documento: tamaño y
+// fecha iguales, o misma longitud y mismo hash de contenido
+static int documentIsCurrent(const DocumentInfo *doc, const char *path) {
+    struct stat st;
+    if (stat(path, &st) != 0) return 0;
+    if ((uint64_t)st.st_size != doc->file_size) return 0;
+    if ((int64_t)st.st_mtime == doc->mtime) return 1;
+    
+    uint64_t hash;
+    return hashFile(path, &hash) == 0 && hash == doc->content_hash;
+}
+
+// Indexa el archivo si es nuevo o cambió; la versión anterior se marca
+static void refreshFile(InvertedIndex* index, DocumentCollection* collection,
+                        DocumentCollection* existing, const char* filepath,
+                        DocIdList* stale, UpdateStats* stats) {
+    DocumentInfo* previous = getDocumentByFilename(existing, filepath);
+    if (previous && documentIsCurrent(previous, filepath)) {
+        stats->unchanged++;
+        return;
+    }
+    if (!processSingleFile(index, collection, filepath)) return;
+    
+    if (previous) {
+        pushDocId(stale, previous->doc_id);
+        stats->modified++;
+    } else {
+        stats->added++;
+    }
+}
+
+// Copia la ruta sin barras finales, como la guarda "index create"
+static void trimTrailingSlashes(char* out, size_t size, const char* path) {
+    snprintf(out, size, "%s", path);
+    size_t len = strlen(out);
+    while (len > 1 && out[len - 1] == '/') out[--len] = '\0';
+}
+
+// Si el índice tiene trigramas, se amplían con los documentos del segmento
+// nuevo; si falla, esos documentos quedan sin cubrir y grep los recorre
+static void extendTrigramIndex(const char* index_path, const DocumentCollection* collection) {
+    TrigramBuilder trigrams;
+    if (initTrigramBuilder(&trigrams) != 0) return;
+    if (loadTrigramBuilder(&trigrams, index_path) == 0) {
+        for (size_t i = 0; i < collection->count; i++) {
+            addTrigramFile(&trigrams, collection->docs[i].doc_id, collection->docs[i].filename);
+        }
+        saveTrigramIndex(&trigrams, index_path);
+    }
+    freeTrigramBuilder(&trigrams);
+}
+
+// Actualizar índice con documentos nuevos, modificados o borrados
 int updateIndex(const char* index_file, const char* new_docs) {
     // Construir ruta completa
     char* full_index_path = buildIndexPath(index_file);
@@ -367,27 +737,72 @@ int updateIndex(const char* index_file, const char* new_docs) {
         fprintf(stderr, "Error construyendo rutas necesarias.\n");
         return EXIT_FAILURE;
     }
+    if (access(new_docs, F_OK) == 0) {
+        free(full_docs_path);
+        full_docs_path = malloc(strlen(new_docs) + 1);
+        if (!full_docs_path) {
+            free(full_index_path);
+            return EXIT_FAILURE;
+        }
+        strcpy(full_docs_path, new_docs);
+    }
+    
+    // El lock cubre desde leer los documentos vivos hasta registrar el
+    // segmento: otra actualización no puede asignar los mismos doc IDs
+    int lock = lockIndex(full_index_path);
+    if (lock < 0) {
+        free(full_index_path);
+        free(full_docs_path);
+        return EXIT_FAILURE;
+    }
     
-    // Cargar índice existente
-    InvertedIndex* index = NULL;
-    DocumentCollection* collection = NULL;
-    if (loadIndexFromBinary(&index, &collection, full_index_path) != 0) {
+    // Documentos vivos del índice (base + segmentos). Solo se lee su tabla
+    // de documentos: lo nuevo va a un segmento aparte sin reescribir la base
+    DocumentCollection* existing = NULL;
+    if (loadIndexDocuments(full_index_path, &existing) != 0) {
         fprintf(stderr, "Error cargando índice existente\n");
+        unlockIndex(full_index_path, lock);
         free(full_index_path);
+        free(full_docs_path);
         return EXIT_FAILURE;
     }
     
-    // Procesar nuevos documentos
-    int files_added = 0;
+    InvertedIndex* index = createIndex(10000);
+    DocumentCollection* collection = createDocumentCollection(1000);
+    if (!index || !collection) {
+        fprintf(stderr, "Error creando segmento\n");
+        destroyIndex(index);
+        destroyDocumentCollection(collection);
+        destroyDocumentCollection(existing);
+        unlockIndex(full_index_path, lock);
+        free(full_index_path);
+        free(full_docs_path);
+        return EXIT_FAILURE;
+    }
+    index->next_doc_id = nextDocIdForIndex(full_index_path);
+    // El segmento se analiza con la misma configuración que la base
+    IndexFileHeader base_header;
+    if (readIndexHeader(full_index_path, &base_header) == 0) {
+        decodeAnalysis(base_header.analysis, &index->analysis);
+        index->build_id = base_header.build_id;
+    }
     
-    if (isDirectory(new_docs)) {
-        // Procesar directorio completo
-        DIR* dir = opendir(new_docs);
+    DocIdList stale = {0};
+    UpdateStats stats = {0};
+    
+    if (isDirectory(full_docs_path)) {
+        char dir_path[1024];
+        trimTrailingSlashes(dir_path, sizeof(dir_path), full_docs_path);
+        
+        DIR* dir = opendir(dir_path);
         if (!dir) {
             perror("Error abriendo directorio");
-            free(full_index_path);
             destroyIndex(index);
             destroyDocumentCollection(collection);
+            destroyDocumentCollection(existing);
+            unlockIndex(full_index_path, lock);
+            free(full_index_path);
+            free(full_docs_path);
             return EXIT_FAILURE;
         }
         
@@ -395,35 +810,112 @@ int updateIndex(const char* index_file, const char* new_docs) {
         while ((entry = readdir(dir)) != NULL) {
             if (entry->d_type == DT_REG && isTextFile(entry->d_name)) {
                 char filepath[1024];
-                snprintf(filepath, sizeof(filepath), "%s/%s", new_docs, entry->d_name);
-                
-                // Procesar archivo individual
-                if (processSingleFile(index, collection, filepath)) {
-                    files_added++;
-                }
+                snprintf(filepath, sizeof(filepath), "%s/%s", dir_path, entry->d_name);
+                refreshFile(index, collection, existing, filepath, &stale, &stats);
             }
         }
         closedir(dir);
+        
+        // Documentos del directorio cuyo archivo ya no existe
+        size_t prefix_len = strlen(dir_path);
+        for (size_t i = 0; i < existing->count; i++) {
+            const char* name = existing->docs[i].filename;
+            if (strncmp(name, dir_path, prefix_len) == 0 && name[prefix_len] == '/' &&
+                !strchr(name + prefix_len + 1, '/') && access(name, F_OK) != 0) {
+                pushDocId(&stale, existing->docs[i].doc_id);
+                stats.removed++;
+            }
+        }
     } else {
-        // Procesar archivo individual
-        files_added = processSingleFile(index, collection, new_docs) ? 1 : 0;
+        refreshFile(index, collection, existing, full_docs_path, &stale, &stats);
     }
     
-    // Guardar índice actualizado
-    if (files_added > 0) {
-        if (saveIndexToBinary(index, collection, full_index_path) != 0) {
-            fprintf(stderr, "Error guardando índice actualizado\n");
+    // Guardar los documentos nuevos como segmento junto con los tombstones
+    int result = EXIT_SUCCESS;
+    if (collection->count > 0) {
+        if (appendSegment(full_index_path, index, collection, stale.ids, stale.count) != 0) {
+            result = EXIT_FAILURE;
         } else {
-            printf("Índice actualizado. Archivos añadidos: %d\n", files_added);
+            extendTrigramIndex(full_index_path, collection);
         }
+    } else if (stale.count > 0) {
+        if (addTombstones(full_index_path, stale.ids, stale.count) != 0) result = EXIT_FAILURE;
+    }
+    // La fusión en segundo plano toma el lock por su cuenta
+    unlockIndex(full_index_path, lock);
+    
+    if (result != EXIT_SUCCESS) {
+        fprintf(stderr, "Error guardando índice actualizado\n");
+    } else if (collection->count == 0 && stale.count == 0) {
+        printf("El índice ya está al día (%d archivos sin cambios)\n", stats.unchanged);
+    } else {
+        printf("Índice actualizado. Archivos añadidos: %d\n", stats.added);
+        printf("Modificados: %d, eliminados: %d, sin cambios: %d\n",
+               stats.modified, stats.removed, stats.unchanged);
+        if (collection->count > 0) startBackgroundMerge(full_index_path);
     }
     
     // Limpieza
+    free(stale.ids);
     destroyIndex(index);
     destroyDocumentCollection(collection);
+    destroyDocumentCollection(existing);
     free(full_index_path);
     free(full_docs_path);
-    return EXIT_SUCCESS;
+    return result;
+}
+
+// Marcar como borrados un archivo indexado o todos los de un directorio
+int removeFromIndex(const char* index_file, const char* target) {
+    char* full_index_path = buildIndexPath(index_file);
+    if (!full_index_path) {
+        fprintf(stderr, "Error construyendo rutas necesarias.\n");
+        return EXIT_FAILURE;
+    }
+    
+    int lock = lockIndex(full_index_path);
+    if (lock < 0) {
+        free(full_index_path);
+        return EXIT_FAILURE;
+    }
+    DocumentCollection* existing = NULL;
+    if (loadIndexDocuments(full_index_path, &existing) != 0) {
+        fprintf(stderr, "Error cargando índice existente\n");
+        unlockIndex(full_index_path, lock);
+        free(full_index_path);
+        return EXIT_FAILURE;
+    }
+    
+    char path[1024];
+    trimTrailingSlashes(path, sizeof(path), target);
+    size_t path_len = strlen(path);
+    
+    DocIdList removed = {0};
+    for (size_t i = 0; i < existing->count; i++) {
+        const char* name = existing->docs[i].filename;
+        if (strcmp(name, path) == 0 ||
+            (strncmp(name, path, path_len) == 0 && name[path_len] == '/')) {
+            pushDocId(&removed, existing->docs[i].doc_id);
+            printf("  [%u] %s\n", existing->docs[i].doc_id, name);
+        }
+    }
+    
+    int result = EXIT_SUCCESS;
+    if (removed.count == 0) {
+        fprintf(stderr, "No hay documentos indexados que coincidan con %s\n", target);
+        result = EXIT_FAILURE;
+    } else if (addTombstones(full_index_path, removed.ids, removed.count) != 0) {
+        fprintf(stderr, "Error guardando los documentos borrados\n");
+        result = EXIT_FAILURE;
+    } else {
+        printf("Documentos eliminados: %zu\n", removed.count);
+    }
+    unlockIndex(full_index_path, lock);
+    
+    free(removed.ids);
+    destroyDocumentCollection(existing);
+    free(full_index_path);
+    return result;
 }
 
 // Función auxiliar para procesar un archivo
@@ -448,6 +940,18 @@ int processSingleFile(InvertedIndex* index, DocumentCollection* collection, cons
         free(docs_path);
     }
 
+    // Obtener nombre base del archivo
+    const char* filename = strrchr(filepath, '/');
+    if (!filename) filename = strrchr(filepath, '\\');
+    if (filename) filename++;
+    else filename = filepath;
+    
+    // HTML: se quita el marcado en streaming mientras se tokeniza
+    if (isHTMLFile(filepath)) {
+        fclose(file);
+        return addHTMLDocument(index, collection, filepath, filename) != 0 ? 1 : 0;
+    }
+
     // Leer contenido
     fseek(file, 0, SEEK_END);
     long file_size = ftell(file);
@@ -470,12 +974,6 @@ int processSingleFile(InvertedIndex* index, DocumentCollection* collection, cons
     
     fclose(file);
     
-    // Obtener nombre base del archivo
-    const char* filename = strrchr(filepath, '/');
-    if (!filename) filename = strrchr(filepath, '\\');
-    if (filename) filename++;
-    else filename = filepath;
-    
     // Añadir documento
     uint32_t doc_id = addDocument(index, collection, filepath, content, filename);
     free(content);
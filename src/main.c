@@ -10,6 +10,12 @@
 #include "index_operations.h"
 #include "normalization.h"
 #include "similarity.h"
+#include "memchr_search.h"
+#include "planner.h"
+#include "server.h"
+#include "batch.h"
+#include "suffix_array.h"
+#include "fm_index.h"
 
 static int endsWith(const char* str, const char* suffix) {
     size_t n = strlen(str), m = strlen(suffix);
@@ -17,12 +23,58 @@ static int endsWith(const char* str, const char* suffix) {
     return strcmp(str + n - m, suffix) == 0;
 }
 
+// modo de reporte: --count solo cuenta, --first se detiene en el primer match
+static SearchMode parseSearchMode(int argc, char* argv[]) {
+    SearchMode mode = SEARCH_ALL;
+    for (int i = 4; i < argc; i++) {
+        if (strcmp(argv[i], "--count") == 0) {
+            mode = SEARCH_COUNT;
+        } else if (strcmp(argv[i], "--first") == 0) {
+            mode = SEARCH_FIRST;
+        }
+    }
+    return mode;
+}
+
 static void printUsage(const char* prog) {
     printError("Uso:");
     fprintf(stderr,
         "  Búsqueda de patrones:\n"
-        "    %s <algoritmo> <patrón> <archivo>\n"
-        "    algoritmos disponibles: kmp, bm, shiftand\n\n",
+        "    %s <algoritmo> <patrón> <archivo> [opciones] [--count|--first]\n"
+        "    algoritmos disponibles: auto, kmp, kmp_dfa, bm, shiftand, memchr\n"
+        "    auto elige el motor según el patrón y una muestra del texto\n"
+        "    --count: solo imprime el número de coincidencias\n"
+        "    --first: se detiene en la primera coincidencia\n\n",
+        prog
+    );
+    fprintf(stderr,
+        "  Patrones en lote (un patrón por línea, texto cargado una vez):\n"
+        "    %s <algoritmo> --patterns-file <patrones.txt> <archivo> [opciones]\n"
+        "    [--count|--first] [--format jsonl|tsv] [--threads N]\n\n",
+        prog
+    );
+    fprintf(stderr,
+        "  Calibración del planificador (auto):\n"
+        "    %s calibrate <archivo> [salida.conf]\n\n",
+        prog
+    );
+    fprintf(stderr,
+        "  Arreglo de sufijos de un texto grande (<archivo>.sa, SA-IS + LCP):\n"
+        "    %s sa-build <archivo>\n"
+        "    %s sa-search <patrón> <archivo> [--count|--first]\n"
+        "    %s sa-stats <archivo>\n\n",
+        prog, prog, prog
+    );
+    fprintf(stderr,
+        "  FM-index comprimido (<archivo>.fm, BWT + wavelet tree, no necesita el texto):\n"
+        "    %s fm-build <archivo> [--sample N]\n"
+        "    %s fm-search <patrón> <archivo> [--count|--first]\n\n",
+        prog, prog
+    );
+    fprintf(stderr,
+        "  Servidor de consultas (índice residente en memoria):\n"
+        "    %s serve <archivo_indice.idx> [--socket <ruta>] [--threads N]\n"
+        "    sin --socket atiende peticiones por stdin/stdout\n\n",
         prog
     );
     printIndexUsage(prog);
@@ -72,6 +124,97 @@ int main(int argc, char* argv[]) {
     return EXIT_SUCCESS;
 }
 
+    // calibra los umbrales del algoritmo auto sobre un texto de muestra
+    if (strcmp(argv[1], "calibrate") == 0 && argc >= 3) {
+        char* sample = loadFile(argv[2]);
+        if (!sample) return EXIT_FAILURE;
+        convertir_a_minusculas(sample);
+        limpiar_palabra(sample);
+        const char* out = (argc >= 4) ? argv[3] : PLANNER_CONFIG_FILE;
+        int rc = calibratePlanner(sample, out);
+        free(sample);
+        return rc == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    // arreglo de sufijos: se construye una vez y cada busqueda es O(M log n)
+    if (strcmp(argv[1], "sa-build") == 0 && argc >= 3) {
+        return buildSuffixArrayFile(argv[2]) == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+    if ((strcmp(argv[1], "sa-search") == 0 && argc >= 4) ||
+        (strcmp(argv[1], "sa-stats") == 0 && argc >= 3)) {
+        int stats = strcmp(argv[1], "sa-stats") == 0;
+        SuffixIndex sa;
+        if (openSuffixIndex(argv[stats ? 2 : 3], &sa) != 0) return EXIT_FAILURE;
+        if (stats) {
+            printSuffixStats(&sa);
+        } else {
+            SearchMode mode = parseSearchMode(argc, argv);
+            if (mode == SEARCH_ALL) {
+                const char* cols[] = { "Algoritmo", "Posición" };
+                printTableHeader(cols, 2);
+            }
+            searchSuffixArray(&sa, argv[2], mode);
+        }
+        closeSuffixIndex(&sa);
+        return EXIT_SUCCESS;
+    }
+
+    // FM-index: como el arreglo de sufijos pero en ~H0 bits por byte
+    if (strcmp(argv[1], "fm-build") == 0 && argc >= 3) {
+        long sample = 0;
+        if (argc >= 5 && strcmp(argv[3], "--sample") == 0) {
+            sample = strtol(argv[4], NULL, 10);
+            if (sample <= 0 || sample > 65536) {
+                printError("fm-build: --sample debe estar entre 1 y 65536");
+                return EXIT_FAILURE;
+            }
+        }
+        return buildFMIndexFile(argv[2], (uint32_t)sample) == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+    if (strcmp(argv[1], "fm-search") == 0 && argc >= 4) {
+        FMIndex fm;
+        if (loadFMIndex(argv[3], &fm) != 0) return EXIT_FAILURE;
+        SearchMode mode = parseSearchMode(argc, argv);
+        if (mode == SEARCH_ALL) {
+            const char* cols[] = { "Algoritmo", "Posición" };
+            printTableHeader(cols, 2);
+        }
+        searchFMIndex(&fm, argv[2], mode);
+        freeFMIndex(&fm);
+        return EXIT_SUCCESS;
+    }
+
+    // servidor: carga el indice una vez y atiende muchas consultas
+    if (strcmp(argv[1], "serve") == 0 && argc >= 3) {
+        const char* socket_path = NULL;
+        int threads = 0;
+        for (int i = 3; i + 1 < argc; i += 2) {
+            if (strcmp(argv[i], "--socket") == 0) {
+                socket_path = argv[i + 1];
+            } else if (strcmp(argv[i], "--threads") == 0) {
+                threads = atoi(argv[i + 1]);
+            }
+        }
+        return runServer(argv[2], socket_path, threads) == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    // patrones en lote: <alg> --patterns-file <patrones> <archivo> [opciones]
+    if (argc >= 5 && strcmp(argv[2], "--patterns-file") == 0) {
+        BatchFormat format = BATCH_JSONL;
+        int threads = 0;
+        for (int i = 5; i + 1 < argc; i++) {
+            if (strcmp(argv[i], "--format") == 0 && parseBatchFormat(argv[i + 1], &format) != 0) {
+                fprintf(stderr, "Formato no reconocido: %s (opciones: jsonl, tsv)\n", argv[i + 1]);
+                return EXIT_FAILURE;
+            } else if (strcmp(argv[i], "--threads") == 0) {
+                threads = atoi(argv[i + 1]);
+            }
+        }
+        NormalizationOptions norm_opts = parseNormalizationOptions(argc, argv);
+        return searchPatternsBatch(argv[1], argv[3], argv[4], &norm_opts,
+                                   parseSearchMode(argc, argv), format, threads);
+    }
+
     // busqueda de patrones
     if (argc < 4) {
         printUsage(argv[0]);
@@ -115,30 +258,50 @@ int main(int argc, char* argv[]) {
     NormalizationOptions norm_opts = parseNormalizationOptions(argc, argv);
     
     // Aplicar normalización al texto y patrón
-    applyNormalization(text, pattern, &norm_opts);
+    applyNormalization(&text, &pattern, &norm_opts);
     
     // Mostrar información de depuración
     printf(">>> Algoritmo: %s | Patrón original: \"%s\" | Archivo: %s\n", 
            alg, patArg, filename);
     printf(">>> Patrón normalizado: \"%s\"\n\n", pattern);
 
-    // encabezado de tabla
-    const char* cols[] = { "Algoritmo", "Posición" };
-    printTableHeader(cols, 2);
+    SearchMode mode = parseSearchMode(argc, argv);
+
+    // auto: el planificador elige el motor y se registra la decisión
+    if (strcmp(alg, "auto") == 0) {
+        PlannerThresholds thresholds;
+        int calibrated = loadPlannerThresholds(PLANNER_CONFIG_FILE, &thresholds) == 0;
+        SearchPlan plan = planSearch(pattern, text, &thresholds);
+        alg = plannedAlgorithmName(plan.alg);
+        printf(">>> Plan: %s (%s; umbrales %s)\n\n", alg, plan.reason,
+               calibrated ? PLANNER_CONFIG_FILE : "por defecto");
+    }
+
+    // encabezado de tabla (solo cuando se listan todas las posiciones)
+    if (mode == SEARCH_ALL) {
+        const char* cols[] = { "Algoritmo", "Posición" };
+        printTableHeader(cols, 2);
+    }
     // ejecuta el algoritmo seleccionado
     if (strcmp(alg, "kmp") == 0) {
-        searchKMP(pattern, text);
+        searchKMP(pattern, text, mode);
+    }
+    else if (strcmp(alg, "kmp_dfa") == 0) {
+        searchKMP_DFA(pattern, text, mode);
     }
     else if (strcmp(alg, "bm") == 0) {
-        searchBoyerMooreUnicode(pattern, text);
+        searchBoyerMooreUnicode(pattern, text, mode);
     }
     else if (strcmp(alg, "shiftand") == 0) {
-        searchShiftAnd(pattern, text);
+        searchShiftAnd(pattern, text, mode);
+    }
+    else if (strcmp(alg, "memchr") == 0) {
+        searchMemchr(pattern, text, mode);
     }
     else {
         printError("Algoritmo no reconocido:");
         fprintf(stderr, "  %s\n", alg);
-        printError("Opciones válidas: kmp, bm, shiftand");
+        printError("Opciones válidas: auto, kmp, kmp_dfa, bm, shiftand, memchr");
         free(text);
         free(pattern);
         return EXIT_FAILURE;
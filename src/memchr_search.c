@@ -0,0 +1,56 @@
+// Diego Galindo, Francisco Mercado
+#include "memchr_search.h"
+#include "cli.h"
+#include <stdio.h>
+#include <string.h>
+
+size_t execMemchr(const char *pat, size_t M, const char *text, size_t N,
+                  SearchMode mode, MatchCallback cb, void *ctx) {
+    if (!pat || !text || M == 0 || M > 2 || M > N) return 0;
+    size_t count = 0;
+    const char *p = text, *end = text + N;
+    while (p < end && (p = memchr(p, pat[0], (size_t)(end - p))) != NULL) {
+        //segundo byte (si lo hay) comparado directamente
+        if (M == 1 || (p + 1 < end && p[1] == pat[1])) {
+            count++;
+            if (mode != SEARCH_COUNT && cb) cb((size_t)(p - text), ctx);
+            if (mode == SEARCH_FIRST) break;
+        }
+        p++;
+    }
+    return count;
+}
+
+//callback que imprime cada coincidencia como fila de tabla
+static void printMemchrRow(size_t s, void *ctx) {
+    (void)ctx;
+    char pos[32];
+    sprintf(pos, "%zu", s);
+    const char *cells[] = { "memchr", pos };
+    printTableRow(cells, 2);
+}
+
+size_t searchMemchr(const char *pattern, const char *text, SearchMode mode) {
+    if (!pattern || !text) {
+        printError("searchMemchr: patrón o texto NULL");
+        return 0;
+    }
+    size_t M = strlen(pattern), N = strlen(text);
+    if (M == 0 || M > 2) {
+        printError("searchMemchr: el patrón debe tener 1 o 2 bytes");
+        return 0;
+    }
+
+    size_t first = 0;
+    size_t matches = execMemchr(pattern, M, text, N, mode,
+                                mode == SEARCH_ALL ? printMemchrRow : storeFirstMatch,
+                                &first);
+    if (mode == SEARCH_FIRST && matches > 0) {
+        printMatch(first, "memchr");
+    } else if (mode != SEARCH_ALL) {
+        printMatchCount(matches, "memchr");
+    } else {
+        printTableFooter(2);
+    }
+    return matches;
+}
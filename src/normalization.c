@@ -1,5 +1,6 @@
 // Diego Galindo, Francisco Mercado
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include "normalization.h"
 #include "utils.h"
@@ -34,38 +35,49 @@ NormalizationOptions parseNormalizationOptions(int argc, char* argv[]) {
     return opts;
 }
 
-void applyNormalization(char* text, char* pattern, const NormalizationOptions* opts) {
+// Normaliza una cadena con la pasada única de utils.c y reemplaza el búfer
+static void normalizeBuffer(char** str, unsigned flags) {
+    size_t out_len;
+    char* normalized = unicode_normalize_alloc(*str, strlen(*str), flags, &out_len);
+    if (!normalized) {
+        fprintf(stderr, "applyNormalization: malloc falló, se conserva el texto original\n");
+        return;
+    }
+    free(*str);
+    *str = normalized;
+}
+
+static unsigned normalizationFlags(const NormalizationOptions* opts) {
+    // Forma canónica, case-folding y diacríticos en una sola pasada
+    unsigned flags = UNORM_CASEFOLD;
+    flags |= (opts->norm_form == UNICODE_NFD) ? UNORM_NFD : UNORM_NFC;
+    if (opts->remove_diacritics) flags |= UNORM_STRIP_DIACRITICS;
+    return flags;
+}
+
+void normalizeString(char** str, const NormalizationOptions* opts) {
+    if (opts->use_unicode_advanced) {
+        normalizeBuffer(str, normalizationFlags(opts));
+        squeezeSpaces(*str);
+    } else {
+        convertir_a_minusculas(*str);
+        limpiar_palabra(*str);
+    }
+}
+
+void applyNormalization(char** text, char** pattern, const NormalizationOptions* opts) {
     if (opts->use_unicode_advanced) {
         // Usar normalización Unicode avanzada
         printf(">>> Aplicando normalización Unicode avanzada...\n");
-        
-        // Normalizar texto
-        if (opts->norm_form == UNICODE_NFC || opts->norm_form == UNICODE_NFD) {
-            unicode_normalize(text, opts->norm_form);
-            unicode_normalize(pattern, opts->norm_form);
-        }
-        
-        // Aplicar case-folding Unicode
-        unicode_case_fold(text);
-        unicode_case_fold(pattern);
-        
-        // Eliminar diacríticos si se solicita
+        normalizeString(text, opts);
+        normalizeString(pattern, opts);
         if (opts->remove_diacritics) {
-            remove_diacritics(text, 1);
-            remove_diacritics(pattern, 1);
             printf(">>> Diacríticos eliminados\n");
         }
-        
-        // Limpiar espacios
-        squeezeSpaces(text);
-        squeezeSpaces(pattern);
-        
     } else {
         // Usar normalización básica (comportamiento original)
         printf(">>> Aplicando normalización básica...\n");
-        convertir_a_minusculas(text);
-        limpiar_palabra(text);
-        convertir_a_minusculas(pattern);
-        limpiar_palabra(pattern);
+        normalizeString(text, opts);
+        normalizeString(pattern, opts);
     }
-}
\ No newline at end of file
+}
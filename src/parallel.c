@@ -0,0 +1,63 @@
+// Diego Galindo, Francisco Mercado
+#define _GNU_SOURCE
+#include "parallel.h"
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+typedef struct {
+    atomic_size_t next;   // Próximo índice a repartir
+    size_t n;
+    ParallelTask task;
+    void *ctx;
+} ParallelJob;
+
+int defaultThreadCount(void) {
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return (n > 0) ? (int)n : 1;
+}
+
+static void* parallelWorker(void *arg) {
+    ParallelJob *job = arg;
+    size_t i;
+    while ((i = atomic_fetch_add(&job->next, 1)) < job->n) {
+        job->task(i, job->ctx);
+    }
+    return NULL;
+}
+
+void parallelFor(size_t n, int num_threads, ParallelTask task, void *ctx) {
+    if (!task || n == 0) return;
+    if (num_threads > (int)n) num_threads = (int)n;
+
+    ParallelJob job;
+    atomic_init(&job.next, 0);
+    job.n = n;
+    job.task = task;
+    job.ctx = ctx;
+
+    if (num_threads <= 1) {
+        parallelWorker(&job);
+        return;
+    }
+
+    pthread_t *threads = malloc((size_t)num_threads * sizeof(pthread_t));
+    if (!threads) {
+        parallelWorker(&job);
+        return;
+    }
+
+    // El hilo actual también trabaja; se lanzan num_threads - 1 adicionales
+    int started = 0;
+    for (int t = 0; t < num_threads - 1; t++) {
+        if (pthread_create(&threads[started], NULL, parallelWorker, &job) == 0) {
+            started++;
+        }
+    }
+    parallelWorker(&job);
+    for (int t = 0; t < started; t++) {
+        pthread_join(threads[t], NULL);
+    }
+    free(threads);
+}
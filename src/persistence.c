@@ -1,74 +1,480 @@
 // Diego Galindo, Francisco Mercado
 #define _GNU_SOURCE  // For strdup function
 #include "persistence.h"
+#include "segments.h"
+#include "checksum.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
 #include <sys/stat.h>
 #include <errno.h>
+#include <unistd.h>
+#include <fcntl.h>
 
+// Codificación little-endian explícita: el resultado no depende del
+// compilador ni del orden de bytes del host (en x86 se reduce a un mov)
+static inline void putLE32(unsigned char *p, uint32_t v) {
+    p[0] = (unsigned char)v;
+    p[1] = (unsigned char)(v >> 8);
+    p[2] = (unsigned char)(v >> 16);
+    p[3] = (unsigned char)(v >> 24);
+}
+
+static inline void putLE64(unsigned char *p, uint64_t v) {
+    putLE32(p, (uint32_t)v);
+    putLE32(p + 4, (uint32_t)(v >> 32));
+}
+
+static inline uint32_t getLE32(const unsigned char *p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static inline uint64_t getLE64(const unsigned char *p) {
+    return (uint64_t)getLE32(p) | ((uint64_t)getLE32(p + 4) << 32);
+}
+
+// Los offsets del header coinciden con los del struct de las versiones
+// anteriores en x86-64, así que el mismo decodificador sirve para todas
+static void encodeHeader(const IndexFileHeader *h, unsigned char *out) {
+    memset(out, 0, INDEX_HEADER_SIZE);
+    putLE32(out, h->magic);
+    putLE32(out + 4, h->version);
+    putLE32(out + 8, h->num_terms);
+    putLE32(out + 12, h->num_documents);
+    putLE32(out + 16, h->next_doc_id);
+    putLE32(out + 20, h->generation);
+    putLE64(out + 24, h->checksum_offset);
+    putLE32(out + 32, h->analysis);
+    putLE32(out + 36, h->build_id);
+}
+
+static void decodeHeader(const unsigned char *in, IndexFileHeader *h) {
+    h->magic = getLE32(in);
+    h->version = getLE32(in + 4);
+    h->num_terms = getLE32(in + 8);
+    h->num_documents = getLE32(in + 12);
+    h->next_doc_id = getLE32(in + 16);
+    // En las versiones antiguas aquí había relleno del struct
+    h->generation = h->version >= INDEX_PORTABLE_VERSION ? getLE32(in + 20) : 0;
+    h->checksum_offset = getLE64(in + 24);
+    h->analysis = h->version >= INDEX_ANALYSIS_VERSION ? getLE32(in + 32) : 0;
+    h->build_id = h->version >= INDEX_ANALYSIS_VERSION ? getLE32(in + 36) : 0;
+}
+
+// Bytes del header en disco según la versión
+static size_t headerSize(uint32_t version) {
+    return version >= INDEX_ANALYSIS_VERSION ? INDEX_HEADER_SIZE : INDEX_LEGACY_HEADER_SIZE;
+}
+
+static void encodeTrailer(const ChecksumTrailer *t, unsigned char *out) {
+    putLE32(out, t->magic);
+    putLE32(out + 4, t->block_size);
+    putLE64(out + 8, t->documents_offset);
+    putLE32(out + 16, t->terms_blocks);
+    putLE32(out + 20, t->block_count);
+    putLE32(out + 24, t->header_crc);
+    putLE32(out + 28, t->trailer_crc);
+}
+
+static void decodeTrailer(const unsigned char *in, ChecksumTrailer *t) {
+    t->magic = getLE32(in);
+    t->block_size = getLE32(in + 4);
+    t->documents_offset = getLE64(in + 8);
+    t->terms_blocks = getLE32(in + 16);
+    t->block_count = getLE32(in + 20);
+    t->header_crc = getLE32(in + 24);
+    t->trailer_crc = getLE32(in + 28);
+}
+
+static void decodeTermRecord(const unsigned char *in, TermHeader *t) {
+    t->term_length = getLE32(in);
+    t->doc_frequency = getLE32(in + 4);
+    t->posting_count = getLE32(in + 8);
+}
+
+static void decodePostingRecord(const unsigned char *in, PostingHeader *p) {
+    p->doc_id = getLE32(in);
+    p->position_count = getLE32(in + 4);
+}
+
+static size_t positionSize(uint32_t version) {
+    return version >= INDEX_PORTABLE_VERSION ? 4 : INDEX_LEGACY_POSITION_SIZE;
+}
+
+static size_t documentRecordSize(uint32_t version) {
+    if (version >= INDEX_PORTABLE_VERSION) return INDEX_DOCUMENT_RECORD_SIZE;
+    return version == 1 ? 24 : 48;
+}
+
+// Registro de documento según la versión (las antiguas con relleno tras
+// title_length y, la 1, sin datos del archivo)
+static void decodeDocumentRecord(const unsigned char *in, uint32_t version, DocumentHeader *d) {
+    memset(d, 0, sizeof(*d));
+    d->doc_id = getLE32(in);
+    d->filename_length = getLE32(in + 4);
+    d->title_length = getLE32(in + 8);
+    if (version >= INDEX_PORTABLE_VERSION) {
+        d->word_count = getLE64(in + 12);
+        d->file_size = getLE64(in + 20);
+        d->mtime = (int64_t)getLE64(in + 28);
+        d->content_hash = getLE64(in + 36);
+        return;
+    }
+    d->word_count = getLE64(in + 16);
+    if (version >= 2) {
+        d->file_size = getLE64(in + 24);
+        d->mtime = (int64_t)getLE64(in + 32);
+        d->content_hash = getLE64(in + 40);
+    }
+}
+
+// Lee el header crudo y lo decodifica (sin validar)
+// raw debe tener INDEX_HEADER_SIZE bytes; la cola de los headers cortos queda a 0
+static int readRawHeader(FILE *file, unsigned char *raw, IndexFileHeader *header) {
+    memset(raw, 0, INDEX_HEADER_SIZE);
+    if (fread(raw, 1, INDEX_LEGACY_HEADER_SIZE, file) != INDEX_LEGACY_HEADER_SIZE) return -1;
+    size_t extra = headerSize(getLE32(raw + 4)) - INDEX_LEGACY_HEADER_SIZE;
+    if (extra && fread(raw + INDEX_LEGACY_HEADER_SIZE, 1, extra, file) != extra) return -1;
+    decodeHeader(raw, header);
+    return 0;
+}
+
+
+// Escritura con búfer grande y CRC32C por bloques de INDEX_BLOCK_SIZE bytes:
+// los headers y posiciones pequeños se acumulan y salen en write()s
+// secuenciales de INDEX_WRITE_BUFFER bytes
+typedef struct {
+    int fd;
+    unsigned char *buffer;
+    size_t buffered;
+    uint64_t offset;          // Bytes entregados al writer
+    uint32_t crc;             // CRC del bloque en curso
+    size_t block_fill;
+    uint32_t *crcs;
+    size_t count;
+    size_t capacity;
+    int failed;
+} IndexWriter;
+
+static int writeAll(int fd, const void *data, size_t len) {
+    const unsigned char *p = data;
+    while (len > 0) {
+        ssize_t n = write(fd, p, len);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return -1;
+        }
+        p += n;
+        len -= (size_t)n;
+    }
+    return 0;
+}
+
+static void writerFlush(IndexWriter *w) {
+    if (w->buffered > 0 && writeAll(w->fd, w->buffer, w->buffered) != 0) w->failed = 1;
+    w->buffered = 0;
+}
+
+// Escribe sin contar en los CRC de bloque (header, trailer, tabla)
+static void writerWriteRaw(IndexWriter *w, const void *data, size_t len) {
+    const unsigned char *p = data;
+    w->offset += len;
+    while (len > 0) {
+        size_t take = INDEX_WRITE_BUFFER - w->buffered;
+        if (take > len) take = len;
+        memcpy(w->buffer + w->buffered, p, take);
+        w->buffered += take;
+        p += take;
+        len -= take;
+        if (w->buffered == INDEX_WRITE_BUFFER) writerFlush(w);
+    }
+}
+
+static void writerEndBlock(IndexWriter *w) {
+    if (w->block_fill == 0) return;
+    if (w->count == w->capacity) {
+        size_t capacity = w->capacity ? w->capacity * 2 : 64;
+        uint32_t *grown = realloc(w->crcs, capacity * sizeof(uint32_t));
+        if (!grown) {
+            w->failed = 1;
+            return;
+        }
+        w->crcs = grown;
+        w->capacity = capacity;
+    }
+    w->crcs[w->count++] = w->crc;
+    w->crc = 0;
+    w->block_fill = 0;
+}
+
+static void writerWrite(IndexWriter *w, const void *data, size_t len) {
+    const unsigned char *p = data;
+    while (len > 0) {
+        size_t take = INDEX_BLOCK_SIZE - w->block_fill;
+        if (take > len) take = len;
+        w->crc = crc32c(w->crc, p, take);
+        writerWriteRaw(w, p, take);
+        w->block_fill += take;
+        p += take;
+        len -= take;
+        if (w->block_fill == INDEX_BLOCK_SIZE) writerEndBlock(w);
+    }
+}
+
+// fsync del directorio para que el rename sobreviva a un corte de luz
+static void syncParentDirectory(const char *filename) {
+    char dir[1024];
+    const char *slash = strrchr(filename, '/');
+    if (slash) {
+        snprintf(dir, sizeof(dir), "%.*s", (int)(slash - filename), filename);
+        if (dir[0] == '\0') strcpy(dir, "/");
+    } else {
+        strcpy(dir, ".");
+    }
+    int fd = open(dir, O_RDONLY);
+    if (fd < 0) return;
+    fsync(fd);
+    close(fd);
+}
+
+// ============================================================================
+// Diccionario de términos (versión 5)
+// ============================================================================
+
+static size_t putVarint(unsigned char *p, uint64_t v) {
+    size_t n = 0;
+    while (v >= 0x80) {
+        p[n++] = (unsigned char)(v | 0x80);
+        v >>= 7;
+    }
+    p[n++] = (unsigned char)v;
+    return n;
+}
+
+int compareIndexEntries(const void *a, const void *b) {
+    const IndexEntry *ea = *(const IndexEntry *const *)a;
+    const IndexEntry *eb = *(const IndexEntry *const *)b;
+    return strcmp(ea->term, eb->term);
+}
+
+// Entradas con término (indexadas por id de término) ordenadas
+// alfabéticamente para el diccionario (NULL si no hay)
+static const IndexEntry** sortedEntries(const InvertedIndex *index) {
+    if (index->size == 0) return NULL;
+    const IndexEntry **sorted = malloc(index->size * sizeof(IndexEntry*));
+    if (!sorted) return NULL;
+    size_t n = 0;
+    for (size_t i = 0; i < index->capacity && n < index->size; i++) {
+        if (index->entries[i].term) sorted[n++] = &index->entries[i];
+    }
+    qsort(sorted, n, sizeof(IndexEntry*), compareIndexEntries);
+    return sorted;
+}
 
-// Guardar índice en formato binario
+static size_t sharedPrefix(const char *a, const char *b) {
+    size_t n = 0;
+    while (a[n] && a[n] == b[n]) n++;
+    return n;
+}
+
+// Escribe el header del diccionario, las entradas con front coding y la
+// tabla de reinicios. Los bytes de postings de cada término se conocen
+// antes de escribirlos: 8 por posting más 4 por posición.
+static int writeDictionary(IndexWriter *w, const IndexEntry **sorted, size_t count) {
+    size_t restart_count = (count + INDEX_DICTIONARY_RESTART - 1) / INDEX_DICTIONARY_RESTART;
+    unsigned char *restarts = malloc(restart_count * INDEX_RESTART_RECORD_SIZE + 1);
+    size_t capacity = 4096, used = 0;
+    unsigned char *entries = malloc(capacity);
+    if (!restarts || !entries) {
+        free(restarts);
+        free(entries);
+        return -1;
+    }
+    
+    uint64_t postings_bytes = 0;
+    const char *previous = "";
+    for (size_t i = 0; i < count; i++) {
+        const char *term = sorted[i]->term;
+        size_t term_len = strlen(term);
+        // Cinco varints de a lo más 10 bytes más el sufijo
+        if (used + term_len + 50 > capacity) {
+            while (used + term_len + 50 > capacity) capacity *= 2;
+            unsigned char *grown = realloc(entries, capacity);
+            if (!grown) {
+                free(restarts);
+                free(entries);
+                return -1;
+            }
+            entries = grown;
+        }
+        
+        size_t shared = 0;
+        if (i % INDEX_DICTIONARY_RESTART == 0) {
+            unsigned char *restart = restarts + (i / INDEX_DICTIONARY_RESTART) * INDEX_RESTART_RECORD_SIZE;
+            putLE32(restart, (uint32_t)used);
+            putLE64(restart + 4, postings_bytes);
+        } else {
+            shared = sharedPrefix(previous, term);
+        }
+        
+        uint64_t term_postings = 0, posting_count = 0;
+        for (PostingNode *p = sorted[i]->head; p; p = p->next) {
+            posting_count++;
+            term_postings += INDEX_POSTING_RECORD_SIZE + 4 * (uint64_t)p->posting.position_count;
+        }
+        
+        used += putVarint(entries + used, shared);
+        used += putVarint(entries + used, term_len - shared);
+        memcpy(entries + used, term + shared, term_len - shared);
+        used += term_len - shared;
+        used += putVarint(entries + used, sorted[i]->doc_frequency);
+        used += putVarint(entries + used, posting_count);
+        used += putVarint(entries + used, term_postings);
+        postings_bytes += term_postings;
+        previous = term;
+    }
+    
+    unsigned char header[INDEX_DICTIONARY_HEADER_SIZE];
+    putLE32(header, INDEX_DICTIONARY_RESTART);
+    putLE32(header + 4, (uint32_t)restart_count);
+    putLE64(header + 8, used);
+    putLE64(header + 16, w->offset + INDEX_DICTIONARY_HEADER_SIZE + used +
+                         restart_count * INDEX_RESTART_RECORD_SIZE);
+    writerWrite(w, header, INDEX_DICTIONARY_HEADER_SIZE);
+    writerWrite(w, entries, used);
+    writerWrite(w, restarts, restart_count * INDEX_RESTART_RECORD_SIZE);
+    free(restarts);
+    free(entries);
+    return used > UINT32_MAX ? -1 : 0;
+}
+
+// Índice directo (versión 6): un vector por documento, en el orden de la
+// tabla de documentos, con los ids del diccionario como diferencias
+static void writeForwardIndex(IndexWriter *w, const ForwardIndex *forward,
+                              const DocumentCollection *collection) {
+    unsigned char buffer[4096];
+    size_t filled = 0;
+    for (size_t i = 0; i < collection->count; i++) {
+        const TermVector *vector = forwardVector(forward, collection->docs[i].doc_id);
+        size_t length = vector ? vector->length : 0;
+        filled += putVarint(buffer + filled, length);
+        uint32_t previous = 0;
+        for (size_t j = 0; j < length; j++) {
+            // Dos varints de a lo más 5 bytes
+            if (filled + 10 > sizeof(buffer)) {
+                writerWrite(w, buffer, filled);
+                filled = 0;
+            }
+            filled += putVarint(buffer + filled, vector->ids[j] - previous);
+            filled += putVarint(buffer + filled, vector->counts[j]);
+            previous = vector->ids[j];
+        }
+        if (filled + 10 > sizeof(buffer)) {
+            writerWrite(w, buffer, filled);
+            filled = 0;
+        }
+    }
+    writerWrite(w, buffer, filled);
+}
+
+// Guardar índice en formato binario. Se escribe en un temporal junto al
+// destino, se hace fsync y se renombra: un corte a mitad de escritura deja
+// el archivo anterior intacto, nunca uno a medias.
 int saveIndexToBinary(const InvertedIndex *index, const DocumentCollection *collection, 
                       const char *filename) {
     if (!index || !collection || !filename) return -1;
     
-    FILE *file = fopen(filename, "wb");
-    if (!file) {
+    char tmp_path[1100];
+    snprintf(tmp_path, sizeof(tmp_path), "%s.tmp.%ld", filename, (long)getpid());
+    
+    IndexWriter w = {0};
+    w.fd = open(tmp_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (w.fd < 0) {
         perror("saveIndexToBinary: Error al abrir archivo");
         return -1;
     }
+    w.buffer = malloc(INDEX_WRITE_BUFFER);
+    if (!w.buffer) {
+        close(w.fd);
+        unlink(tmp_path);
+        return -1;
+    }
     
-    // Escribir header
+    // Header provisional: se reescribe al final con el offset de los checksums
     IndexFileHeader header = {0};
     header.magic = INDEX_FILE_MAGIC;
     header.version = INDEX_FILE_VERSION;
     header.num_terms = (uint32_t)index->size;
     header.num_documents = (uint32_t)collection->count;
     header.next_doc_id = index->next_doc_id;
-    header.checksum = 0; // Se calculará al final
+    header.generation = index->generation;
+    header.checksum_offset = 0;
+    header.analysis = encodeAnalysis(&index->analysis);
+    header.build_id = index->build_id;
     
-    fwrite(&header, sizeof(IndexFileHeader), 1, file);
+    unsigned char raw_header[INDEX_HEADER_SIZE];
+    encodeHeader(&header, raw_header);
+    writerWriteRaw(&w, raw_header, INDEX_HEADER_SIZE);
     
-    // Escribir términos e índice invertido
-    for (size_t i = 0; i < index->capacity; i++) {
-        if (index->entries[i].term) {
-            TermHeader term_header;
-            term_header.term_length = (uint32_t)strlen(index->entries[i].term) + 1;
-            term_header.doc_frequency = index->entries[i].doc_frequency;
-            
-            // Contar postings
-            uint32_t posting_count = 0;
-            PostingNode *current = index->entries[i].head;
-            while (current) {
-                posting_count++;
-                current = current->next;
-            }
-            term_header.posting_count = posting_count;
-            
-            // Escribir header del término
-            fwrite(&term_header, sizeof(TermHeader), 1, file);
+    unsigned char record[INDEX_DOCUMENT_RECORD_SIZE];
+    unsigned char positions[4096];
+    
+    // Diccionario ordenado y luego los postings en el mismo orden
+    const IndexEntry **sorted = sortedEntries(index);
+    if (!sorted && index->size > 0) w.failed = 1;
+    if (sorted && writeDictionary(&w, sorted, index->size) != 0) w.failed = 1;
+    
+    for (size_t i = 0; sorted && i < index->size; i++) {
+        // Escribir postings
+        PostingNode *current = sorted[i]->head;
+        while (current) {
+            PostingHeader posting_header;
+            posting_header.doc_id = current->posting.doc_id;
+            posting_header.position_count = (uint32_t)current->posting.position_count;
             
-            // Escribir el término
-            fwrite(index->entries[i].term, term_header.term_length, 1, file);
+            putLE32(record, posting_header.doc_id);
+            putLE32(record + 4, posting_header.position_count);
+            writerWrite(&w, record, INDEX_POSTING_RECORD_SIZE);
             
-            // Escribir postings
-            current = index->entries[i].head;
-            while (current) {
-                PostingHeader posting_header;
-                posting_header.doc_id = current->posting.doc_id;
-                posting_header.position_count = (uint32_t)current->posting.position_count;
-                
-                fwrite(&posting_header, sizeof(PostingHeader), 1, file);
-                fwrite(current->posting.positions, sizeof(size_t), 
-                       current->posting.position_count, file);
-                
-                current = current->next;
+            // Posiciones como u32 por tandas
+            size_t filled = 0;
+            for (size_t j = 0; j < current->posting.position_count; j++) {
+                if (current->posting.positions[j] > UINT32_MAX) w.failed = 1;
+                putLE32(positions + filled, (uint32_t)current->posting.positions[j]);
+                filled += 4;
+                if (filled == sizeof(positions)) {
+                    writerWrite(&w, positions, filled);
+                    filled = 0;
+                }
             }
+            writerWrite(&w, positions, filled);
+            
+            current = current->next;
         }
     }
     
+    // El índice directo usa la posición de cada término en el diccionario
+    ForwardIndex forward = {0};
+    uint32_t *order = malloc((index->size + 1) * sizeof(uint32_t));
+    if (!order) w.failed = 1;
+    for (size_t i = 0; order && sorted && i < index->size; i++) {
+        order[i] = (uint32_t)(sorted[i] - index->entries);
+    }
+    if (order && buildForwardIndex(index, order, sorted ? index->size : 0, &forward) != 0) {
+        w.failed = 1;
+    }
+    free(order);
+    free(sorted);
+    
+    // La tabla de documentos empieza en un bloque nuevo
+    writerEndBlock(&w);
+    ChecksumTrailer trailer = {0};
+    trailer.magic = INDEX_CHECKSUM_MAGIC;
+    trailer.block_size = INDEX_BLOCK_SIZE;
+    trailer.terms_blocks = (uint32_t)w.count;
+    trailer.documents_offset = w.offset;
+    
     // Escribir información de documentos
     for (size_t i = 0; i < collection->count; i++) {
         DocumentHeader doc_header;
@@ -77,35 +483,541 @@ int saveIndexToBinary(const InvertedIndex *index, const DocumentCollection *coll
         doc_header.title_length = collection->docs[i].title ? 
                                   (uint32_t)strlen(collection->docs[i].title) + 1 : 0;
         doc_header.word_count = collection->docs[i].word_count;
+        doc_header.file_size = collection->docs[i].file_size;
+        doc_header.mtime = collection->docs[i].mtime;
+        doc_header.content_hash = collection->docs[i].content_hash;
         
-        fwrite(&doc_header, sizeof(DocumentHeader), 1, file);
-        fwrite(collection->docs[i].filename, doc_header.filename_length, 1, file);
+        putLE32(record, doc_header.doc_id);
+        putLE32(record + 4, doc_header.filename_length);
+        putLE32(record + 8, doc_header.title_length);
+        putLE64(record + 12, doc_header.word_count);
+        putLE64(record + 20, doc_header.file_size);
+        putLE64(record + 28, (uint64_t)doc_header.mtime);
+        putLE64(record + 36, doc_header.content_hash);
+        writerWrite(&w, record, INDEX_DOCUMENT_RECORD_SIZE);
+        writerWrite(&w, collection->docs[i].filename, doc_header.filename_length);
         
         if (doc_header.title_length > 0) {
-            fwrite(collection->docs[i].title, doc_header.title_length, 1, file);
+            writerWrite(&w, collection->docs[i].title, doc_header.title_length);
         }
     }
+    writeForwardIndex(&w, &forward, collection);
+    freeForwardIndex(&forward);
+    writerEndBlock(&w);
     
-    // Calcular y escribir checksum (simplificado)
-    long file_size = ftell(file);
-    header.checksum = (uint64_t)file_size; // Checksum simple basado en tamaño
-    fseek(file, 0, SEEK_SET);
-    fwrite(&header, sizeof(IndexFileHeader), 1, file);
+    // Checksums: trailer + tabla de CRC por bloque; el header se reescribe
+    // con su offset y su propio CRC queda en el trailer
+    header.checksum_offset = w.offset;
+    trailer.block_count = (uint32_t)w.count;
+    encodeHeader(&header, raw_header);
+    trailer.header_crc = crc32c(0, raw_header, INDEX_HEADER_SIZE);
     
-    fclose(file);
+    unsigned char raw_trailer[INDEX_TRAILER_SIZE];
+    unsigned char *raw_crcs = malloc(w.count * 4 + 1);
+    if (!raw_crcs) w.failed = 1;
+    for (size_t i = 0; raw_crcs && i < w.count; i++) putLE32(raw_crcs + i * 4, w.crcs[i]);
+    encodeTrailer(&trailer, raw_trailer);
+    if (raw_crcs) {
+        trailer.trailer_crc = crc32c(crc32c(0, raw_trailer, INDEX_TRAILER_SIZE), raw_crcs, w.count * 4);
+        encodeTrailer(&trailer, raw_trailer);
+        writerWriteRaw(&w, raw_trailer, INDEX_TRAILER_SIZE);
+        writerWriteRaw(&w, raw_crcs, w.count * 4);
+    }
+    free(raw_crcs);
+    writerFlush(&w);
+    uint64_t file_size = w.offset;
+    if (pwrite(w.fd, raw_header, INDEX_HEADER_SIZE, 0) != INDEX_HEADER_SIZE) {
+        w.failed = 1;
+    }
+    if (fsync(w.fd) != 0) w.failed = 1;
+    if (close(w.fd) != 0) w.failed = 1;
+    free(w.buffer);
+    free(w.crcs);
+    
+    if (w.failed || rename(tmp_path, filename) != 0) {
+        fprintf(stderr, "saveIndexToBinary: Error al escribir %s: %s\n", filename, strerror(errno));
+        unlink(tmp_path);
+        return -1;
+    }
+    syncParentDirectory(filename);
     
     printf("Índice guardado en formato binario: %s\n", filename);
-    printf("Términos: %u, Documentos: %u, Tamaño: %ld bytes\n", 
-           header.num_terms, header.num_documents, file_size);
+    printf("Términos: %u, Documentos: %u, Tamaño: %llu bytes\n", 
+           header.num_terms, header.num_documents, (unsigned long long)file_size);
     
     return 0;
 }
 
-// Cargar índice desde formato binario
-int loadIndexFromBinary(InvertedIndex **index, DocumentCollection **collection, 
-                        const char *filename) {
-    if (!index || !collection || !filename) return -1;
+// Leer y validar el header de un archivo de índice o segmento
+int readIndexHeader(const char *filename, IndexFileHeader *header) {
+    if (!filename || !header) return -1;
     
+    FILE *file = fopen(filename, "rb");
+    if (!file) return -1;
+    
+    unsigned char raw[INDEX_HEADER_SIZE];
+    int read = readRawHeader(file, raw, header);
+    fclose(file);
+    if (read != 0) {
+        fprintf(stderr, "Error al leer header de %s\n", filename);
+        return -1;
+    }
+    if (header->magic != INDEX_FILE_MAGIC) {
+        fprintf(stderr, "%s no es un índice válido (magic number incorrecto)\n", filename);
+        return -1;
+    }
+    if (header->version < INDEX_FILE_VERSION_MIN || header->version > INDEX_FILE_VERSION) {
+        fprintf(stderr, "Versión del archivo no soportada: %u\n", header->version);
+        return -1;
+    }
+    return 0;
+}
+
+// Lectura por bloques: cada bloque se comprueba contra su CRC la primera
+// vez que se accede a él, así que lo que nunca se lee no se verifica.
+// Los archivos anteriores a la versión 3 se leen igual pero sin CRC.
+typedef struct {
+    FILE *file;
+    const char *filename;
+    unsigned char *block;
+    uint64_t block_start;
+    size_t block_len;
+    size_t block_index;
+    int loaded;
+    uint64_t pos;              // Offset en el archivo del próximo byte
+    uint64_t body_start;
+    uint64_t documents_offset;
+    uint64_t body_end;
+    size_t block_size;
+    size_t terms_blocks;
+    uint32_t *crcs;            // NULL: archivo sin checksums
+    size_t block_count;
+    uint32_t version;
+} IndexReader;
+
+// Lee el trailer de checksums y su tabla; 0 si son válidos. Los CRC se
+// calculan sobre los bytes tal como están en disco.
+static int readChecksumTrailer(FILE *file, const unsigned char *raw_header,
+                               const IndexFileHeader *header,
+                               ChecksumTrailer *trailer, uint32_t **crcs) {
+    *crcs = NULL;
+    unsigned char raw_trailer[INDEX_TRAILER_SIZE];
+    if (fseeko(file, (off_t)header->checksum_offset, SEEK_SET) != 0 ||
+        fread(raw_trailer, 1, INDEX_TRAILER_SIZE, file) != INDEX_TRAILER_SIZE) {
+        return -1;
+    }
+    decodeTrailer(raw_trailer, trailer);
+    if (trailer->magic != INDEX_CHECKSUM_MAGIC || trailer->block_size == 0 ||
+        trailer->terms_blocks > trailer->block_count ||
+        trailer->block_count > header->checksum_offset) {
+        return -1;
+    }
+    
+    size_t table_size = (size_t)trailer->block_count * 4;
+    unsigned char *raw_crcs = malloc(table_size + 1);
+    *crcs = malloc((trailer->block_count + 1) * sizeof(uint32_t));
+    if (!raw_crcs || !*crcs || fread(raw_crcs, 1, table_size, file) != table_size) {
+        free(raw_crcs);
+        free(*crcs);
+        *crcs = NULL;
+        return -1;
+    }
+    
+    putLE32(raw_trailer + 28, 0);
+    uint32_t crc = crc32c(crc32c(0, raw_trailer, INDEX_TRAILER_SIZE), raw_crcs, table_size);
+    for (size_t i = 0; i < trailer->block_count; i++) (*crcs)[i] = getLE32(raw_crcs + i * 4);
+    free(raw_crcs);
+    if (crc != trailer->trailer_crc ||
+        crc32c(0, raw_header, headerSize(header->version)) != trailer->header_crc) {
+        free(*crcs);
+        *crcs = NULL;
+        return -1;
+    }
+    return 0;
+}
+
+static int readerOpen(IndexReader *r, FILE *file, const char *filename,
+                      const unsigned char *raw_header, const IndexFileHeader *header) {
+    memset(r, 0, sizeof(*r));
+    r->file = file;
+    r->filename = filename;
+    r->version = header->version;
+    r->body_start = headerSize(header->version);
+    r->pos = r->body_start;
+    r->block_size = INDEX_BLOCK_SIZE;
+    
+    if (header->version >= INDEX_CHECKSUM_VERSION) {
+        ChecksumTrailer trailer;
+        if (readChecksumTrailer(file, raw_header, header, &trailer, &r->crcs) != 0) {
+            fprintf(stderr, "%s: header o checksums dañados\n", filename);
+            return -1;
+        }
+        r->block_size = trailer.block_size;
+        r->documents_offset = trailer.documents_offset;
+        r->body_end = header->checksum_offset;
+        r->terms_blocks = trailer.terms_blocks;
+        r->block_count = trailer.block_count;
+    } else {
+        if (fseeko(file, 0, SEEK_END) != 0) return -1;
+        r->body_end = r->documents_offset = (uint64_t)ftello(file);
+    }
+    
+    r->block = malloc(r->block_size);
+    if (!r->block) {
+        free(r->crcs);
+        return -1;
+    }
+    return 0;
+}
+
+static void readerClose(IndexReader *r) {
+    free(r->block);
+    free(r->crcs);
+}
+
+// Carga (y verifica) el bloque que contiene r->pos
+static int readerLoadBlock(IndexReader *r) {
+    if (r->pos >= r->body_end) return -1;
+    
+    size_t index;
+    uint64_t start, end;
+    if (r->pos < r->documents_offset) {
+        index = (size_t)((r->pos - r->body_start) / r->block_size);
+        start = r->body_start + (uint64_t)index * r->block_size;
+        end = r->documents_offset;
+    } else {
+        size_t local = (size_t)((r->pos - r->documents_offset) / r->block_size);
+        index = r->terms_blocks + local;
+        start = r->documents_offset + (uint64_t)local * r->block_size;
+        end = r->body_end;
+    }
+    if (end - start > r->block_size) end = start + r->block_size;
+    size_t len = (size_t)(end - start);
+    
+    if (fseeko(r->file, (off_t)start, SEEK_SET) != 0 ||
+        fread(r->block, 1, len, r->file) != len) {
+        return -1;
+    }
+    if (r->crcs && (index >= r->block_count || crc32c(0, r->block, len) != r->crcs[index])) {
+        fprintf(stderr, "%s: bloque %zu dañado (offset %llu)\n",
+                r->filename, index, (unsigned long long)start);
+        return -1;
+    }
+    r->block_start = start;
+    r->block_len = len;
+    r->block_index = index;
+    r->loaded = 1;
+    return 0;
+}
+
+// Como fread(dst, len, 1, file): 1 si se leyó todo, 0 si no
+static size_t readerRead(IndexReader *r, void *dst, size_t len) {
+    unsigned char *out = dst;
+    while (len > 0) {
+        if (!r->loaded || r->pos < r->block_start || r->pos >= r->block_start + r->block_len) {
+            if (readerLoadBlock(r) != 0) return 0;
+        }
+        size_t offset = (size_t)(r->pos - r->block_start);
+        size_t take = r->block_len - offset;
+        if (take > len) take = len;
+        memcpy(out, r->block + offset, take);
+        out += take;
+        r->pos += take;
+        len -= take;
+    }
+    return 1;
+}
+
+// Saltar la sección de términos sin reconstruir el índice
+static int skipTerms(IndexReader *r, uint32_t num_terms) {
+    if (r->crcs) {
+        r->pos = r->documents_offset;
+        return 0;
+    }
+    unsigned char record[INDEX_TERM_RECORD_SIZE];
+    for (uint32_t t = 0; t < num_terms; t++) {
+        TermHeader term_header;
+        if (!readerRead(r, record, INDEX_TERM_RECORD_SIZE)) return -1;
+        decodeTermRecord(record, &term_header);
+        r->pos += term_header.term_length;
+        for (uint32_t p = 0; p < term_header.posting_count; p++) {
+            PostingHeader posting_header;
+            if (!readerRead(r, record, INDEX_POSTING_RECORD_SIZE)) return -1;
+            decodePostingRecord(record, &posting_header);
+            r->pos += positionSize(r->version) * posting_header.position_count;
+        }
+    }
+    return 0;
+}
+
+// Lee los postings de un término y los agrega al índice (salvo documentos
+// borrados). Con index == NULL solo los salta.
+static int readPostings(IndexReader *r, InvertedIndex *index, const char *term,
+                        uint32_t posting_count, const TombstoneSet *deleted,
+                        unsigned char **raw_positions, size_t *raw_capacity) {
+    size_t position_size = positionSize(r->version);
+    unsigned char record[INDEX_POSTING_RECORD_SIZE];
+    // Se interna una vez por término, no por posición
+    uint32_t term_id = index ? internTerm(&index->terms, term, strlen(term)) : TERM_ID_NONE;
+    for (uint32_t p = 0; p < posting_count; p++) {
+        PostingHeader posting_header;
+        if (!readerRead(r, record, INDEX_POSTING_RECORD_SIZE)) {
+            fprintf(stderr, "Error al leer posting %u del término %s\n", p, term);
+            return -1;
+        }
+        decodePostingRecord(record, &posting_header);
+        
+        size_t raw_size = position_size * posting_header.position_count;
+        if (!index || isTombstoned(deleted, posting_header.doc_id)) {
+            r->pos += raw_size;
+            continue;
+        }
+        
+        // Leer posiciones (u32, o u64 en las versiones antiguas)
+        if (raw_size > *raw_capacity) {
+            unsigned char *grown = realloc(*raw_positions, raw_size);
+            if (!grown) return -1;
+            *raw_positions = grown;
+            *raw_capacity = raw_size;
+        }
+        if (!readerRead(r, *raw_positions, raw_size)) {
+            fprintf(stderr, "Error al leer posiciones del posting %u del término %s\n", p, term);
+            return -1;
+        }
+        
+        for (uint32_t pos = 0; pos < posting_header.position_count; pos++) {
+            const unsigned char *raw = *raw_positions + (size_t)pos * position_size;
+            size_t position = position_size == 4 ? getLE32(raw) : (size_t)getLE64(raw);
+            addTermIdToIndex(index, term_id, posting_header.doc_id, position);
+        }
+    }
+    return 0;
+}
+
+// Como readerRead para un varint LEB128
+static size_t readerReadVarint(IndexReader *r, uint64_t *value) {
+    *value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        unsigned char byte;
+        if (!readerRead(r, &byte, 1)) return 0;
+        *value |= (uint64_t)(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) return 1;
+    }
+    return 0;
+}
+
+// Recorrido del diccionario: el término se reconstruye sobre el anterior
+typedef struct {
+    char *term;
+    size_t length;
+    size_t capacity;
+    uint64_t doc_frequency;
+    uint64_t posting_count;
+    uint64_t postings_bytes;
+} DictionaryCursor;
+
+static int readDictionaryEntry(IndexReader *r, DictionaryCursor *c, uint64_t entries_size) {
+    uint64_t shared, suffix;
+    if (!readerReadVarint(r, &shared) || !readerReadVarint(r, &suffix) ||
+        shared > c->length || suffix > entries_size) {
+        return -1;
+    }
+    size_t length = (size_t)(shared + suffix);
+    if (length + 1 > c->capacity) {
+        size_t capacity = c->capacity ? c->capacity : 64;
+        while (capacity < length + 1) capacity *= 2;
+        char *grown = realloc(c->term, capacity);
+        if (!grown) return -1;
+        c->term = grown;
+        c->capacity = capacity;
+    }
+    if (!readerRead(r, c->term + shared, (size_t)suffix) ||
+        !readerReadVarint(r, &c->doc_frequency) || !readerReadVarint(r, &c->posting_count) ||
+        !readerReadVarint(r, &c->postings_bytes) || c->posting_count > UINT32_MAX) {
+        return -1;
+    }
+    c->term[length] = '\0';
+    c->length = length;
+    return 0;
+}
+
+typedef struct {
+    char *term;
+    uint32_t posting_count;
+    uint64_t postings_offset;
+} TermLocation;
+
+// Término completo del reinicio k (offsets de la tabla ya decodificados)
+static int readRestartTerm(IndexReader *r, DictionaryCursor *c, uint64_t entries_start,
+                           uint64_t entries_size, const unsigned char *restarts, size_t k) {
+    r->pos = entries_start + getLE32(restarts + k * INDEX_RESTART_RECORD_SIZE);
+    c->length = 0;
+    return readDictionaryEntry(r, c, entries_size);
+}
+
+// Recorre el diccionario (o solo la región de la consulta, empezando en el
+// último reinicio que no la supera) y anota dónde están los postings de cada
+// término elegido. Los postings se leen después, en orden de offset.
+static int collectDictionaryTerms(IndexReader *r, uint32_t num_terms, const TermQuery *query,
+                                  TermLocation **out, size_t *count) {
+    *out = NULL;
+    *count = 0;
+    unsigned char raw[INDEX_DICTIONARY_HEADER_SIZE];
+    r->pos = r->body_start;
+    if (!readerRead(r, raw, INDEX_DICTIONARY_HEADER_SIZE)) return -1;
+    uint32_t interval = getLE32(raw);
+    uint32_t restart_count = getLE32(raw + 4);
+    uint64_t entries_size = getLE64(raw + 8);
+    uint64_t postings_start = getLE64(raw + 16);
+    uint64_t entries_start = r->pos;
+    if (interval == 0 || restart_count != (num_terms + interval - 1) / interval) return -1;
+    
+    DictionaryCursor cursor = {0};
+    uint64_t entry_pos = entries_start, postings_pos = postings_start;
+    size_t first = 0;
+    if (query) {
+        size_t table_size = (size_t)restart_count * INDEX_RESTART_RECORD_SIZE;
+        unsigned char *restarts = malloc(table_size + 1);
+        r->pos = entries_start + entries_size;
+        if (!restarts || !readerRead(r, restarts, table_size)) {
+            free(restarts);
+            return -1;
+        }
+        // Búsqueda binaria: primer reinicio con término mayor que el inicio
+        const char *start = termQueryStart(query);
+        size_t lo = 0, hi = restart_count;
+        while (lo < hi) {
+            size_t mid = lo + (hi - lo) / 2;
+            if (readRestartTerm(r, &cursor, entries_start, entries_size, restarts, mid) != 0) {
+                free(restarts);
+                free(cursor.term);
+                return -1;
+            }
+            if (strcmp(cursor.term, start) <= 0) lo = mid + 1;
+            else hi = mid;
+        }
+        first = lo ? lo - 1 : 0;
+        entry_pos = entries_start + getLE32(restarts + first * INDEX_RESTART_RECORD_SIZE);
+        postings_pos = postings_start + getLE64(restarts + first * INDEX_RESTART_RECORD_SIZE + 4);
+        free(restarts);
+    }
+    
+    size_t capacity = 0;
+    int result = 0;
+    r->pos = entry_pos;
+    cursor.length = 0;
+    for (size_t t = first * interval; t < num_terms; t++) {
+        if (readDictionaryEntry(r, &cursor, entries_size) != 0) {
+            result = -1;
+            break;
+        }
+        uint64_t offset = postings_pos;
+        postings_pos += cursor.postings_bytes;
+        if (query) {
+            if (strcmp(cursor.term, termQueryStart(query)) < 0) continue;
+            if (termQueryPastEnd(query, cursor.term)) break;
+            if (!termQueryMatches(query, cursor.term)) continue;
+        }
+        
+        if (*count == capacity) {
+            capacity = capacity ? capacity * 2 : (query ? 16 : num_terms);
+            TermLocation *grown = realloc(*out, capacity * sizeof(TermLocation));
+            if (!grown) {
+                result = -1;
+                break;
+            }
+            *out = grown;
+        }
+        TermLocation *location = &(*out)[*count];
+        location->term = strdup(cursor.term);
+        location->posting_count = (uint32_t)cursor.posting_count;
+        location->postings_offset = offset;
+        if (!location->term) {
+            result = -1;
+            break;
+        }
+        (*count)++;
+    }
+    free(cursor.term);
+    return result;
+}
+
+// Con term_ids (solo sin consulta) anota el id en memoria de cada posición
+// del diccionario, para traducir el índice directo
+static int loadDictionaryTerms(IndexReader *r, InvertedIndex *index, uint32_t num_terms,
+                               const TermQuery *query, const TombstoneSet *deleted,
+                               uint32_t *term_ids,
+                               unsigned char **raw_positions, size_t *raw_capacity) {
+    TermLocation *locations;
+    size_t count;
+    int result = collectDictionaryTerms(r, num_terms, query, &locations, &count);
+    for (size_t i = 0; i < count; i++) {
+        if (result == 0 && term_ids) {
+            term_ids[i] = internTerm(&index->terms, locations[i].term, strlen(locations[i].term));
+        }
+        if (result == 0) {
+            r->pos = locations[i].postings_offset;
+            result = readPostings(r, index, locations[i].term, locations[i].posting_count,
+                                  deleted, raw_positions, raw_capacity);
+        }
+        free(locations[i].term);
+    }
+    free(locations);
+    return result;
+}
+
+// Lee el índice directo de un archivo: un vector por documento de doc_ids,
+// traduciendo las posiciones del diccionario con term_ids
+static int readForwardIndex(IndexReader *r, ForwardIndex *forward, const uint32_t *doc_ids,
+                            uint32_t num_documents, const uint32_t *term_ids,
+                            uint32_t num_terms, const TombstoneSet *deleted) {
+    for (uint32_t d = 0; d < num_documents; d++) {
+        uint64_t length;
+        if (!readerReadVarint(r, &length) || length > num_terms) return -1;
+        
+        TermVector *vector = NULL;
+        if (!isTombstoned(deleted, doc_ids[d])) {
+            vector = forwardSlot(forward, doc_ids[d]);
+            if (!vector) return -1;
+            freeTermVector(vector);
+            vector->ids = malloc((size_t)length * sizeof(uint32_t) + 1);
+            vector->counts = malloc((size_t)length * sizeof(uint32_t) + 1);
+            if (!vector->ids || !vector->counts) return -1;
+        }
+        
+        uint64_t ordinal = 0;
+        int sorted = 1;
+        for (uint64_t j = 0; j < length; j++) {
+            uint64_t delta, frequency;
+            if (!readerReadVarint(r, &delta) || !readerReadVarint(r, &frequency) ||
+                (j > 0 && delta == 0) || ordinal + delta >= num_terms ||
+                frequency > UINT32_MAX) {
+                return -1;
+            }
+            ordinal += delta;
+            if (!vector) continue;
+            uint32_t id = term_ids[ordinal];
+            if (j > 0 && id <= vector->ids[j - 1]) sorted = 0;
+            vector->ids[j] = id;
+            vector->counts[j] = (uint32_t)frequency;
+            vector->total += frequency;
+        }
+        if (!vector) continue;
+        vector->length = (size_t)length;
+        // Con segmentos, los términos nuevos de un archivo pueden tener ids
+        // que no siguen el orden de su diccionario
+        if (!sorted) sortTermVector(vector);
+    }
+    return 0;
+}
+
+// Cargar un archivo (índice base o segmento) en estructuras ya creadas.
+// Con index == NULL solo se leen los documentos.
+// Con query solo se cargan los términos que la cumplen.
+// Con forward (sin query) se carga también su índice directo.
+static int loadFileInto(InvertedIndex *index, DocumentCollection *collection,
+                        const char *filename, const TombstoneSet *deleted,
+                        const TermQuery *query, ForwardIndex *forward) {
     FILE *file = fopen(filename, "rb");
     if (!file) {
         perror("loadIndexFromBinary: Error al abrir archivo");
@@ -114,7 +1026,8 @@ int loadIndexFromBinary(InvertedIndex **index, DocumentCollection **collection,
     
     // Leer header
     IndexFileHeader header;
-    if (fread(&header, sizeof(IndexFileHeader), 1, file) != 1) {
+    unsigned char raw_header[INDEX_HEADER_SIZE];
+    if (readRawHeader(file, raw_header, &header) != 0) {
         fprintf(stderr, "Error al leer header del archivo\n");
         fclose(file);
         return -1;
@@ -127,83 +1040,92 @@ int loadIndexFromBinary(InvertedIndex **index, DocumentCollection **collection,
         return -1;
     }
     
-    if (header.version != INDEX_FILE_VERSION) {
+    if (header.version < INDEX_FILE_VERSION_MIN || header.version > INDEX_FILE_VERSION) {
         fprintf(stderr, "Versión del archivo no soportada: %u\n", header.version);
         fclose(file);
         return -1;
     }
     
-    // Crear estructuras
-    *index = createIndex(header.num_terms * 2); // Factor de carga del 50%
-    if (!*index) {
+    IndexReader reader;
+    if (readerOpen(&reader, file, filename, raw_header, &header) != 0) {
         fclose(file);
         return -1;
     }
-    
-    *collection = createDocumentCollection(header.num_documents);
-    if (!*collection) {
-        destroyIndex(*index);
-        fclose(file);
-        return -1;
+    IndexReader *r = &reader;
+    unsigned char record[INDEX_DOCUMENT_RECORD_SIZE + 8];
+    unsigned char *raw_positions = NULL;
+    size_t raw_capacity = 0;
+    uint32_t num_terms = header.num_terms;
+    uint32_t *term_ids = NULL;
+    uint32_t *doc_ids = NULL;
+    if (!index || query || header.version < INDEX_FORWARD_VERSION) forward = NULL;
+    if (forward) {
+        term_ids = malloc(((size_t)num_terms + 1) * sizeof(uint32_t));
+        doc_ids = malloc(((size_t)header.num_documents + 1) * sizeof(uint32_t));
+        if (!term_ids || !doc_ids) goto error_cleanup;
     }
     
-    (*index)->next_doc_id = header.next_doc_id;
+    if (!index) {
+        if (skipTerms(r, header.num_terms) != 0) {
+            fprintf(stderr, "Error al leer términos de %s\n", filename);
+            goto error_cleanup;
+        }
+        header.num_terms = 0;
+    } else {
+        if (header.next_doc_id > index->next_doc_id) index->next_doc_id = header.next_doc_id;
+        if (header.generation > index->generation) index->generation = header.generation;
+        // Los segmentos heredan la configuración de la base
+        if (header.analysis) decodeAnalysis(header.analysis, &index->analysis);
+        if (header.build_id) index->build_id = header.build_id;
+    }
     
-    // Leer términos
+    // Leer términos: desde la versión 5 a través del diccionario; antes,
+    // registros con el término seguido de sus postings
+    if (header.version >= INDEX_DICTIONARY_VERSION && header.num_terms > 0) {
+        if (loadDictionaryTerms(r, index, header.num_terms, query, deleted, term_ids,
+                                &raw_positions, &raw_capacity) != 0) {
+            fprintf(stderr, "Error al leer el diccionario de %s\n", filename);
+            goto error_cleanup;
+        }
+        r->pos = r->documents_offset;
+        header.num_terms = 0;
+    }
     for (uint32_t t = 0; t < header.num_terms; t++) {
         TermHeader term_header;
-        if (fread(&term_header, sizeof(TermHeader), 1, file) != 1) {
+        if (!readerRead(r, record, INDEX_TERM_RECORD_SIZE)) {
             fprintf(stderr, "Error al leer header de término %u\n", t);
             goto error_cleanup;
         }
+        decodeTermRecord(record, &term_header);
         
         char *term = malloc(term_header.term_length);
-        if (!term || fread(term, term_header.term_length, 1, file) != 1) {
+        if (!term || !readerRead(r, term, term_header.term_length)) {
             free(term);
             fprintf(stderr, "Error al leer término %u\n", t);
             goto error_cleanup;
         }
         
-        // Leer postings
-        for (uint32_t p = 0; p < term_header.posting_count; p++) {
-            PostingHeader posting_header;
-            if (fread(&posting_header, sizeof(PostingHeader), 1, file) != 1) {
-                free(term);
-                fprintf(stderr, "Error al leer posting %u del término %u\n", p, t);
-                goto error_cleanup;
-            }
-            
-            // Leer posiciones
-            size_t *positions = malloc(sizeof(size_t) * posting_header.position_count);
-            if (!positions || fread(positions, sizeof(size_t), posting_header.position_count, file) != posting_header.position_count) {
-                free(positions);
-                free(term);
-                fprintf(stderr, "Error al leer posiciones del posting %u del término %u\n", p, t);
-                goto error_cleanup;
-            }
-            
-            // Agregar al índice
-            for (uint32_t pos = 0; pos < posting_header.position_count; pos++) {
-                addTermToIndex(*index, term, posting_header.doc_id, positions[pos]);
-            }
-            
-            free(positions);
-        }
-        
+        // Sin diccionario ordenado la consulta filtra término a término
+        int keep = !query || termQueryMatches(query, term);
+        int failed = readPostings(r, keep ? index : NULL, term, term_header.posting_count,
+                                  deleted, &raw_positions, &raw_capacity);
         free(term);
+        if (failed) goto error_cleanup;
     }
     
     // Cargar documentos
     for (uint32_t d = 0; d < header.num_documents; d++) {
         DocumentHeader doc_header;
-        if (fread(&doc_header, sizeof(DocumentHeader), 1, file) != 1) {
+        if (!readerRead(r, record, documentRecordSize(header.version))) {
             fprintf(stderr, "Error al leer header de documento %u\n", d);
             goto error_cleanup;
         }
+        decodeDocumentRecord(record, header.version, &doc_header);
+        if (doc_ids) doc_ids[d] = doc_header.doc_id;
         
         // Leer filename
         char *filename_str = malloc(doc_header.filename_length);
-        if (!filename_str || fread(filename_str, doc_header.filename_length, 1, file) != 1) {
+        if (!filename_str || !readerRead(r, filename_str, doc_header.filename_length)) {
             free(filename_str);
             fprintf(stderr, "Error al leer filename de documento %u\n", d);
             goto error_cleanup;
@@ -213,7 +1135,7 @@ int loadIndexFromBinary(InvertedIndex **index, DocumentCollection **collection,
         char *title = NULL;
         if (doc_header.title_length > 0) {
             title = malloc(doc_header.title_length);
-            if (!title || fread(title, doc_header.title_length, 1, file) != 1) {
+            if (!title || !readerRead(r, title, doc_header.title_length)) {
                 free(filename_str);
                 free(title);
                 fprintf(stderr, "Error al leer título de documento %u\n", d);
@@ -221,37 +1143,231 @@ int loadIndexFromBinary(InvertedIndex **index, DocumentCollection **collection,
             }
         }
         
-        // Agregar documento a la colección (asegurar que no exceda la capacidad)
-        if ((*collection)->count < (*collection)->capacity) {
-            DocumentInfo doc;
-            doc.doc_id = doc_header.doc_id;
-            doc.filename = strdup(filename_str);
-            doc.title = title ? strdup(title) : NULL;
-            doc.word_count = doc_header.word_count;
-            
-            (*collection)->docs[(*collection)->count++] = doc;
-        }
+        // Agregar documento a la colección (la colección se queda con las cadenas)
+        DocumentInfo doc;
+        doc.doc_id = doc_header.doc_id;
+        doc.filename = filename_str;
+        doc.title = title;
+        doc.word_count = doc_header.word_count;
+        doc.file_size = doc_header.file_size;
+        doc.mtime = doc_header.mtime;
+        doc.content_hash = doc_header.content_hash;
         
-        free(filename_str);
-        if (title) free(title);
+        if (isTombstoned(deleted, doc_header.doc_id) ||
+            !appendDocumentInfo(collection, &doc)) {
+            free(filename_str);
+            free(title);
+        }
     }
     
-    fclose(file);
-    
-    printf("Índice cargado desde formato binario: %s\n", filename);
-    printf("Términos: %u, Documentos: %u\n", header.num_terms, header.num_documents);
+    if (forward && readForwardIndex(r, forward, doc_ids, header.num_documents,
+                                    term_ids, num_terms, deleted) != 0) {
+        fprintf(stderr, "Error al leer el índice directo de %s\n", filename);
+        goto error_cleanup;
+    }
     
+    free(term_ids);
+    free(doc_ids);
+    free(raw_positions);
+    readerClose(r);
+    fclose(file);
     return 0;
     
 error_cleanup:
-    destroyIndex(*index);
-    destroyDocumentCollection(*collection);
-    *index = NULL;
-    *collection = NULL;
+    free(term_ids);
+    free(doc_ids);
+    free(raw_positions);
+    readerClose(r);
     fclose(file);
     return -1;
 }
 
+// Cargar varios archivos (base y segmentos) en un solo índice en memoria.
+// Los doc IDs son globales, así que la unión conserva los postings ordenados.
+static int loadFilesMatching(InvertedIndex **index, DocumentCollection **collection,
+                             const char *const *paths, size_t count,
+                             const TombstoneSet *deleted, const TermQuery *query) {
+    if (!index || !collection || !paths || count == 0) return -1;
+    
+    // Dimensionar con la suma de los headers para no redimensionar al cargar
+    size_t total_terms = 0, total_docs = 0;
+    int all_forward = 1;
+    for (size_t i = 0; i < count; i++) {
+        IndexFileHeader header;
+        if (readIndexHeader(paths[i], &header) != 0) {
+            perror("loadIndexFromBinary: Error al abrir archivo");
+            return -1;
+        }
+        total_terms += header.num_terms;
+        total_docs += header.num_documents;
+        if (header.version < INDEX_FORWARD_VERSION) all_forward = 0;
+    }
+    
+    *index = createIndex(total_terms);
+    if (!*index) return -1;
+    (*index)->next_doc_id = 1;
+    
+    *collection = createDocumentCollection(total_docs);
+    if (!*collection) {
+        destroyIndex(*index);
+        *index = NULL;
+        return -1;
+    }
+    
+    ForwardIndex *forward = query ? NULL : &(*index)->forward;
+    for (size_t i = 0; i < count; i++) {
+        if (loadFileInto(*index, *collection, paths[i], deleted, query, forward) != 0) {
+            destroyIndex(*index);
+            destroyDocumentCollection(*collection);
+            *index = NULL;
+            *collection = NULL;
+            return -1;
+        }
+    }
+    
+    // Si algún archivo es anterior a la versión 6, el índice directo se
+    // reconstruye entero desde los postings
+    if (forward && !all_forward) {
+        freeForwardIndex(forward);
+        if (buildForwardIndex(*index, NULL, 0, forward) != 0) {
+            destroyIndex(*index);
+            destroyDocumentCollection(*collection);
+            *index = NULL;
+            *collection = NULL;
+            return -1;
+        }
+    }
+    return 0;
+}
+
+int loadIndexFiles(InvertedIndex **index, DocumentCollection **collection,
+                   const char *const *paths, size_t count, const TombstoneSet *deleted) {
+    return loadFilesMatching(index, collection, paths, count, deleted, NULL);
+}
+
+static void freeIndexFileList(char **paths, size_t count) {
+    for (size_t i = 0; i < count; i++) free(paths[i]);
+    free(paths);
+}
+
+// Rutas de la base y de sus segmentos vivos, leídas del manifiesto
+static char** collectIndexFiles(const char *filename, size_t *count) {
+    IndexFileHeader header;
+    if (readIndexHeader(filename, &header) != 0) {
+        if (errno == ENOENT) perror("loadIndexFromBinary: Error al abrir archivo");
+        return NULL;
+    }
+    
+    // Un segmento puede desaparecer si una fusión termina mientras se lee el
+    // manifiesto; en ese caso se relee una vez
+    for (int attempt = 0; attempt < 2; attempt++) {
+        SegmentManifest manifest;
+        if (loadSegmentManifest(filename, &manifest) != 0) return NULL;
+        
+        char **paths = malloc((manifest.count + 1) * sizeof(char*));
+        if (!paths) {
+            freeSegmentManifest(&manifest);
+            return NULL;
+        }
+        *count = 0;
+        paths[(*count)++] = strdup(filename);
+        for (size_t i = 0; i < manifest.count; i++) {
+            char path[1024];
+            buildSegmentPath(filename, manifest.segments[i].name, path, sizeof(path));
+            // Segmentos ya absorbidos por una compactación en curso
+            IndexFileHeader seg_header;
+            if (readIndexHeader(path, &seg_header) == 0 &&
+                seg_header.next_doc_id <= header.next_doc_id) continue;
+            paths[(*count)++] = strdup(path);
+        }
+        freeSegmentManifest(&manifest);
+        
+        int missing = 0;
+        for (size_t i = 1; i < *count; i++) {
+            if (access(paths[i], F_OK) != 0) missing = 1;
+        }
+        if (!missing || attempt == 1) return paths;
+        freeIndexFileList(paths, *count);
+    }
+    return NULL;
+}
+
+// Base, segmentos y tombstones; devuelve el número de archivos cargados
+// (0 si hubo error)
+static size_t loadIndexMatching(InvertedIndex **index, DocumentCollection **collection,
+                                const char *filename, const TermQuery *query) {
+    // La generación se lee antes que los datos: si cambian durante la carga,
+    // lo cargado queda asociado a una generación ya vieja y no a una futura
+    uint32_t generation = indexGeneration(filename);
+    size_t count = 0;
+    char **paths = collectIndexFiles(filename, &count);
+    if (!paths) return 0;
+    
+    TombstoneSet deleted;
+    int result = loadTombstones(filename, &deleted);
+    if (result == 0) {
+        result = loadFilesMatching(index, collection, (const char *const *)paths, count,
+                                   &deleted, query);
+        freeTombstones(&deleted);
+    }
+    freeIndexFileList(paths, count);
+    
+    if (result != 0) return 0;
+    if (generation > (*index)->generation) (*index)->generation = generation;
+    return count;
+}
+
+// Cargar índice desde formato binario, incluyendo sus segmentos
+int loadIndexFromBinary(InvertedIndex **index, DocumentCollection **collection, 
+                        const char *filename) {
+    if (!index || !collection || !filename) return -1;
+    
+    size_t count = loadIndexMatching(index, collection, filename, NULL);
+    if (count == 0) return -1;
+    
+    printf("Índice cargado desde formato binario: %s\n", filename);
+    printf("Términos: %zu, Documentos: %zu", (*index)->size, (*collection)->count);
+    if (count > 1) printf(", Segmentos: %zu", count - 1);
+    printf("\n");
+    return 0;
+}
+
+// Cargar solo los términos de una consulta de prefijo, rango o comodines
+int loadIndexTerms(const char *filename, const TermQuery *query,
+                   InvertedIndex **index, DocumentCollection **collection) {
+    if (!filename || !query || !index || !collection) return -1;
+    return loadIndexMatching(index, collection, filename, query) ? 0 : -1;
+}
+
+// Cargar solo los documentos vivos (para detectar cambios o borrar)
+int loadIndexDocuments(const char *filename, DocumentCollection **collection) {
+    if (!filename || !collection) return -1;
+    
+    size_t count = 0;
+    char **paths = collectIndexFiles(filename, &count);
+    if (!paths) return -1;
+    
+    size_t total_docs = 0;
+    for (size_t i = 0; i < count; i++) {
+        IndexFileHeader header;
+        if (readIndexHeader(paths[i], &header) == 0) total_docs += header.num_documents;
+    }
+    
+    TombstoneSet deleted;
+    int result = loadTombstones(filename, &deleted);
+    *collection = result == 0 ? createDocumentCollection(total_docs) : NULL;
+    if (!*collection) result = -1;
+    for (size_t i = 0; i < count && result == 0; i++) {
+        result = loadFileInto(NULL, *collection, paths[i], &deleted, NULL, NULL);
+    }
+    if (result != 0 && *collection) {
+        destroyDocumentCollection(*collection);
+        *collection = NULL;
+    }
+    freeTombstones(&deleted);
+    freeIndexFileList(paths, count);
+    return result;
+}
 
 // Validar archivo de índice
 int validateIndexFile(const char *filename) {
@@ -264,7 +1380,8 @@ int validateIndexFile(const char *filename) {
     }
     
     IndexFileHeader header;
-    if (fread(&header, sizeof(IndexFileHeader), 1, file) != 1) {
+    unsigned char raw_header[INDEX_HEADER_SIZE];
+    if (readRawHeader(file, raw_header, &header) != 0) {
         fprintf(stderr, "Error al leer header\n");
         fclose(file);
         return -1;
@@ -277,7 +1394,7 @@ int validateIndexFile(const char *filename) {
         return -1;
     }
     
-    if (header.version != INDEX_FILE_VERSION) {
+    if (header.version < INDEX_FILE_VERSION_MIN || header.version > INDEX_FILE_VERSION) {
         fprintf(stderr, "Versión no soportada: %u\n", header.version);
         return -1;
     }
@@ -286,6 +1403,90 @@ int validateIndexFile(const char *filename) {
     return 0;
 }
 
+// Verificar todos los bloques del archivo contra sus CRC32C
+int verifyIndexFile(const char *filename) {
+    if (!filename) return -1;
+    
+    FILE *file = fopen(filename, "rb");
+    if (!file) {
+        perror("verifyIndexFile: Error al abrir archivo");
+        return -1;
+    }
+    
+    IndexFileHeader header;
+    unsigned char raw_header[INDEX_HEADER_SIZE];
+    if (readRawHeader(file, raw_header, &header) != 0 ||
+        header.magic != INDEX_FILE_MAGIC) {
+        fprintf(stderr, "%s: header inválido\n", filename);
+        fclose(file);
+        return -1;
+    }
+    if (header.version < INDEX_CHECKSUM_VERSION) {
+        printf("%s: formato versión %u sin checksums, no se puede verificar\n",
+               filename, header.version);
+        fclose(file);
+        return 0;
+    }
+    
+    ChecksumTrailer trailer;
+    uint32_t *crcs;
+    if (readChecksumTrailer(file, raw_header, &header, &trailer, &crcs) != 0) {
+        printf("%s: DAÑADO (header o tabla de checksums)\n", filename);
+        fclose(file);
+        return -1;
+    }
+    
+    unsigned char *block = malloc(trailer.block_size);
+    if (!block) {
+        free(crcs);
+        fclose(file);
+        return -1;
+    }
+    
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    
+    // Sección de términos y postings, luego la de documentos
+    size_t bad[2] = {0, 0};
+    uint64_t bytes = 0;
+    uint64_t section_start[2] = { headerSize(header.version), trailer.documents_offset };
+    uint64_t section_end[2] = { trailer.documents_offset, header.checksum_offset };
+    size_t index = 0;
+    for (int section = 0; section < 2; section++) {
+        if (fseeko(file, (off_t)section_start[section], SEEK_SET) != 0) bad[section]++;
+        for (uint64_t pos = section_start[section]; pos < section_end[section]; index++) {
+            size_t len = trailer.block_size;
+            if (section_end[section] - pos < len) len = (size_t)(section_end[section] - pos);
+            if (index >= trailer.block_count || fread(block, 1, len, file) != len ||
+                crc32c(0, block, len) != crcs[index]) {
+                if (bad[section]++ == 0) {
+                    fprintf(stderr, "  Bloque %zu dañado (offset %llu)\n",
+                            index, (unsigned long long)pos);
+                }
+            }
+            pos += len;
+            bytes += len;
+        }
+    }
+    
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double seconds = (double)(end.tv_sec - start.tv_sec) + (double)(end.tv_nsec - start.tv_nsec) / 1e9;
+    
+    printf("=== Verificación de integridad: %s ===\n", filename);
+    printf("Header y tabla de checksums: OK\n");
+    printf("Términos y postings: %u bloques, %s\n", trailer.terms_blocks,
+           bad[0] ? "DAÑADOS" : "OK");
+    printf("Documentos: %u bloques, %s\n", trailer.block_count - trailer.terms_blocks,
+           bad[1] ? "DAÑADOS" : "OK");
+    printf("Verificados %llu bytes en %.2f ms (%.2f GB/s)\n", (unsigned long long)bytes,
+           seconds * 1e3, seconds > 0 ? (double)bytes / seconds / 1e9 : 0.0);
+    
+    free(block);
+    free(crcs);
+    fclose(file);
+    return (bad[0] || bad[1] || index != trailer.block_count) ? -1 : 0;
+}
+
 // Imprimir información del archivo de índice
 void printIndexFileInfo(const char *filename) {
     if (!filename) return;
@@ -297,7 +1498,8 @@ void printIndexFileInfo(const char *filename) {
     }
     
     IndexFileHeader header;
-    if (fread(&header, sizeof(IndexFileHeader), 1, file) != 1) {
+    unsigned char raw_header[INDEX_HEADER_SIZE];
+    if (readRawHeader(file, raw_header, &header) != 0) {
         fprintf(stderr, "Error al leer header\n");
         fclose(file);
         return;
@@ -311,11 +1513,32 @@ void printIndexFileInfo(const char *filename) {
     printf("=== Información del archivo de índice ===\n");
     printf("Archivo: %s\n", filename);
     printf("Magic: 0x%08X\n", header.magic);
-    printf("Versión: %u\n", header.version);
+    if (header.version < INDEX_PORTABLE_VERSION) {
+        printf("Versión: %u (formato nativo antiguo; 'index merge' lo reescribe en la versión %d)\n",
+               header.version, INDEX_FILE_VERSION);
+    } else {
+        printf("Versión: %u (little-endian portable%s%s)\n", header.version,
+               header.version >= INDEX_DICTIONARY_VERSION ? ", diccionario ordenado" : "",
+               header.version >= INDEX_FORWARD_VERSION ? ", índice directo" : "");
+    }
     printf("Términos: %u\n", header.num_terms);
     printf("Documentos: %u\n", header.num_documents);
     printf("Próximo doc ID: %u\n", header.next_doc_id);
-    printf("Checksum: %lu\n", header.checksum);
+    printf("Generación: %u\n", indexGeneration(filename));
+    if (header.build_id) printf("ID de creación: %08x\n", header.build_id);
+    if (header.version >= INDEX_ANALYSIS_VERSION) {
+        AnalysisConfig analysis;
+        char description[128];
+        decodeAnalysis(header.analysis, &analysis);
+        describeAnalysis(&analysis, description, sizeof(description));
+        printf("Análisis: %s\n", description);
+    }
+    if (header.version >= INDEX_CHECKSUM_VERSION) {
+        printf("Checksums: CRC32C por bloques de %d bytes (offset %llu)\n",
+               INDEX_BLOCK_SIZE, (unsigned long long)header.checksum_offset);
+    } else {
+        printf("Checksums: no (formato versión %u)\n", header.version);
+    }
     printf("Tamaño del archivo: %ld bytes\n", file_size);
     
     // Obtener información del sistema de archivos
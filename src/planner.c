@@ -0,0 +1,228 @@
+// Diego Galindo, Francisco Mercado
+#define _POSIX_C_SOURCE 200809L
+#include "planner.h"
+#include "KMP.h"
+#include "boyer_moore.h"
+#include "shift_and.h"
+#include "memchr_search.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+
+// Tamaño de la muestra de texto que inspecciona el planificador
+#define PLANNER_SAMPLE_BYTES (64 * 1024)
+
+PlannerThresholds defaultPlannerThresholds(void) {
+    PlannerThresholds t = {
+        .bm_min_length = 16,
+        .shiftand_max_length = 64,
+        .dense_matches_per_kb = 8.0,
+        .fallback = PLAN_KMP
+    };
+    return t;
+}
+
+int loadPlannerThresholds(const char *path, PlannerThresholds *thresholds) {
+    if (!thresholds) return -1;
+    *thresholds = defaultPlannerThresholds();
+    if (!path) return -1;
+
+    FILE *file = fopen(path, "r");
+    if (!file) return -1;
+
+    char line[256];
+    while (fgets(line, sizeof(line), file)) {
+        if (line[0] == '#' || line[0] == '\n') continue;
+        char *eq = strchr(line, '=');
+        if (!eq) continue;
+        *eq = '\0';
+        const char *value = eq + 1;
+        if (strcmp(line, "bm_min_length") == 0) {
+            thresholds->bm_min_length = (size_t)strtoull(value, NULL, 10);
+        } else if (strcmp(line, "shiftand_max_length") == 0) {
+            thresholds->shiftand_max_length = (size_t)strtoull(value, NULL, 10);
+        } else if (strcmp(line, "dense_matches_per_kb") == 0) {
+            thresholds->dense_matches_per_kb = strtod(value, NULL);
+        } else if (strcmp(line, "fallback") == 0) {
+            thresholds->fallback = (strncmp(value, "kmp_dfa", 7) == 0) ? PLAN_KMP_DFA : PLAN_KMP;
+        }
+    }
+    fclose(file);
+    return 0;
+}
+
+const char* plannedAlgorithmName(PlannedAlgorithm alg) {
+    switch (alg) {
+        case PLAN_MEMCHR:   return "memchr";
+        case PLAN_KMP:      return "kmp";
+        case PLAN_KMP_DFA:  return "kmp_dfa";
+        case PLAN_BM:       return "bm";
+        case PLAN_SHIFTAND: return "shiftand";
+    }
+    return "kmp";
+}
+
+static int isASCII(const char *s, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        if ((unsigned char)s[i] >= 0x80) return 0;
+    }
+    return 1;
+}
+
+SearchPlan planSearch(const char *pattern, const char *text,
+                      const PlannerThresholds *thresholds) {
+    SearchPlan plan = { PLAN_KMP, "" };
+    PlannerThresholds t = thresholds ? *thresholds : defaultPlannerThresholds();
+    size_t M = strlen(pattern);
+
+    if (M <= 2) {
+        plan.alg = PLAN_MEMCHR;
+        snprintf(plan.reason, sizeof(plan.reason), "patrón de %zu byte(s)", M);
+        return plan;
+    }
+
+    // Muestra del texto: alfabeto y densidad de coincidencias
+    size_t sample = strnlen(text, PLANNER_SAMPLE_BYTES);
+    int ascii = isASCII(pattern, M) && isASCII(text, sample);
+    double per_kb = 0.0;
+    ShiftAndPattern *sp = compileShiftAnd(pattern);
+    if (sp && sample > 0) {
+        size_t hits = execShiftAnd(sp, text, sample, SEARCH_COUNT, NULL, NULL);
+        per_kb = (double)hits * 1024.0 / (double)sample;
+    }
+    freeShiftAnd(sp);
+
+    // bm trabaja en code-points: solo se elige con texto ASCII para que las
+    // posiciones coincidan con los offsets en bytes de los demás motores
+    if (ascii && M >= t.bm_min_length && per_kb < t.dense_matches_per_kb) {
+        plan.alg = PLAN_BM;
+        snprintf(plan.reason, sizeof(plan.reason),
+                 "M=%zu >= %zu, texto ASCII, %.2f coincidencias/KB",
+                 M, t.bm_min_length, per_kb);
+    } else if (M <= t.shiftand_max_length) {
+        plan.alg = PLAN_SHIFTAND;
+        snprintf(plan.reason, sizeof(plan.reason), "M=%zu <= %zu%s, %.2f coincidencias/KB",
+                 M, t.shiftand_max_length, ascii ? "" : ", texto no ASCII", per_kb);
+    } else if (t.fallback == PLAN_KMP || M <= KMP_DFA_MAX_PATTERN) {
+        plan.alg = t.fallback;
+        snprintf(plan.reason, sizeof(plan.reason), "M=%zu > %zu%s, %.2f coincidencias/KB",
+                 M, t.shiftand_max_length, ascii ? "" : ", texto no ASCII", per_kb);
+    } else {
+        plan.alg = PLAN_KMP;
+        snprintf(plan.reason, sizeof(plan.reason), "M=%zu supera el máximo del dfa", M);
+    }
+    return plan;
+}
+
+static double nowSeconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// Mejor de 3 ejecuciones en modo conteo (bm incluye la decodificación UTF-8,
+// que es lo que paga cada búsqueda real)
+static double timeEngine(PlannedAlgorithm alg, const char *pattern,
+                         const char *text, size_t N) {
+    double best = 1e30;
+    for (int rep = 0; rep < 3; rep++) {
+        double start = nowSeconds();
+        switch (alg) {
+            case PLAN_KMP: {
+                KmpPattern *p = compileKMP(pattern);
+                execKMP(p, text, N, SEARCH_COUNT, NULL, NULL);
+                freeKMP(p);
+                break;
+            }
+            case PLAN_KMP_DFA: {
+                KmpDfaPattern *p = compileKMPDFA(pattern);
+                execKMPDFA(p, text, N, SEARCH_COUNT, NULL, NULL);
+                freeKMPDFA(p);
+                break;
+            }
+            case PLAN_SHIFTAND: {
+                ShiftAndPattern *p = compileShiftAnd(pattern);
+                execShiftAnd(p, text, N, SEARCH_COUNT, NULL, NULL);
+                freeShiftAnd(p);
+                break;
+            }
+            case PLAN_BM: {
+                BMPattern *p = compileBM(pattern);
+                size_t n;
+                uint32_t *cps = decodeUTF8(text, &n);
+                if (p && cps) execBM(p, cps, n, SEARCH_COUNT, NULL, NULL);
+                free(cps);
+                freeBM(p);
+                break;
+            }
+            case PLAN_MEMCHR:
+                execMemchr(pattern, strlen(pattern), text, N, SEARCH_COUNT, NULL, NULL);
+                break;
+        }
+        double elapsed = nowSeconds() - start;
+        if (elapsed < best) best = elapsed;
+    }
+    return best;
+}
+
+int calibratePlanner(const char *text, const char *out_path) {
+    static const size_t lengths[] = { 3, 4, 6, 8, 12, 16, 24, 32, 48, 64, 96, 128, 256 };
+    const size_t n_lengths = sizeof(lengths) / sizeof(lengths[0]);
+    size_t N = strlen(text);
+    if (N < 2 * lengths[n_lengths - 1]) {
+        fprintf(stderr, "calibratePlanner: texto demasiado corto (%zu bytes)\n", N);
+        return -1;
+    }
+
+    PlannerThresholds t = defaultPlannerThresholds();
+    size_t shiftand_max = 0, bm_min = 0;
+    double total_kmp = 0.0, total_dfa = 0.0;
+    char pattern[257];
+
+    printf("%6s %12s %12s %12s %12s\n", "M", "kmp", "kmp_dfa", "shiftand", "bm");
+    for (size_t k = 0; k < n_lengths; k++) {
+        // Patrón tomado del propio texto para que tenga coincidencias reales
+        size_t M = lengths[k];
+        memcpy(pattern, text + N / 3, M);
+        pattern[M] = '\0';
+
+        double t_kmp = timeEngine(PLAN_KMP, pattern, text, N);
+        double t_dfa = timeEngine(PLAN_KMP_DFA, pattern, text, N);
+        double t_sa = timeEngine(PLAN_SHIFTAND, pattern, text, N);
+        double t_bm = timeEngine(PLAN_BM, pattern, text, N);
+        printf("%6zu %12.6f %12.6f %12.6f %12.6f\n", M, t_kmp, t_dfa, t_sa, t_bm);
+        total_kmp += t_kmp;
+        total_dfa += t_dfa;
+
+        if (t_sa <= t_dfa && t_sa <= t_kmp) shiftand_max = M;
+        double best_byte = t_sa < t_dfa ? t_sa : t_dfa;
+        if (t_kmp < best_byte) best_byte = t_kmp;
+        if (t_bm < best_byte) {
+            if (bm_min == 0) bm_min = M;
+        } else {
+            bm_min = 0;  // bm debe ganar en todos los largos siguientes
+        }
+    }
+
+    t.shiftand_max_length = shiftand_max ? shiftand_max : 2;
+    t.bm_min_length = bm_min ? bm_min : SIZE_MAX;
+    t.fallback = (total_dfa < total_kmp) ? PLAN_KMP_DFA : PLAN_KMP;
+
+    FILE *file = fopen(out_path, "w");
+    if (!file) {
+        perror("calibratePlanner: Error al abrir archivo");
+        return -1;
+    }
+    fprintf(file, "# Umbrales del planificador (generado por buscador calibrate)\n");
+    fprintf(file, "bm_min_length=%zu\n", t.bm_min_length);
+    fprintf(file, "shiftand_max_length=%zu\n", t.shiftand_max_length);
+    fprintf(file, "dense_matches_per_kb=%.2f\n", t.dense_matches_per_kb);
+    fprintf(file, "fallback=%s\n", plannedAlgorithmName(t.fallback));
+    fclose(file);
+
+    printf("\nUmbrales guardados en %s: bm_min_length=%zu, shiftand_max_length=%zu, fallback=%s\n",
+           out_path, t.bm_min_length, t.shiftand_max_length, plannedAlgorithmName(t.fallback));
+    return 0;
+}
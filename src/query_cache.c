@@ -0,0 +1,264 @@
+// Diego Galindo, Francisco Mercado
+#define _POSIX_C_SOURCE 200809L
+#include "query_cache.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+
+// Memoria contada por entrada además de la clave y el valor
+#define ENTRY_OVERHEAD sizeof(QueryCacheEntry)
+
+static uint64_t hashKey(const char *key) {
+    uint64_t hash = 1469598103934665603ULL;  // FNV-1a
+    for (const unsigned char *p = (const unsigned char*)key; *p; p++) {
+        hash ^= *p;
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+static size_t entrySize(const QueryCacheEntry *entry) {
+    return strlen(entry->key) + 1 + entry->value_len + ENTRY_OVERHEAD;
+}
+
+QueryCache* createQueryCache(size_t max_entries, size_t max_bytes, uint32_t generation,
+                             uint32_t build_id) {
+    QueryCache *cache = calloc(1, sizeof(QueryCache));
+    if (!cache) return NULL;
+
+    cache->bucket_count = 16;
+    while (cache->bucket_count < max_entries) cache->bucket_count *= 2;
+    cache->buckets = calloc(cache->bucket_count, sizeof(QueryCacheEntry*));
+    if (!cache->buckets) {
+        free(cache);
+        return NULL;
+    }
+    cache->max_entries = max_entries ? max_entries : 1;
+    cache->max_bytes = max_bytes;
+    cache->generation = generation;
+    cache->build_id = build_id;
+    pthread_mutex_init(&cache->lock, NULL);
+    return cache;
+}
+
+static void unlinkLru(QueryCache *cache, QueryCacheEntry *entry) {
+    if (entry->newer) entry->newer->older = entry->older;
+    else cache->head = entry->older;
+    if (entry->older) entry->older->newer = entry->newer;
+    else cache->tail = entry->newer;
+    entry->newer = entry->older = NULL;
+}
+
+static void pushFront(QueryCache *cache, QueryCacheEntry *entry) {
+    entry->newer = NULL;
+    entry->older = cache->head;
+    if (cache->head) cache->head->newer = entry;
+    cache->head = entry;
+    if (!cache->tail) cache->tail = entry;
+}
+
+static QueryCacheEntry* findEntry(QueryCache *cache, const char *key, uint64_t hash) {
+    QueryCacheEntry *entry = cache->buckets[hash & (cache->bucket_count - 1)];
+    while (entry && (entry->hash != hash || strcmp(entry->key, key) != 0)) entry = entry->chain;
+    return entry;
+}
+
+static void removeEntry(QueryCache *cache, QueryCacheEntry *entry) {
+    QueryCacheEntry **slot = &cache->buckets[entry->hash & (cache->bucket_count - 1)];
+    while (*slot != entry) slot = &(*slot)->chain;
+    *slot = entry->chain;
+    unlinkLru(cache, entry);
+    cache->count--;
+    cache->bytes -= entrySize(entry);
+    free(entry->key);
+    free(entry->value);
+    free(entry);
+}
+
+void destroyQueryCache(QueryCache *cache) {
+    if (!cache) return;
+    while (cache->head) removeEntry(cache, cache->head);
+    pthread_mutex_destroy(&cache->lock);
+    free(cache->buckets);
+    free(cache);
+}
+
+char* queryCacheGet(QueryCache *cache, const char *key, size_t *len) {
+    if (!cache || !key) return NULL;
+    uint64_t hash = hashKey(key);
+
+    pthread_mutex_lock(&cache->lock);
+    char *copy = NULL;
+    QueryCacheEntry *entry = findEntry(cache, key, hash);
+    if (entry) {
+        copy = malloc(entry->value_len + 1);
+        if (copy) {
+            memcpy(copy, entry->value, entry->value_len);
+            copy[entry->value_len] = '\0';
+            *len = entry->value_len;
+        }
+        unlinkLru(cache, entry);
+        pushFront(cache, entry);
+        cache->hits++;
+    } else {
+        cache->misses++;
+    }
+    pthread_mutex_unlock(&cache->lock);
+    return copy;
+}
+
+// Inserta sin tomar el lock; el llamador lo tiene
+static void putLocked(QueryCache *cache, const char *key, const char *value, size_t len) {
+    uint64_t hash = hashKey(key);
+    QueryCacheEntry *old = findEntry(cache, key, hash);
+    if (old) removeEntry(cache, old);
+
+    QueryCacheEntry *entry = calloc(1, sizeof(QueryCacheEntry));
+    if (!entry) return;
+    entry->key = strdup(key);
+    entry->value = malloc(len + 1);
+    if (!entry->key || !entry->value) {
+        free(entry->key);
+        free(entry->value);
+        free(entry);
+        return;
+    }
+    memcpy(entry->value, value, len);
+    entry->value[len] = '\0';
+    entry->value_len = len;
+    entry->hash = hash;
+
+    // Un resultado que no cabe ni solo no se guarda
+    size_t size = entrySize(entry);
+    if (size > cache->max_bytes) {
+        free(entry->key);
+        free(entry->value);
+        free(entry);
+        return;
+    }
+    while (cache->tail && (cache->count >= cache->max_entries ||
+                           cache->bytes + size > cache->max_bytes)) {
+        removeEntry(cache, cache->tail);
+    }
+
+    QueryCacheEntry **slot = &cache->buckets[hash & (cache->bucket_count - 1)];
+    entry->chain = *slot;
+    *slot = entry;
+    pushFront(cache, entry);
+    cache->count++;
+    cache->bytes += size;
+    cache->dirty = 1;
+}
+
+void queryCachePut(QueryCache *cache, const char *key, const char *value, size_t len) {
+    if (!cache || !key || !value) return;
+    pthread_mutex_lock(&cache->lock);
+    putLocked(cache, key, value, len);
+    pthread_mutex_unlock(&cache->lock);
+}
+
+// ============================================================================
+// Persistencia: magic, generación y número de entradas (u32 little-endian),
+// luego cada entrada (largo de clave, largo de valor, clave, valor) desde la
+// menos reciente a la más reciente, para recuperar el orden LRU al cargar
+// ============================================================================
+
+static int writeU32(FILE *file, uint32_t value) {
+    unsigned char raw[4] = { (unsigned char)value, (unsigned char)(value >> 8),
+                             (unsigned char)(value >> 16), (unsigned char)(value >> 24) };
+    return fwrite(raw, 1, 4, file) == 4 ? 0 : -1;
+}
+
+static int readU32(FILE *file, uint32_t *value) {
+    unsigned char raw[4];
+    if (fread(raw, 1, 4, file) != 4) return -1;
+    *value = (uint32_t)raw[0] | ((uint32_t)raw[1] << 8) |
+             ((uint32_t)raw[2] << 16) | ((uint32_t)raw[3] << 24);
+    return 0;
+}
+
+int loadQueryCache(QueryCache *cache, const char *index_path) {
+    if (!cache || !index_path) return -1;
+    char path[1024];
+    snprintf(path, sizeof(path), "%s%s", index_path, QUERY_CACHE_SUFFIX);
+    FILE *file = fopen(path, "rb");
+    if (!file) return 0;
+
+    uint32_t magic, build_id, generation, count;
+    if (readU32(file, &magic) != 0 || readU32(file, &build_id) != 0 ||
+        readU32(file, &generation) != 0 || readU32(file, &count) != 0 ||
+        magic != QUERY_CACHE_MAGIC || build_id != cache->build_id ||
+        generation != cache->generation) {
+        // De otro índice, otra generación o ilegible: se reemplaza en el próximo guardado
+        fclose(file);
+        return 0;
+    }
+
+    pthread_mutex_lock(&cache->lock);
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t key_len, value_len;
+        if (readU32(file, &key_len) != 0 || readU32(file, &value_len) != 0 ||
+            key_len > cache->max_bytes || value_len > cache->max_bytes) break;
+        char *key = malloc((size_t)key_len + 1);
+        char *value = malloc((size_t)value_len + 1);
+        int ok = key && value && fread(key, 1, key_len, file) == key_len &&
+                 fread(value, 1, value_len, file) == value_len;
+        if (ok) {
+            key[key_len] = '\0';
+            putLocked(cache, key, value, value_len);
+        }
+        free(key);
+        free(value);
+        if (!ok) break;
+    }
+    cache->dirty = 0;
+    pthread_mutex_unlock(&cache->lock);
+    fclose(file);
+    return 0;
+}
+
+int saveQueryCache(QueryCache *cache, const char *index_path) {
+    if (!cache || !index_path) return -1;
+    pthread_mutex_lock(&cache->lock);
+    if (!cache->dirty) {
+        pthread_mutex_unlock(&cache->lock);
+        return 0;
+    }
+
+    char path[1024], tmp_path[1100];
+    snprintf(path, sizeof(path), "%s%s", index_path, QUERY_CACHE_SUFFIX);
+    snprintf(tmp_path, sizeof(tmp_path), "%s.tmp.%ld", path, (long)getpid());
+    FILE *file = fopen(tmp_path, "wb");
+    if (!file) {
+        pthread_mutex_unlock(&cache->lock);
+        perror("saveQueryCache: Error al abrir archivo");
+        return -1;
+    }
+
+    int failed = writeU32(file, QUERY_CACHE_MAGIC) || writeU32(file, cache->build_id) ||
+                 writeU32(file, cache->generation) || writeU32(file, (uint32_t)cache->count);
+    for (QueryCacheEntry *entry = cache->tail; entry && !failed; entry = entry->newer) {
+        size_t key_len = strlen(entry->key);
+        failed = writeU32(file, (uint32_t)key_len) || writeU32(file, (uint32_t)entry->value_len) ||
+                 fwrite(entry->key, 1, key_len, file) != key_len ||
+                 fwrite(entry->value, 1, entry->value_len, file) != entry->value_len;
+    }
+    if (fclose(file) != 0) failed = 1;
+    if (!failed && rename(tmp_path, path) == 0) {
+        cache->dirty = 0;
+    } else {
+        failed = 1;
+        unlink(tmp_path);
+    }
+    pthread_mutex_unlock(&cache->lock);
+    return failed ? -1 : 0;
+}
+
+int removeQueryCache(const char *index_path) {
+    if (!index_path) return -1;
+    char path[1024];
+    snprintf(path, sizeof(path), "%s%s", index_path, QUERY_CACHE_SUFFIX);
+    return (unlink(path) != 0 && errno != ENOENT) ? -1 : 0;
+}
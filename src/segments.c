@@ -0,0 +1,657 @@
+// Diego Galindo, Francisco Mercado
+#define _POSIX_C_SOURCE 200809L
+#include "segments.h"
+#include "persistence.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+// Espera máxima para tomar el lock del manifiesto (en intentos de 10 ms)
+#define LOCK_RETRIES 1000
+
+static void buildSidePath(const char *index_path, const char *suffix, char *out, size_t size) {
+    snprintf(out, size, "%s%s", index_path, suffix);
+}
+
+void buildSegmentPath(const char *index_path, const char *name, char *out, size_t size) {
+    const char *slash = strrchr(index_path, '/');
+    if (!slash) {
+        snprintf(out, size, "%s", name);
+        return;
+    }
+    snprintf(out, size, "%.*s/%s", (int)(slash - index_path), index_path, name);
+}
+
+// Lock por archivo creado con O_EXCL; guarda el pid para detectar locks
+// huérfanos de procesos que terminaron sin liberarlo
+static int acquireLock(const char *lock_path, int wait) {
+    for (int attempt = 0; attempt < LOCK_RETRIES; attempt++) {
+        int fd = open(lock_path, O_CREAT | O_EXCL | O_WRONLY, 0644);
+        if (fd >= 0) {
+            char pid[32];
+            int len = snprintf(pid, sizeof(pid), "%ld\n", (long)getpid());
+            if (write(fd, pid, (size_t)len) != len) {
+                close(fd);
+                unlink(lock_path);
+                return -1;
+            }
+            return fd;
+        }
+        if (errno != EEXIST) return -1;
+
+        FILE *f = fopen(lock_path, "r");
+        long owner = 0;
+        if (f) {
+            if (fscanf(f, "%ld", &owner) != 1) owner = 0;
+            fclose(f);
+        }
+        if (owner > 0 && kill((pid_t)owner, 0) == -1 && errno == ESRCH) {
+            unlink(lock_path);
+            continue;
+        }
+        if (!wait) return -1;
+        struct timespec delay = { 0, 10 * 1000 * 1000 };
+        nanosleep(&delay, NULL);
+    }
+    return -1;
+}
+
+static void releaseLock(const char *lock_path, int fd) {
+    if (fd < 0) return;
+    close(fd);
+    unlink(lock_path);
+}
+
+static int lockManifest(const char *index_path, char *lock_path, size_t size) {
+    buildSidePath(index_path, ".lock", lock_path, size);
+    int fd = acquireLock(lock_path, 1);
+    if (fd < 0) fprintf(stderr, "No se pudo bloquear el manifiesto de %s\n", index_path);
+    return fd;
+}
+
+int lockIndex(const char *index_path) {
+    char lock_path[1024];
+    return lockManifest(index_path, lock_path, sizeof(lock_path));
+}
+
+void unlockIndex(const char *index_path, int lock) {
+    char lock_path[1024];
+    buildSidePath(index_path, ".lock", lock_path, sizeof(lock_path));
+    releaseLock(lock_path, lock);
+}
+
+uint32_t indexGeneration(const char *index_path) {
+    IndexFileHeader header;
+    uint32_t generation = readIndexHeader(index_path, &header) == 0 ? header.generation : 0;
+
+    SegmentManifest manifest;
+    if (loadSegmentManifest(index_path, &manifest) == 0) {
+        if (manifest.generation > generation) generation = manifest.generation;
+        freeSegmentManifest(&manifest);
+    }
+    return generation;
+}
+
+// Registra un cambio en el manifiesto (con su lock tomado)
+static uint32_t bumpGeneration(const char *index_path, SegmentManifest *manifest) {
+    IndexFileHeader header;
+    if (readIndexHeader(index_path, &header) == 0 && header.generation > manifest->generation) {
+        manifest->generation = header.generation;
+    }
+    return ++manifest->generation;
+}
+
+// Bitmap de tombstones: se escribe en un temporal y se renombra, siempre
+// con el lock del manifiesto tomado
+int loadTombstones(const char *index_path, TombstoneSet *set) {
+    set->bits = NULL;
+    set->size = 0;
+
+    char path[1024];
+    buildSidePath(index_path, TOMBSTONE_SUFFIX, path, sizeof(path));
+    FILE *file = fopen(path, "rb");
+    if (!file) return errno == ENOENT ? 0 : -1;
+
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    if (size > 0) {
+        set->bits = malloc((size_t)size);
+        if (!set->bits || fread(set->bits, 1, (size_t)size, file) != (size_t)size) {
+            fprintf(stderr, "Error al leer tombstones de %s\n", index_path);
+            fclose(file);
+            freeTombstones(set);
+            return -1;
+        }
+        set->size = (size_t)size;
+    }
+    fclose(file);
+    return 0;
+}
+
+void freeTombstones(TombstoneSet *set) {
+    if (!set) return;
+    free(set->bits);
+    set->bits = NULL;
+    set->size = 0;
+}
+
+static int saveTombstones(const char *index_path, const TombstoneSet *set) {
+    char path[1024], tmp_path[1040];
+    buildSidePath(index_path, TOMBSTONE_SUFFIX, path, sizeof(path));
+
+    // Sin bits activos el archivo sobra
+    size_t used = set->size;
+    while (used > 0 && set->bits[used - 1] == 0) used--;
+    if (used == 0) return (unlink(path) == 0 || errno == ENOENT) ? 0 : -1;
+
+    snprintf(tmp_path, sizeof(tmp_path), "%s.tmp", path);
+    FILE *file = fopen(tmp_path, "wb");
+    if (!file) {
+        perror("saveTombstones: Error al abrir archivo");
+        return -1;
+    }
+    size_t written = fwrite(set->bits, 1, used, file);
+    int synced = fflush(file) == 0 && fsync(fileno(file)) == 0;
+    if (fclose(file) != 0 || !synced || written != used || rename(tmp_path, path) != 0) {
+        perror("saveTombstones: Error al guardar tombstones");
+        unlink(tmp_path);
+        return -1;
+    }
+    return 0;
+}
+
+static int addTombstonesLocked(const char *index_path, const uint32_t *ids, size_t count) {
+    if (count == 0) return 0;
+
+    TombstoneSet set;
+    if (loadTombstones(index_path, &set) != 0) return -1;
+    for (size_t i = 0; i < count; i++) {
+        size_t byte = ids[i] >> 3;
+        if (byte >= set.size) {
+            size_t size = set.size ? set.size : 64;
+            while (size <= byte) size *= 2;
+            uint8_t *grown = realloc(set.bits, size);
+            if (!grown) {
+                freeTombstones(&set);
+                return -1;
+            }
+            memset(grown + set.size, 0, size - set.size);
+            set.bits = grown;
+            set.size = size;
+        }
+        set.bits[byte] |= (uint8_t)(1u << (ids[i] & 7));
+    }
+    int result = saveTombstones(index_path, &set);
+    freeTombstones(&set);
+    return result;
+}
+
+int addTombstones(const char *index_path, const uint32_t *ids, size_t count) {
+    if (count == 0) return 0;
+
+    // Los borrados cambian los resultados: nueva generación en el manifiesto
+    SegmentManifest manifest;
+    int result = loadSegmentManifest(index_path, &manifest);
+    if (result == 0) {
+        bumpGeneration(index_path, &manifest);
+        result = addTombstonesLocked(index_path, ids, count);
+        if (result == 0) result = saveSegmentManifest(index_path, &manifest);
+        freeSegmentManifest(&manifest);
+    }
+    return result;
+}
+
+int loadSegmentManifest(const char *index_path, SegmentManifest *manifest) {
+    memset(manifest, 0, sizeof(*manifest));
+    manifest->next_segment = 1;
+
+    char path[1024];
+    buildSidePath(index_path, SEGMENT_MANIFEST_SUFFIX, path, sizeof(path));
+    FILE *file = fopen(path, "r");
+    if (!file) return errno == ENOENT ? 0 : -1;
+
+    char line[512];
+    while (fgets(line, sizeof(line), file)) {
+        if (line[0] == '#' || line[0] == '\n') continue;
+
+        unsigned next;
+        if (sscanf(line, "siguiente %u", &next) == 1) {
+            manifest->next_segment = next;
+            continue;
+        }
+        if (sscanf(line, "generacion %u", &next) == 1) {
+            manifest->generation = next;
+            continue;
+        }
+
+        SegmentInfo info;
+        unsigned documents;
+        unsigned long long bytes;
+        if (sscanf(line, "%255s %u %llu", info.name, &documents, &bytes) != 3) {
+            fprintf(stderr, "Manifiesto de segmentos inválido: %s", line);
+            fclose(file);
+            freeSegmentManifest(manifest);
+            return -1;
+        }
+        info.documents = documents;
+        info.bytes = bytes;
+
+        if (manifest->count == manifest->capacity) {
+            size_t capacity = manifest->capacity ? manifest->capacity * 2 : 8;
+            SegmentInfo *grown = realloc(manifest->segments, capacity * sizeof(SegmentInfo));
+            if (!grown) {
+                fclose(file);
+                freeSegmentManifest(manifest);
+                return -1;
+            }
+            manifest->segments = grown;
+            manifest->capacity = capacity;
+        }
+        manifest->segments[manifest->count++] = info;
+    }
+    fclose(file);
+    return 0;
+}
+
+// Se escribe en un temporal, se hace fsync y se renombra para que un lector
+// nunca vea un manifiesto a medio escribir
+int saveSegmentManifest(const char *index_path, const SegmentManifest *manifest) {
+    char path[1024], tmp_path[1040];
+    buildSidePath(index_path, SEGMENT_MANIFEST_SUFFIX, path, sizeof(path));
+    snprintf(tmp_path, sizeof(tmp_path), "%s.tmp", path);
+
+    FILE *file = fopen(tmp_path, "w");
+    if (!file) {
+        perror("saveSegmentManifest: Error al abrir archivo");
+        return -1;
+    }
+    fprintf(file, "# Segmentos de %s: nombre documentos bytes\n", index_path);
+    fprintf(file, "siguiente %u\n", manifest->next_segment);
+    fprintf(file, "generacion %u\n", manifest->generation);
+    for (size_t i = 0; i < manifest->count; i++) {
+        fprintf(file, "%s %u %llu\n", manifest->segments[i].name,
+                manifest->segments[i].documents,
+                (unsigned long long)manifest->segments[i].bytes);
+    }
+    int synced = fflush(file) == 0 && fsync(fileno(file)) == 0;
+    if (fclose(file) != 0 || !synced || rename(tmp_path, path) != 0) {
+        perror("saveSegmentManifest: Error al guardar el manifiesto");
+        unlink(tmp_path);
+        return -1;
+    }
+    return 0;
+}
+
+void freeSegmentManifest(SegmentManifest *manifest) {
+    if (!manifest) return;
+    free(manifest->segments);
+    manifest->segments = NULL;
+    manifest->count = manifest->capacity = 0;
+}
+
+uint32_t nextDocIdForIndex(const char *index_path) {
+    IndexFileHeader header;
+    uint32_t next = 1;
+    if (readIndexHeader(index_path, &header) == 0) next = header.next_doc_id;
+
+    SegmentManifest manifest;
+    if (loadSegmentManifest(index_path, &manifest) != 0) return next;
+    for (size_t i = 0; i < manifest.count; i++) {
+        char path[1024];
+        buildSegmentPath(index_path, manifest.segments[i].name, path, sizeof(path));
+        if (readIndexHeader(path, &header) == 0 && header.next_doc_id > next) {
+            next = header.next_doc_id;
+        }
+    }
+    freeSegmentManifest(&manifest);
+    return next;
+}
+
+static void segmentName(const char *index_path, uint32_t number, char *out, size_t size) {
+    const char *base = strrchr(index_path, '/');
+    base = base ? base + 1 : index_path;
+    snprintf(out, size, "%s.s%04u", base, number);
+}
+
+static uint64_t fileSize(const char *path) {
+    struct stat st;
+    return stat(path, &st) == 0 ? (uint64_t)st.st_size : 0;
+}
+
+static int addManifestEntry(SegmentManifest *manifest, const SegmentInfo *info) {
+    if (manifest->count == manifest->capacity) {
+        size_t capacity = manifest->capacity ? manifest->capacity * 2 : 8;
+        SegmentInfo *grown = realloc(manifest->segments, capacity * sizeof(SegmentInfo));
+        if (!grown) return -1;
+        manifest->segments = grown;
+        manifest->capacity = capacity;
+    }
+    manifest->segments[manifest->count++] = *info;
+    return 0;
+}
+
+int appendSegment(const char *index_path, InvertedIndex *index,
+                  const DocumentCollection *collection,
+                  const uint32_t *deleted, size_t deleted_count) {
+    SegmentManifest manifest;
+    if (loadSegmentManifest(index_path, &manifest) != 0) return -1;
+
+    SegmentInfo info;
+    char path[1024];
+    segmentName(index_path, manifest.next_segment++, info.name, sizeof(info.name));
+    buildSegmentPath(index_path, info.name, path, sizeof(path));
+    index->generation = bumpGeneration(index_path, &manifest);
+
+    int result = -1;
+    if (saveIndexToBinary(index, collection, path) == 0) {
+        info.documents = (uint32_t)collection->count;
+        info.bytes = fileSize(path);
+        // Primero el manifiesto: si falla lo demás, el documento viejo sigue
+        // visible junto al nuevo en lugar de perderse
+        if (addManifestEntry(&manifest, &info) == 0 &&
+            saveSegmentManifest(index_path, &manifest) == 0) {
+            printf("Segmento añadido: %s (%u documentos)\n", path, info.documents);
+            result = addTombstonesLocked(index_path, deleted, deleted_count);
+        } else {
+            unlink(path);
+        }
+    }
+
+    freeSegmentManifest(&manifest);
+    return result;
+}
+
+static int segmentTier(uint64_t bytes) {
+    int tier = 0;
+    uint64_t limit = SEGMENT_TIER_BASE;
+    while (bytes > limit && tier < 31) {
+        tier++;
+        limit *= SEGMENT_MERGE_FACTOR;
+    }
+    return tier;
+}
+
+// Primer nivel con SEGMENT_MERGE_FACTOR segmentos, o -1 si ninguno los tiene
+static int tierToMerge(const SegmentManifest *manifest) {
+    size_t per_tier[32] = {0};
+    for (size_t i = 0; i < manifest->count; i++) {
+        per_tier[segmentTier(manifest->segments[i].bytes)]++;
+    }
+    for (int t = 0; t < 32; t++) {
+        if (per_tier[t] >= SEGMENT_MERGE_FACTOR) return t;
+    }
+    return -1;
+}
+
+// Fusiona los primeros SEGMENT_MERGE_FACTOR segmentos del nivel indicado
+static int mergeTier(const char *index_path, int tier) {
+    char lock_path[1024];
+    int lock = lockManifest(index_path, lock_path, sizeof(lock_path));
+    if (lock < 0) return -1;
+
+    SegmentManifest manifest;
+    if (loadSegmentManifest(index_path, &manifest) != 0) {
+        releaseLock(lock_path, lock);
+        return -1;
+    }
+
+    // Elegir los segmentos y reservar el número del resultado
+    char names[SEGMENT_MERGE_FACTOR][SEGMENT_NAME_MAX];
+    char *paths[SEGMENT_MERGE_FACTOR];
+    char path_storage[SEGMENT_MERGE_FACTOR][1024];
+    size_t chosen = 0;
+    for (size_t i = 0; i < manifest.count && chosen < SEGMENT_MERGE_FACTOR; i++) {
+        if (segmentTier(manifest.segments[i].bytes) != tier) continue;
+        strcpy(names[chosen], manifest.segments[i].name);
+        buildSegmentPath(index_path, names[chosen], path_storage[chosen], sizeof(path_storage[chosen]));
+        paths[chosen] = path_storage[chosen];
+        chosen++;
+    }
+    SegmentInfo merged;
+    segmentName(index_path, manifest.next_segment++, merged.name, sizeof(merged.name));
+    int saved = (chosen == SEGMENT_MERGE_FACTOR) ? saveSegmentManifest(index_path, &manifest) : -1;
+    freeSegmentManifest(&manifest);
+    releaseLock(lock_path, lock);
+    if (saved != 0) return -1;
+
+    // La fusión pesada se hace sin el lock: las actualizaciones siguen.
+    // Los documentos con tombstone no pasan al segmento fusionado.
+    InvertedIndex *index = NULL;
+    DocumentCollection *collection = NULL;
+    TombstoneSet deleted;
+    if (loadTombstones(index_path, &deleted) != 0) return -1;
+    int loaded = loadIndexFiles(&index, &collection, (const char *const *)paths, chosen, &deleted);
+    freeTombstones(&deleted);
+    if (loaded != 0) return -1;
+
+    char merged_path[1024];
+    buildSegmentPath(index_path, merged.name, merged_path, sizeof(merged_path));
+    int result = saveIndexToBinary(index, collection, merged_path);
+    merged.documents = (uint32_t)collection->count;
+    destroyIndex(index);
+    destroyDocumentCollection(collection);
+    if (result != 0) return -1;
+    merged.bytes = fileSize(merged_path);
+
+    // Reemplazar los segmentos fusionados en el manifiesto
+    lock = lockManifest(index_path, lock_path, sizeof(lock_path));
+    if (lock < 0 || loadSegmentManifest(index_path, &manifest) != 0) {
+        releaseLock(lock_path, lock);
+        unlink(merged_path);
+        return -1;
+    }
+    size_t out = 0;
+    int inserted = 0;
+    for (size_t i = 0; i < manifest.count; i++) {
+        int was_merged = 0;
+        for (size_t k = 0; k < chosen; k++) {
+            if (strcmp(manifest.segments[i].name, names[k]) == 0) was_merged = 1;
+        }
+        if (!was_merged) {
+            manifest.segments[out++] = manifest.segments[i];
+        } else if (!inserted) {
+            manifest.segments[out++] = merged;
+            inserted = 1;
+        }
+    }
+    manifest.count = out;
+    result = saveSegmentManifest(index_path, &manifest);
+    freeSegmentManifest(&manifest);
+    releaseLock(lock_path, lock);
+
+    if (result != 0) {
+        unlink(merged_path);
+        return -1;
+    }
+    for (size_t k = 0; k < chosen; k++) unlink(paths[k]);
+    return 0;
+}
+
+int mergeSegmentTiers(const char *index_path) {
+    char merge_lock_path[1024];
+    buildSidePath(index_path, ".merge", merge_lock_path, sizeof(merge_lock_path));
+    int merge_lock = acquireLock(merge_lock_path, 0);
+    if (merge_lock < 0) return 0;  // Otra fusión en curso
+
+    int merges = 0;
+    for (;;) {
+        SegmentManifest manifest;
+        if (loadSegmentManifest(index_path, &manifest) != 0) {
+            merges = -1;
+            break;
+        }
+        int tier = tierToMerge(&manifest);
+        freeSegmentManifest(&manifest);
+        if (tier < 0) break;
+        if (mergeTier(index_path, tier) != 0) {
+            merges = -1;
+            break;
+        }
+        merges++;
+    }
+
+    releaseLock(merge_lock_path, merge_lock);
+    return merges;
+}
+
+int startBackgroundMerge(const char *index_path) {
+    SegmentManifest manifest;
+    if (loadSegmentManifest(index_path, &manifest) != 0) return -1;
+    int tier = tierToMerge(&manifest);
+    freeSegmentManifest(&manifest);
+    if (tier < 0) return 0;
+
+    fflush(stdout);
+    fflush(stderr);
+    pid_t pid = fork();
+    if (pid < 0) {
+        perror("startBackgroundMerge: fork falló");
+        return -1;
+    }
+    if (pid == 0) {
+        // Proceso hijo: desligado de la terminal y sin salida estándar
+        setsid();
+        if (!freopen("/dev/null", "w", stdout)) _exit(EXIT_FAILURE);
+        _exit(mergeSegmentTiers(index_path) < 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+    }
+    printf("Fusión de segmentos (nivel %d) en segundo plano, pid %ld\n", tier, (long)pid);
+    return 0;
+}
+
+// Quita del manifiesto los segmentos ya contenidos en la base (su próximo
+// doc ID no supera el de la base), borra sus archivos y olvida los
+// tombstones de documentos ya purgados
+static int dropAbsorbedSegments(const char *index_path, const TombstoneSet *purged) {
+    IndexFileHeader base;
+    if (readIndexHeader(index_path, &base) != 0) return -1;
+
+    char lock_path[1024];
+    int lock = lockManifest(index_path, lock_path, sizeof(lock_path));
+    if (lock < 0) return -1;
+
+    SegmentManifest manifest;
+    if (loadSegmentManifest(index_path, &manifest) != 0) {
+        releaseLock(lock_path, lock);
+        return -1;
+    }
+    size_t out = 0;
+    for (size_t i = 0; i < manifest.count; i++) {
+        char path[1024];
+        IndexFileHeader header;
+        buildSegmentPath(index_path, manifest.segments[i].name, path, sizeof(path));
+        if (readIndexHeader(path, &header) == 0 && header.next_doc_id <= base.next_doc_id) {
+            unlink(path);
+        } else {
+            manifest.segments[out++] = manifest.segments[i];
+        }
+    }
+    manifest.count = out;
+    int result = saveSegmentManifest(index_path, &manifest);
+    freeSegmentManifest(&manifest);
+
+    TombstoneSet current;
+    if (result == 0 && purged->size > 0 && loadTombstones(index_path, &current) == 0) {
+        size_t common = current.size < purged->size ? current.size : purged->size;
+        for (size_t i = 0; i < common; i++) current.bits[i] &= (uint8_t)~purged->bits[i];
+        result = saveTombstones(index_path, &current);
+        freeTombstones(&current);
+    }
+    releaseLock(lock_path, lock);
+    return result;
+}
+
+int compactIndex(const char *index_path) {
+    char merge_lock_path[1024];
+    buildSidePath(index_path, ".merge", merge_lock_path, sizeof(merge_lock_path));
+    int merge_lock = acquireLock(merge_lock_path, 1);
+    if (merge_lock < 0) {
+        fprintf(stderr, "Hay otra fusión en curso sobre %s\n", index_path);
+        return -1;
+    }
+
+    // Los tombstones vistos aquí quedan purgados por la carga; los que
+    // lleguen después se conservan
+    TombstoneSet purged;
+    if (loadTombstones(index_path, &purged) != 0) {
+        releaseLock(merge_lock_path, merge_lock);
+        return -1;
+    }
+
+    InvertedIndex *index = NULL;
+    DocumentCollection *collection = NULL;
+    int result = loadIndexFromBinary(&index, &collection, index_path);
+    if (result == 0) {
+        // saveIndexToBinary reemplaza el archivo con un rename atómico: los
+        // lectores ven la base vieja con sus segmentos o la nueva
+        result = saveIndexToBinary(index, collection, index_path);
+        destroyIndex(index);
+        destroyDocumentCollection(collection);
+    }
+    if (result == 0) result = dropAbsorbedSegments(index_path, &purged);
+    freeTombstones(&purged);
+
+    releaseLock(merge_lock_path, merge_lock);
+    if (result == 0) printf("Índice compactado: %s\n", index_path);
+    return result;
+}
+
+int clearIndexSegments(const char *index_path) {
+    SegmentManifest manifest;
+    if (loadSegmentManifest(index_path, &manifest) != 0) return -1;
+    for (size_t i = 0; i < manifest.count; i++) {
+        char path[1024];
+        buildSegmentPath(index_path, manifest.segments[i].name, path, sizeof(path));
+        unlink(path);
+    }
+    freeSegmentManifest(&manifest);
+
+    char path[1024];
+    buildSidePath(index_path, TOMBSTONE_SUFFIX, path, sizeof(path));
+    if (unlink(path) != 0 && errno != ENOENT) return -1;
+    buildSidePath(index_path, SEGMENT_MANIFEST_SUFFIX, path, sizeof(path));
+    if (unlink(path) != 0 && errno != ENOENT) return -1;
+    return 0;
+}
+
+void printSegmentInfo(const char *index_path) {
+    SegmentManifest manifest;
+    if (loadSegmentManifest(index_path, &manifest) != 0) return;
+
+    printf("Segmentos: %zu\n", manifest.count);
+    for (size_t i = 0; i < manifest.count; i++) {
+        printf("  %s: %u documentos, %llu bytes (nivel %d)\n",
+               manifest.segments[i].name, manifest.segments[i].documents,
+               (unsigned long long)manifest.segments[i].bytes,
+               segmentTier(manifest.segments[i].bytes));
+    }
+    freeSegmentManifest(&manifest);
+
+    TombstoneSet deleted;
+    if (loadTombstones(index_path, &deleted) != 0) return;
+    size_t count = 0;
+    for (size_t i = 0; i < deleted.size; i++) count += (size_t)__builtin_popcount(deleted.bits[i]);
+    if (count > 0) printf("Documentos borrados pendientes de compactar: %zu\n", count);
+    freeTombstones(&deleted);
+}
+
+int verifyIndexWithSegments(const char *index_path) {
+    int result = verifyIndexFile(index_path);
+
+    SegmentManifest manifest;
+    if (loadSegmentManifest(index_path, &manifest) != 0) return -1;
+    for (size_t i = 0; i < manifest.count; i++) {
+        char path[1024];
+        buildSegmentPath(index_path, manifest.segments[i].name, path, sizeof(path));
+        if (verifyIndexFile(path) != 0) result = -1;
+    }
+    freeSegmentManifest(&manifest);
+    return result;
+}
@@ -0,0 +1,523 @@
+// Diego Galindo, Francisco Mercado
+#define _GNU_SOURCE
+#include "server.h"
+#include "index_operations.h"
+#include "indexer.h"
+#include "persistence.h"
+#include "query_cache.h"
+#include "parallel.h"
+#include "similarity.h"
+#include "utils.h"
+#include <errno.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+// Conexiones aceptadas a la espera de un hilo libre; con la cola llena se
+// rechaza la conexión en vez de bloquear el accept
+#define SERVER_QUEUE_SIZE 128
+
+typedef struct {
+    InvertedIndex *index;            // Solo lectura mientras el servidor corre
+    DocumentCollection *collection;
+    QueryCache *cache;               // Respuestas de search y similar
+} ServerState;
+
+typedef struct {
+    int fds[SERVER_QUEUE_SIZE];
+    size_t head;
+    size_t count;
+    int closing;
+    int *active;                     // Conexión que atiende cada hilo (-1: ninguna)
+    pthread_mutex_t lock;
+    pthread_cond_t ready;
+} ConnectionQueue;
+
+typedef struct {
+    ServerState *state;
+    ConnectionQueue *queue;
+    int id;
+} ServerWorker;
+
+static volatile sig_atomic_t stop_requested = 0;
+
+static void onStopSignal(int sig) {
+    (void)sig;
+    stop_requested = 1;
+}
+
+static int writeAll(int fd, const char *data, size_t len) {
+    while (len > 0) {
+        ssize_t n = write(fd, data, len);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return -1;
+        }
+        data += n;
+        len -= (size_t)n;
+    }
+    return 0;
+}
+
+static int parseDocId(const char *text, uint32_t *id) {
+    if (!text || !*text) return -1;
+    char *end;
+    errno = 0;
+    unsigned long value = strtoul(text, &end, 10);
+    if (errno || *end || value > UINT32_MAX) return -1;
+    *id = (uint32_t)value;
+    return 0;
+}
+
+// ============================================================================
+// Comandos
+// ============================================================================
+
+static void commandSearch(ServerState *s, const char *term, FILE *out) {
+    PostingNode *results = searchTerm(s->index, term);
+    size_t rows = 0;
+    for (PostingNode *p = results; p; p = p->next) rows++;
+
+    fprintf(out, "OK %zu\n", rows);
+    for (PostingNode *p = results; p; p = p->next) {
+        DocumentInfo *doc = getDocumentById(s->collection, p->posting.doc_id);
+        fprintf(out, "%u\t%zu\t%s\t", p->posting.doc_id, p->posting.position_count,
+                doc ? doc->filename : "");
+        for (size_t j = 0; j < p->posting.position_count && j < SERVER_MAX_POSITIONS; j++) {
+            fprintf(out, j ? ",%zu" : "%zu", p->posting.positions[j]);
+        }
+        fputc('\n', out);
+    }
+}
+
+static void commandSimilarity(ServerState *s, const char *arg1, const char *arg2, FILE *out) {
+    uint32_t id1, id2;
+    if (parseDocId(arg1, &id1) != 0 || parseDocId(arg2, &id2) != 0) {
+        fprintf(out, "ERR uso: similarity <id1> <id2>\n");
+        return;
+    }
+    DocumentInfo *doc1 = getDocumentById(s->collection, id1);
+    DocumentInfo *doc2 = getDocumentById(s->collection, id2);
+    if (!doc1 || !doc2) {
+        fprintf(out, "ERR documento no encontrado\n");
+        return;
+    }
+
+    const TermVector *vector1 = forwardVector(&s->index->forward, id1);
+    const TermVector *vector2 = forwardVector(&s->index->forward, id2);
+    if (!vector1 || !vector2) {
+        fprintf(out, "ERR documento sin vector\n");
+    } else {
+        fprintf(out, "OK 1\n%.4f\t%.4f\n", jaccardTermVectors(vector1, vector2),
+                cosineTermVectors(vector1, vector2));
+    }
+}
+
+static void commandSimilar(ServerState *s, const char *arg, const char *k_arg, FILE *out) {
+    uint32_t target_id;
+    if (parseDocId(arg, &target_id) != 0) {
+        fprintf(out, "ERR uso: similar <id> [k]\n");
+        return;
+    }
+    int top_k = k_arg ? atoi(k_arg) : 5;
+    if (top_k <= 0) top_k = 5;
+
+    // El índice directo es de solo lectura: los hilos lo comparten sin lock
+    DocumentInfo *target = getDocumentById(s->collection, target_id);
+    const TermVector *target_vector = target ? forwardVector(&s->index->forward, target_id) : NULL;
+    if (!target_vector) {
+        fprintf(out, "ERR documento no encontrado\n");
+        return;
+    }
+    SimilarityResult *results = calloc(s->collection->count + 1, sizeof(SimilarityResult));
+    if (!results) {
+        fprintf(out, "ERR sin memoria\n");
+        return;
+    }
+
+    size_t valid = 0;
+    for (size_t i = 0; i < s->collection->count; i++) {
+        if (s->collection->docs[i].doc_id == target_id) continue;
+        const TermVector *vector = forwardVector(&s->index->forward, s->collection->docs[i].doc_id);
+        if (!vector) continue;
+        results[valid].doc_id = s->collection->docs[i].doc_id;
+        results[valid].filename = s->collection->docs[i].filename;
+        results[valid].similarity = cosineTermVectors(target_vector, vector);
+        valid++;
+    }
+    qsort(results, valid, sizeof(SimilarityResult), compare_similarity);
+
+    size_t rows = valid < (size_t)top_k ? valid : (size_t)top_k;
+    fprintf(out, "OK %zu\n", rows);
+    for (size_t i = 0; i < rows; i++) {
+        fprintf(out, "%u\t%.4f\t%s\n", results[i].doc_id, results[i].similarity,
+                results[i].filename);
+    }
+    free(results);
+}
+
+// Respuesta de search o similar desde la caché; si no está, se calcula y se
+// guarda solo si fue exitosa. Las claves llevan el prefijo "serve" porque el
+// archivo de caché se comparte con la CLI, que guarda otro formato.
+static void cachedCommand(ServerState *s, const char *command, const char *arg1,
+                          const char *arg2, FILE *out) {
+    // La clave contiene los argumentos completos: truncarlos haría que dos
+    // términos largos con el mismo comienzo compartieran respuesta
+    size_t key_size = (arg1 ? strlen(arg1) : 0) + (arg2 ? strlen(arg2) : 0) + 32;
+    char *key = malloc(key_size);
+    if (!key) {
+        fprintf(out, "ERR sin memoria\n");
+        return;
+    }
+    if (strcmp(command, "search") == 0) {
+        const char *prefix = "serve\tsearch\t";
+        snprintf(key, key_size, "%s%s", prefix, arg1);
+        char *term = key + strlen(prefix);   // Se normaliza dentro de la clave
+        convertir_a_minusculas(term);
+        limpiar_palabra(term);
+    } else {
+        snprintf(key, key_size, "serve\tsimilar\t%s\t%s", arg1 ? arg1 : "", arg2 ? arg2 : "");
+    }
+
+    size_t len;
+    char *cached = queryCacheGet(s->cache, key, &len);
+    if (cached) {
+        fwrite(cached, 1, len, out);
+        free(cached);
+        free(key);
+        return;
+    }
+
+    char *response = NULL;
+    size_t response_len = 0;
+    FILE *buffer = open_memstream(&response, &response_len);
+    if (!buffer) {
+        fprintf(out, "ERR sin memoria\n");
+        free(key);
+        return;
+    }
+    if (strcmp(command, "search") == 0) commandSearch(s, arg1, buffer);
+    else commandSimilar(s, arg1, arg2, buffer);
+    fclose(buffer);
+
+    if (strncmp(response, "OK", 2) == 0) queryCachePut(s->cache, key, response, response_len);
+    fwrite(response, 1, response_len, out);
+    free(response);
+    free(key);
+}
+
+// Atiende una línea de petición; 1 si el cliente pidió cerrar
+static int handleRequest(ServerState *s, char *line, FILE *out) {
+    line[strcspn(line, "\r\n")] = '\0';
+
+    char *saveptr = NULL;
+    char *command = strtok_r(line, " \t", &saveptr);
+    char *arg1 = strtok_r(NULL, " \t", &saveptr);
+    char *arg2 = strtok_r(NULL, " \t", &saveptr);
+
+    if (!command) {
+        fprintf(out, "ERR petición vacía\n");
+    } else if (strcmp(command, "search") == 0) {
+        if (arg1) cachedCommand(s, command, arg1, NULL, out);
+        else fprintf(out, "ERR uso: search <término>\n");
+    } else if (strcmp(command, "similarity") == 0) {
+        commandSimilarity(s, arg1, arg2, out);
+    } else if (strcmp(command, "similar") == 0) {
+        cachedCommand(s, command, arg1, arg2, out);
+    } else if (strcmp(command, "export") == 0) {
+        if (!arg1) fprintf(out, "ERR uso: export <archivo_salida>\n");
+        else if (exportIndexToText(s->index, s->collection, arg1) == 0) fprintf(out, "OK 0\n");
+        else fprintf(out, "ERR no se pudo exportar a %s\n", arg1);
+    } else if (strcmp(command, "info") == 0) {
+        pthread_mutex_lock(&s->cache->lock);
+        fprintf(out, "OK 1\n%zu\t%zu\t%u\t%zu\t%zu\n", s->index->size, s->collection->count,
+                s->cache->generation, s->cache->hits, s->cache->misses);
+        pthread_mutex_unlock(&s->cache->lock);
+    } else if (strcmp(command, "ping") == 0) {
+        fprintf(out, "OK 0\n");
+    } else if (strcmp(command, "quit") == 0) {
+        fprintf(out, "OK 0\n");
+        return 1;
+    } else {
+        fprintf(out, "ERR comando desconocido: %s\n", command);
+    }
+    return 0;
+}
+
+// Atiende una sesión hasta EOF o quit. Cada respuesta se arma completa en
+// memoria y se envía con un solo write.
+static void serveSession(ServerState *s, FILE *in, int out_fd) {
+    char *line = NULL;
+    size_t line_cap = 0;
+    while (getline(&line, &line_cap, in) > 0) {
+        char *response = NULL;
+        size_t response_len = 0;
+        FILE *out = open_memstream(&response, &response_len);
+        if (!out) break;
+        int quit = handleRequest(s, line, out);
+        fclose(out);
+
+        int failed = writeAll(out_fd, response, response_len) != 0;
+        free(response);
+        if (quit || failed) break;
+    }
+    free(line);
+}
+
+// ============================================================================
+// Pool de hilos sobre el socket
+// ============================================================================
+
+static int popConnection(ServerWorker *w) {
+    ConnectionQueue *q = w->queue;
+    pthread_mutex_lock(&q->lock);
+    while (q->count == 0 && !q->closing) {
+        pthread_cond_wait(&q->ready, &q->lock);
+    }
+    int fd = -1;
+    if (q->count > 0) {
+        fd = q->fds[q->head];
+        q->head = (q->head + 1) % SERVER_QUEUE_SIZE;
+        q->count--;
+        q->active[w->id] = fd;
+    }
+    pthread_mutex_unlock(&q->lock);
+    return fd;
+}
+
+// Se desmarca antes de cerrar para que la parada nunca toque un fd reutilizado
+static void releaseConnection(ServerWorker *w, FILE *in, int fd) {
+    pthread_mutex_lock(&w->queue->lock);
+    w->queue->active[w->id] = -1;
+    pthread_mutex_unlock(&w->queue->lock);
+    if (in) fclose(in);
+    else close(fd);
+}
+
+static int pushConnection(ConnectionQueue *q, int fd) {
+    pthread_mutex_lock(&q->lock);
+    int accepted = q->count < SERVER_QUEUE_SIZE;
+    if (accepted) {
+        q->fds[(q->head + q->count) % SERVER_QUEUE_SIZE] = fd;
+        q->count++;
+        pthread_cond_signal(&q->ready);
+    }
+    pthread_mutex_unlock(&q->lock);
+    return accepted ? 0 : -1;
+}
+
+static void* serverWorker(void *arg) {
+    ServerWorker *w = arg;
+    int fd;
+    while ((fd = popConnection(w)) >= 0) {
+        FILE *in = fdopen(fd, "r");
+        if (in) serveSession(w->state, in, fd);
+        releaseConnection(w, in, fd);
+    }
+    return NULL;
+}
+
+// Crea el socket de escucha. Si la ruta existe pero nadie responde, es el
+// socket de un servidor anterior que no terminó limpiamente y se reemplaza.
+static int openListenSocket(const char *path) {
+    struct sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (strlen(path) >= sizeof(addr.sun_path)) {
+        fprintf(stderr, "Ruta de socket demasiado larga: %s\n", path);
+        return -1;
+    }
+    strcpy(addr.sun_path, path);
+
+    int probe = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (probe >= 0) {
+        int alive = connect(probe, (struct sockaddr*)&addr, sizeof(addr)) == 0;
+        int stale = !alive && errno == ECONNREFUSED;
+        close(probe);
+        if (alive) {
+            fprintf(stderr, "Ya hay un servidor escuchando en %s\n", path);
+            return -1;
+        }
+        if (stale) unlink(path);
+    }
+
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) {
+        perror("socket");
+        return -1;
+    }
+    if (bind(fd, (struct sockaddr*)&addr, sizeof(addr)) != 0 || listen(fd, SOMAXCONN) != 0) {
+        perror("runServer: Error al abrir el socket");
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+static int serveSocket(ServerState *state, const char *socket_path, int num_threads) {
+    int listen_fd = openListenSocket(socket_path);
+    if (listen_fd < 0) return -1;
+
+    ConnectionQueue queue;
+    memset(&queue, 0, sizeof(queue));
+    pthread_mutex_init(&queue.lock, NULL);
+    pthread_cond_init(&queue.ready, NULL);
+    queue.active = malloc((size_t)num_threads * sizeof(int));
+    ServerWorker *workers = malloc((size_t)num_threads * sizeof(ServerWorker));
+    pthread_t *threads = malloc((size_t)num_threads * sizeof(pthread_t));
+    if (!queue.active || !workers || !threads) {
+        free(queue.active);
+        free(workers);
+        free(threads);
+        close(listen_fd);
+        unlink(socket_path);
+        return -1;
+    }
+
+    // Las señales de parada las recibe solo el hilo que hace accept
+    sigset_t stop_signals, previous;
+    sigemptyset(&stop_signals);
+    sigaddset(&stop_signals, SIGINT);
+    sigaddset(&stop_signals, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &stop_signals, &previous);
+    int started = 0;
+    for (int t = 0; t < num_threads; t++) {
+        workers[t].state = state;
+        workers[t].queue = &queue;
+        workers[t].id = t;
+        queue.active[t] = -1;
+        if (pthread_create(&threads[started], NULL, serverWorker, &workers[t]) == 0) {
+            started++;
+        }
+    }
+    pthread_sigmask(SIG_SETMASK, &previous, NULL);
+
+    fprintf(stderr, "Escuchando en %s con %d hilos (Ctrl+C para terminar)\n",
+            socket_path, started);
+
+    while (!stop_requested && started > 0) {
+        int fd = accept(listen_fd, NULL, NULL);
+        if (fd < 0) {
+            if (errno == EINTR || errno == ECONNABORTED) continue;
+            perror("accept");
+            break;
+        }
+        if (pushConnection(&queue, fd) != 0) {
+            const char *busy = "ERR servidor ocupado\n";
+            writeAll(fd, busy, strlen(busy));
+            close(fd);
+        }
+    }
+
+    // Despertar a los hilos: los que esperan en la cola salen y los que
+    // atienden una conexión ven EOF en su próxima lectura
+    pthread_mutex_lock(&queue.lock);
+    queue.closing = 1;
+    for (int t = 0; t < num_threads; t++) {
+        if (queue.active[t] >= 0) shutdown(queue.active[t], SHUT_RD);
+    }
+    while (queue.count > 0) {
+        close(queue.fds[queue.head]);
+        queue.head = (queue.head + 1) % SERVER_QUEUE_SIZE;
+        queue.count--;
+    }
+    pthread_cond_broadcast(&queue.ready);
+    pthread_mutex_unlock(&queue.lock);
+
+    for (int t = 0; t < started; t++) {
+        pthread_join(threads[t], NULL);
+    }
+
+    close(listen_fd);
+    unlink(socket_path);
+    pthread_mutex_destroy(&queue.lock);
+    pthread_cond_destroy(&queue.ready);
+    free(queue.active);
+    free(workers);
+    free(threads);
+    fprintf(stderr, "Servidor detenido\n");
+    return 0;
+}
+
+int runServer(const char *index_file, const char *socket_path, int num_threads) {
+    if (!index_file) return -1;
+    if (num_threads <= 0) num_threads = defaultThreadCount();
+
+    char *full_index_path = buildIndexPath(index_file);
+    if (!full_index_path) {
+        fprintf(stderr, "Error: No se pudo construir la ruta del índice\n");
+        return -1;
+    }
+
+    // En modo stdin la salida estándar es el canal del protocolo: los
+    // mensajes informativos (carga, export) se desvían a stderr
+    int out_fd = STDOUT_FILENO;
+    if (!socket_path) {
+        fflush(stdout);
+        out_fd = dup(STDOUT_FILENO);
+        if (out_fd < 0 || dup2(STDERR_FILENO, STDOUT_FILENO) < 0) {
+            perror("runServer: Error al redirigir stdout");
+            free(full_index_path);
+            return -1;
+        }
+    }
+
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    ServerState state = {0};
+    if (loadIndexFromBinary(&state.index, &state.collection, full_index_path) != 0) {
+        fprintf(stderr, "Error al cargar el índice desde: %s\n", full_index_path);
+        free(full_index_path);
+        if (!socket_path) close(out_fd);
+        return -1;
+    }
+
+    // La caché guardada sirve mientras la generación del índice no cambie
+    state.cache = createQueryCache(QUERY_CACHE_MAX_ENTRIES, QUERY_CACHE_MAX_BYTES,
+                                   state.index->generation, state.index->build_id);
+    if (!state.cache) {
+        fprintf(stderr, "Error: sin memoria para la caché de consultas\n");
+        destroyIndex(state.index);
+        destroyDocumentCollection(state.collection);
+        free(full_index_path);
+        if (!socket_path) close(out_fd);
+        return -1;
+    }
+    loadQueryCache(state.cache, full_index_path);
+
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double ms = (double)(end.tv_sec - start.tv_sec) * 1e3 + (double)(end.tv_nsec - start.tv_nsec) / 1e6;
+    fflush(stdout);
+    fprintf(stderr, "Índice residente en memoria (carga en %.1f ms)\n", ms);
+
+    // Un cliente que se va a mitad de respuesta no debe matar al servidor
+    signal(SIGPIPE, SIG_IGN);
+    struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = onStopSignal;
+    sigemptyset(&sa.sa_mask);
+    sigaction(SIGINT, &sa, NULL);
+    sigaction(SIGTERM, &sa, NULL);
+
+    int result = 0;
+    if (socket_path) {
+        result = serveSocket(&state, socket_path, num_threads);
+    } else {
+        serveSession(&state, stdin, out_fd);
+        close(out_fd);
+    }
+
+    saveQueryCache(state.cache, full_index_path);
+    destroyQueryCache(state.cache);
+    free(full_index_path);
+    destroyIndex(state.index);
+    destroyDocumentCollection(state.collection);
+    return result;
+}
@@ -4,6 +4,9 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
 
 //contador para benchmarking
 static size_t sa_char_comparisons = 0;
@@ -18,54 +21,203 @@ void buildMask(const char *pat, unsigned long long masks[256]) {
     }
 }
 
-void searchShiftAnd(const char *pattern, const char *text) {
+void buildMaskMulti(const char *pat, size_t M, size_t words,
+                    unsigned long long *masks) {
+    memset(masks, 0, 256 * words * sizeof(unsigned long long));
+    for (size_t i = 0; i < M; i++) {
+        unsigned char c = (unsigned char)pat[i];
+        masks[c * words + i / 64] |= (1ULL << (i % 64));
+    }
+}
+
+//conteo sin salida: acumula el bit de match de 64 caracteres en una
+//palabra y la suma con popcount, sin saltos dentro del lazo
+static size_t countShiftAnd(const unsigned long long *masks, size_t M,
+                            const char *text, size_t N) {
+    unsigned long long R = 0ULL;
+    unsigned int shift = (unsigned int)(M - 1);
+    size_t count = 0, i = 0;
+    while (i < N) {
+        size_t end = (N - i < 64) ? N : i + 64;
+        unsigned long long hits = 0ULL;
+        for (unsigned int k = 0; i < end; i++, k++) {
+            R = ((R << 1) | 1ULL) & masks[(unsigned char)text[i]];
+            hits |= ((R >> shift) & 1ULL) << k;
+        }
+        count += (size_t)__builtin_popcountll(hits);
+    }
+    return count;
+}
+
+//un paso del automata con R de varias palabras: R = ((R << 1) | 1) & mask,
+//propagando el bit alto de cada palabra a la siguiente
+static inline void stepMulti(unsigned long long *R, const unsigned long long *mask,
+                             size_t words) {
+#ifdef __AVX2__
+    //bloques de 4 palabras (words es multiplo de 4 en este modo)
+    unsigned long long carry = 1ULL;
+    for (size_t w = 0; w < words; w += 4) {
+        __m256i r = _mm256_loadu_si256((const __m256i*)(R + w));
+        __m256i m = _mm256_loadu_si256((const __m256i*)(mask + w));
+        //acarreo de cada palabra hacia la siguiente dentro del bloque
+        __m256i hi = _mm256_srli_epi64(r, 63);
+        __m256i up = _mm256_permute4x64_epi64(hi, _MM_SHUFFLE(2, 1, 0, 3));
+        up = _mm256_blend_epi32(up, _mm256_set_epi64x(0, 0, 0, (long long)carry), 0x03);
+        unsigned long long next = R[w + 3] >> 63;
+        r = _mm256_or_si256(_mm256_slli_epi64(r, 1), up);
+        _mm256_storeu_si256((__m256i*)(R + w), _mm256_and_si256(r, m));
+        carry = next;
+    }
+#else
+    unsigned long long carry = 1ULL;
+    for (size_t w = 0; w < words; w++) {
+        unsigned long long next = R[w] >> 63;
+        R[w] = ((R[w] << 1) | carry) & mask[w];
+        carry = next;
+    }
+#endif
+}
+
+ShiftAndPattern* compileShiftAnd(const char *pattern) {
+    if (!pattern) return NULL;
+    size_t M = strlen(pattern);
+    if (M == 0) return NULL;
+    ShiftAndPattern *p = malloc(sizeof(ShiftAndPattern));
+    if (!p) return NULL;
+    p->M = M;
+    p->words = (M + 63) / 64;
+#ifdef __AVX2__
+    //con avx2 el estado multi-palabra se procesa en carriles de 256 bits
+    if (p->words > 1) p->words = (p->words + 3) & ~(size_t)3;
+#endif
+    p->masks = malloc(256 * p->words * sizeof(unsigned long long));
+    if (!p->masks) {
+        free(p);
+        return NULL;
+    }
+    if (p->words == 1) buildMask(pattern, p->masks);
+    else buildMaskMulti(pattern, M, p->words, p->masks);
+    return p;
+}
+
+//version general para patrones de mas de 64 bytes
+static size_t execShiftAndMulti(const ShiftAndPattern *p, const char *text, size_t N,
+                                SearchMode mode, MatchCallback cb, void *ctx) {
+    size_t words = p->words, M = p->M;
+    unsigned long long *R = calloc(words, sizeof(unsigned long long));
+    if (!R) return 0;
+    size_t last = (M - 1) / 64;
+    unsigned long long matchBit = 1ULL << ((M - 1) % 64);
+    size_t count = 0;
+    for (size_t i = 0; i < N; i++) {
+        stepMulti(R, p->masks + (unsigned char)text[i] * words, words);
+        if (R[last] & matchBit) {
+            count++;
+            if (mode == SEARCH_COUNT) continue;
+            if (cb) cb(i + 1 - M, ctx);
+            if (mode == SEARCH_FIRST) break;
+        }
+    }
+    free(R);
+    return count;
+}
+
+size_t execShiftAnd(const ShiftAndPattern *p, const char *text, size_t N,
+                    SearchMode mode, MatchCallback cb, void *ctx) {
+    if (!p || !text) return 0;
+    if (p->words > 1) return execShiftAndMulti(p, text, N, mode, cb, ctx);
+    if (mode == SEARCH_COUNT) return countShiftAnd(p->masks, p->M, text, N);
+
+    unsigned long long R = 0ULL;
+    unsigned long long matchBit = 1ULL << (p->M - 1);
+    size_t count = 0;
+    for (size_t i = 0; i < N; i++) {
+        R = ((R << 1) | 1ULL) & p->masks[(unsigned char)text[i]];
+        if (R & matchBit) {
+            count++;
+            if (cb) cb(i + 1 - p->M, ctx);
+            if (mode == SEARCH_FIRST) break;
+        }
+    }
+    return count;
+}
+
+void freeShiftAnd(ShiftAndPattern *p) {
+    if (!p) return;
+    free(p->masks);
+    free(p);
+}
+
+//callback que imprime cada coincidencia como fila de tabla
+static void printSARow(size_t s, void *ctx) {
+    (void)ctx;
+    char pos[32];
+    sprintf(pos, "%zu", s);
+    const char *cells[] = { "sa", pos };
+    printTableRow(cells, 2);
+}
+
+size_t searchShiftAnd(const char *pattern, const char *text, SearchMode mode) {
     if (!pattern || !text) {
         printError("searchShiftAnd: patrón o texto NULL");
-        return;
+        return 0;
     }
     size_t M = strlen(pattern);
     size_t N = strlen(text);
     if (M == 0) {
         printError("searchShiftAnd: patrón vacío");
-        return;
+        return 0;
     }
     if (N == 0) {
         printError("searchShiftAnd: texto vacío");
-        return;
-    }
-    if (M > 64) {
-        printError("searchShiftAnd: patrón demasiado largo");
-        return;
+        return 0;
     }
 
     //reinicia contador
     sa_char_comparisons = 0;
 
-    unsigned long long masks[256];
-    buildMask(pattern, masks);
+    ShiftAndPattern *sp = compileShiftAnd(pattern);
+    if (!sp) {
+        printError("searchShiftAnd: malloc patrón falló");
+        return 0;
+    }
 
-    unsigned long long R = 0ULL;
-    unsigned long long matchBit = 1ULL << (M - 1);
+    if (mode != SEARCH_ALL) {
+        size_t first = 0;
+        size_t count = execShiftAnd(sp, text, N, mode, storeFirstMatch, &first);
+        freeShiftAnd(sp);
+        if (mode == SEARCH_FIRST && count > 0) printMatch(first, "sa");
+        else printMatchCount(count, "sa");
+        return count;
+    }
 
-    while (sa_char_comparisons = 0, 0) {}
+    size_t matches = 0;
+    if (sp->words > 1) {
+        //patron largo: estado de varias palabras
+        matches = execShiftAnd(sp, text, N, SEARCH_ALL, printSARow, NULL);
+        sa_char_comparisons = N;
+    } else {
+        const unsigned long long *masks = sp->masks;
+        unsigned long long R = 0ULL;
+        unsigned long long matchBit = 1ULL << (M - 1);
 
-    for (size_t i = 0; i < N; i++) {
-        //cuenta cada caracter procesado
-        sa_char_comparisons++;
+        for (size_t i = 0; i < N; i++) {
+            //cuenta cada caracter procesado
+            sa_char_comparisons++;
 
-        unsigned char c = (unsigned char)text[i];
-        R = ((R << 1) | 1ULL) & masks[c];
-        if (R & matchBit) {
-            //imprime coincidencia como fila de tabla
-            char pos[32];
-            sprintf(pos, "%zu", i - M + 1);
-            const char *cells[] = { "sa", pos };
-            printTableRow(cells, 2);
+            unsigned char c = (unsigned char)text[i];
+            R = ((R << 1) | 1ULL) & masks[c];
+            if (R & matchBit) {
+                matches++;
+                printSARow(i - M + 1, NULL);
+            }
         }
     }
 
+    freeShiftAnd(sp);
     printTableFooter(2);
 
     //imprime metricas
     printf("[Shift-And] Caracteres procesados: %zu\n", sa_char_comparisons);
-}
\ No newline at end of file
+    return matches;
+}
@@ -7,123 +7,81 @@
 #include <stdlib.h> 
 #include <stdint.h>
 
-double jaccard_similarity(const char *doc1, const char *doc2) {
-    size_t count1, count2;
-    char **tokens1 = tokenize(doc1, &count1);
-    char **tokens2 = tokenize(doc2, &count2);
-    
+int textTermVector(TermDictionary *dict, const char *text, TermVector *vector) {
+    size_t count = 0;
+    uint32_t *ids = tokenizeIds(dict, NULL, text, &count);
+    if (!ids && count > 0) return -1;
+    int result = buildTermVector(ids, count, vector);
+    free(ids);
+    return result;
+}
+
+//cada token de v1 cuenta en la intersección si su término está en v2
+double jaccardTermVectors(const TermVector *v1, const TermVector *v2) {
     size_t intersection = 0;
-    size_t union_size = count1 + count2;
-    
-    for (size_t i = 0; i < count1; i++) {
-        for (size_t j = 0; j < count2; j++) {
-            if (strcmp(tokens1[i], tokens2[j]) == 0) {
-                intersection++;
-                break;
-            }
+    size_t i = 0, j = 0;
+    while (i < v1->length && j < v2->length) {
+        if (v1->ids[i] < v2->ids[j]) i++;
+        else if (v1->ids[i] > v2->ids[j]) j++;
+        else {
+            intersection += v1->counts[i];
+            i++;
+            j++;
         }
     }
     
-    union_size -= intersection;
-    double similarity = (union_size == 0) ? 1.0 : (double)intersection / union_size;
-    
-    freeTokens(tokens1, count1);
-    freeTokens(tokens2, count2);
-    return similarity;
-}
-
-// Función auxiliar para duplicar cadenas
-static char* my_strdup(const char* str) {
-    if (!str) return NULL;
-    size_t len = strlen(str) + 1;
-    char* copy = malloc(len);
-    if (copy) memcpy(copy, str, len);
-    return copy;
+    size_t union_size = v1->total + v2->total - intersection;
+    return (union_size == 0) ? 1.0 : (double)intersection / union_size;
 }
 
-double cosine_similarity(const char *doc1, const char *doc2) {
-    size_t count1, count2;
-    char **tokens1 = tokenize(doc1, &count1);
-    char **tokens2 = tokenize(doc2, &count2);
-    
+//coseno de los vectores TF: mezcla de dos listas de ids ordenadas
+double cosineTermVectors(const TermVector *v1, const TermVector *v2) {
     double dot_product = 0.0;
     double mag1 = 0.0;
     double mag2 = 0.0;
     
-    // Construir vocabulario unificado
-    size_t vocab_size = count1 + count2;
-    char **vocab = malloc(vocab_size * sizeof(char*));
-    if (!vocab) {
-        freeTokens(tokens1, count1);
-        freeTokens(tokens2, count2);
-        return 0.0;
-    }
-    
-    size_t vocab_count = 0;
-    
-    // Añadir tokens del primer documento
-    for (size_t i = 0; i < count1; i++) {
-        vocab[vocab_count++] = my_strdup(tokens1[i]);
-    }
-    
-    // Añadir tokens del segundo documento (sin duplicados)
-    for (size_t i = 0; i < count2; i++) {
-        int found = 0;
-        for (size_t j = 0; j < vocab_count; j++) {
-            if (strcmp(tokens2[i], vocab[j]) == 0) {
-                found = 1;
-                break;
-            }
-        }
-        if (!found) {
-            vocab[vocab_count++] = my_strdup(tokens2[i]);
-        }
-    }
-    
-    // Calcular vectores TF
-    double *vector1 = calloc(vocab_count, sizeof(double));
-    double *vector2 = calloc(vocab_count, sizeof(double));
-    
-    if (!vector1 || !vector2) {
-        for (size_t i = 0; i < vocab_count; i++) free(vocab[i]);
-        free(vocab);
-        free(vector1);
-        free(vector2);
-        freeTokens(tokens1, count1);
-        freeTokens(tokens2, count2);
-        return 0.0;
-    }
+    for (size_t i = 0; i < v1->length; i++) mag1 += (double)v1->counts[i] * v1->counts[i];
+    for (size_t j = 0; j < v2->length; j++) mag2 += (double)v2->counts[j] * v2->counts[j];
     
-    for (size_t i = 0; i < vocab_count; i++) {
-        for (size_t j = 0; j < count1; j++) {
-            if (strcmp(vocab[i], tokens1[j]) == 0) {
-                vector1[i] += 1.0;
-            }
+    size_t i = 0, j = 0;
+    while (i < v1->length && j < v2->length) {
+        if (v1->ids[i] < v2->ids[j]) i++;
+        else if (v1->ids[i] > v2->ids[j]) j++;
+        else {
+            dot_product += (double)v1->counts[i] * v2->counts[j];
+            i++;
+            j++;
         }
-        for (size_t j = 0; j < count2; j++) {
-            if (strcmp(vocab[i], tokens2[j]) == 0) {
-                vector2[i] += 1.0;
-            }
-        }
-        
-        dot_product += vector1[i] * vector2[i];
-        mag1 += vector1[i] * vector1[i];
-        mag2 += vector2[i] * vector2[i];
     }
     
     mag1 = sqrt(mag1);
     mag2 = sqrt(mag2);
-    double similarity = (mag1 == 0 || mag2 == 0) ? 0.0 : dot_product / (mag1 * mag2);
+    return (mag1 == 0 || mag2 == 0) ? 0.0 : dot_product / (mag1 * mag2);
+}
+
+//los dos textos comparten un diccionario temporal: los ids solo valen aquí
+static double compareTexts(const char *doc1, const char *doc2,
+                           double (*measure)(const TermVector*, const TermVector*)) {
+    TermDictionary dict;
+    if (initTermDictionary(&dict, 1024) != 0) return 0.0;
     
-    // Liberar memoria
-    for (size_t i = 0; i < vocab_count; i++) {
-        free(vocab[i]);
+    TermVector v1, v2;
+    double similarity = 0.0;
+    if (textTermVector(&dict, doc1, &v1) == 0) {
+        if (textTermVector(&dict, doc2, &v2) == 0) {
+            similarity = measure(&v1, &v2);
+            freeTermVector(&v2);
+        }
+        freeTermVector(&v1);
     }
-    free(vocab);
-    free(vector1);
-    free(vector2);
-    freeTokens(tokens1, count1);
-    freeTokens(tokens2, count2);
-    
+    freeTermDictionary(&dict);
     return similarity;
-}
\ No newline at end of file
+}
+
+double jaccard_similarity(const char *doc1, const char *doc2) {
+    return compareTexts(doc1, doc2, jaccardTermVectors);
+}
+
+double cosine_similarity(const char *doc1, const char *doc2) {
+    return compareTexts(doc1, doc2, cosineTermVectors);
+}
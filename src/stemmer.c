@@ -0,0 +1,454 @@
+// Diego Galindo, Francisco Mercado
+#include "stemmer.h"
+#include <string.h>
+
+// Regla de sufijo: rule elige la acción en los pasos con casos especiales;
+// replacement (si no es NULL) reemplaza al sufijo. Ningún reemplazo es más
+// largo que su sufijo, así que todo se hace en el mismo búfer.
+typedef struct {
+    const char *suffix;
+    int rule;
+    const char *replacement;
+} SuffixRule;
+
+// Sufijo más largo de la lista con el que termina la palabra, empezando en
+// min_start o después; NULL si ninguno
+static const SuffixRule* longestRule(const char *w, size_t n, const SuffixRule *rules,
+                                     size_t min_start) {
+    const SuffixRule *best = NULL;
+    size_t best_len = 0;
+    for (const SuffixRule *r = rules; r->suffix; r++) {
+        size_t len = strlen(r->suffix);
+        if (len > n || len <= best_len || n - len < min_start) continue;
+        if (memcmp(w + n - len, r->suffix, len) == 0) {
+            best = r;
+            best_len = len;
+        }
+    }
+    return best;
+}
+
+static int endsWith(const char *w, size_t n, const char *suffix) {
+    size_t len = strlen(suffix);
+    return len <= n && memcmp(w + n - len, suffix, len) == 0;
+}
+
+// Reemplaza lo que va desde start por text; devuelve el nuevo largo
+static size_t replaceFrom(char *w, size_t start, const char *text) {
+    size_t len = strlen(text);
+    memcpy(w + start, text, len);
+    return start + len;
+}
+
+// R1 (desde start = 0) o R2 (desde start = R1): la región tras la primera
+// consonante que sigue a una vocal
+static size_t regionAfter(const char *w, size_t n, size_t start, int (*vowel)(char)) {
+    for (size_t i = start + 1; i < n; i++) {
+        if (vowel(w[i - 1]) && !vowel(w[i])) return i + 1;
+    }
+    return n;
+}
+
+// ============================================================================
+// Español
+// ============================================================================
+
+static int isVowelEs(char c) {
+    return c == 'a' || c == 'e' || c == 'i' || c == 'o' || c == 'u';
+}
+
+// RV: si la segunda letra es consonante, tras la siguiente vocal; si las dos
+// primeras son vocales, tras la siguiente consonante; si no, tras la tercera
+static size_t spanishRV(const char *w, size_t n) {
+    if (n < 2) return n;
+    if (!isVowelEs(w[1])) {
+        for (size_t i = 2; i < n; i++) {
+            if (isVowelEs(w[i])) return i + 1;
+        }
+        return n;
+    }
+    if (isVowelEs(w[0])) {
+        for (size_t i = 2; i < n; i++) {
+            if (!isVowelEs(w[i])) return i + 1;
+        }
+        return n;
+    }
+    return n < 3 ? n : 3;
+}
+
+static const SuffixRule SPANISH_PRONOUNS[] = {
+    {"me", 0, NULL}, {"se", 0, NULL}, {"sela", 0, NULL}, {"selo", 0, NULL},
+    {"selas", 0, NULL}, {"selos", 0, NULL}, {"la", 0, NULL}, {"le", 0, NULL},
+    {"lo", 0, NULL}, {"las", 0, NULL}, {"les", 0, NULL}, {"los", 0, NULL},
+    {"nos", 0, NULL}, {NULL, 0, NULL}
+};
+
+// Terminaciones verbales que admiten un pronombre pegado (1: tras "u")
+static const SuffixRule SPANISH_PRONOUN_HOSTS[] = {
+    {"iendo", 0, NULL}, {"ando", 0, NULL}, {"ar", 0, NULL}, {"er", 0, NULL},
+    {"ir", 0, NULL}, {"yendo", 1, NULL}, {NULL, 0, NULL}
+};
+
+// Paso 0: "dandole" -> "dando", "haciendolo" -> "haciendo"
+static size_t spanishPronoun(const char *w, size_t n, size_t rv) {
+    const SuffixRule *pronoun = longestRule(w, n, SPANISH_PRONOUNS, 0);
+    if (!pronoun) return n;
+    size_t stem = n - strlen(pronoun->suffix);
+    const SuffixRule *host = longestRule(w, stem, SPANISH_PRONOUN_HOSTS, 0);
+    if (!host || stem - strlen(host->suffix) < rv) return n;
+    if (host->rule == 1 && !endsWith(w, stem - strlen(host->suffix), "u")) return n;
+    return stem;
+}
+
+enum {
+    ES_DELETE = 1,   // Borrar en R2
+    ES_IC,           // Borrar en R2, y un "ic" previo en R2
+    ES_REPLACE,      // Reemplazar en R2
+    ES_AMENTE,       // Borrar en R1, y luego iv(at), os, ic o ad en R2
+    ES_MENTE,        // Borrar en R2, y luego ante, able o ible en R2
+    ES_IDAD,         // Borrar en R2, y luego abil, ic o iv en R2
+    ES_IVA           // Borrar en R2, y un "at" previo en R2
+};
+
+static const SuffixRule SPANISH_STANDARD[] = {
+    {"anza", ES_DELETE, NULL}, {"anzas", ES_DELETE, NULL}, {"ico", ES_DELETE, NULL},
+    {"ica", ES_DELETE, NULL}, {"icos", ES_DELETE, NULL}, {"icas", ES_DELETE, NULL},
+    {"ismo", ES_DELETE, NULL}, {"ismos", ES_DELETE, NULL}, {"able", ES_DELETE, NULL},
+    {"ables", ES_DELETE, NULL}, {"ible", ES_DELETE, NULL}, {"ibles", ES_DELETE, NULL},
+    {"ista", ES_DELETE, NULL}, {"istas", ES_DELETE, NULL}, {"oso", ES_DELETE, NULL},
+    {"osa", ES_DELETE, NULL}, {"osos", ES_DELETE, NULL}, {"osas", ES_DELETE, NULL},
+    {"amiento", ES_DELETE, NULL}, {"amientos", ES_DELETE, NULL},
+    {"imiento", ES_DELETE, NULL}, {"imientos", ES_DELETE, NULL},
+    {"adora", ES_IC, NULL}, {"ador", ES_IC, NULL}, {"acion", ES_IC, NULL},
+    {"adoras", ES_IC, NULL}, {"adores", ES_IC, NULL}, {"aciones", ES_IC, NULL},
+    {"ante", ES_IC, NULL}, {"antes", ES_IC, NULL}, {"ancia", ES_IC, NULL},
+    {"ancias", ES_IC, NULL},
+    {"logia", ES_REPLACE, "log"}, {"logias", ES_REPLACE, "log"},
+    {"ucion", ES_REPLACE, "u"}, {"uciones", ES_REPLACE, "u"},
+    {"encia", ES_REPLACE, "ente"}, {"encias", ES_REPLACE, "ente"},
+    {"amente", ES_AMENTE, NULL}, {"mente", ES_MENTE, NULL},
+    {"idad", ES_IDAD, NULL}, {"idades", ES_IDAD, NULL},
+    {"iva", ES_IVA, NULL}, {"ivo", ES_IVA, NULL}, {"ivas", ES_IVA, NULL},
+    {"ivos", ES_IVA, NULL}, {NULL, 0, NULL}
+};
+
+// Borra suffix si la palabra termina en él y empieza en la región
+static int deleteIn(const char *w, size_t *n, const char *suffix, size_t region) {
+    size_t len = strlen(suffix);
+    if (!endsWith(w, *n, suffix) || *n - len < region) return 0;
+    *n -= len;
+    return 1;
+}
+
+// Paso 1: sufijos derivativos; 1 si se quitó alguno
+static int spanishStandardSuffix(char *w, size_t *n, size_t r1, size_t r2) {
+    const SuffixRule *rule = longestRule(w, *n, SPANISH_STANDARD, 0);
+    if (!rule) return 0;
+    size_t start = *n - strlen(rule->suffix);
+    if (start < (rule->rule == ES_AMENTE ? r1 : r2)) return 0;
+    *n = rule->replacement ? replaceFrom(w, start, rule->replacement) : start;
+
+    switch (rule->rule) {
+        case ES_IC:
+            deleteIn(w, n, "ic", r2);
+            break;
+        case ES_AMENTE:
+            if (endsWith(w, *n, "iv")) {
+                if (deleteIn(w, n, "iv", r2)) deleteIn(w, n, "at", r2);
+            } else if (!deleteIn(w, n, "os", r2) && !deleteIn(w, n, "ic", r2)) {
+                deleteIn(w, n, "ad", r2);
+            }
+            break;
+        case ES_MENTE:
+            if (!deleteIn(w, n, "ante", r2) && !deleteIn(w, n, "able", r2)) {
+                deleteIn(w, n, "ible", r2);
+            }
+            break;
+        case ES_IDAD:
+            if (!deleteIn(w, n, "abil", r2) && !deleteIn(w, n, "ic", r2)) {
+                deleteIn(w, n, "iv", r2);
+            }
+            break;
+        case ES_IVA:
+            deleteIn(w, n, "at", r2);
+            break;
+    }
+    return 1;
+}
+
+static const SuffixRule SPANISH_Y_VERBS[] = {
+    {"ya", 0, NULL}, {"ye", 0, NULL}, {"yan", 0, NULL}, {"yen", 0, NULL},
+    {"yeron", 0, NULL}, {"yendo", 0, NULL}, {"yo", 0, NULL}, {"yas", 0, NULL},
+    {"yes", 0, NULL}, {"yais", 0, NULL}, {"yamos", 0, NULL}, {NULL, 0, NULL}
+};
+
+// Paso 2a: formas verbales con "y" tras una "u" ("huyendo" -> "hu")
+static int spanishYVerb(const char *w, size_t *n, size_t rv) {
+    const SuffixRule *rule = longestRule(w, *n, SPANISH_Y_VERBS, rv);
+    if (!rule) return 0;
+    size_t start = *n - strlen(rule->suffix);
+    if (start == 0 || w[start - 1] != 'u') return 0;
+    *n = start;
+    return 1;
+}
+
+// Las formas con tilde ya llegan plegadas ("aría" como "aria"); rule 1:
+// tras borrar, un "gu" final pierde la "u"
+static const SuffixRule SPANISH_VERBS[] = {
+    {"en", 1, NULL}, {"es", 1, NULL}, {"eis", 1, NULL}, {"emos", 1, NULL},
+    {"arian", 0, NULL}, {"arias", 0, NULL}, {"aran", 0, NULL}, {"aras", 0, NULL},
+    {"ariais", 0, NULL}, {"aria", 0, NULL}, {"areis", 0, NULL}, {"ariamos", 0, NULL},
+    {"aremos", 0, NULL}, {"ara", 0, NULL}, {"are", 0, NULL}, {"erian", 0, NULL},
+    {"erias", 0, NULL}, {"eran", 0, NULL}, {"eras", 0, NULL}, {"eriais", 0, NULL},
+    {"eria", 0, NULL}, {"ereis", 0, NULL}, {"eriamos", 0, NULL}, {"eremos", 0, NULL},
+    {"era", 0, NULL}, {"ere", 0, NULL}, {"irian", 0, NULL}, {"irias", 0, NULL},
+    {"iran", 0, NULL}, {"iras", 0, NULL}, {"iriais", 0, NULL}, {"iria", 0, NULL},
+    {"ireis", 0, NULL}, {"iriamos", 0, NULL}, {"iremos", 0, NULL}, {"ira", 0, NULL},
+    {"ire", 0, NULL}, {"aba", 0, NULL}, {"ada", 0, NULL}, {"ida", 0, NULL},
+    {"ia", 0, NULL}, {"iera", 0, NULL}, {"ad", 0, NULL}, {"ed", 0, NULL},
+    {"id", 0, NULL}, {"ase", 0, NULL}, {"iese", 0, NULL}, {"aste", 0, NULL},
+    {"iste", 0, NULL}, {"an", 0, NULL}, {"aban", 0, NULL}, {"ian", 0, NULL},
+    {"ieran", 0, NULL}, {"asen", 0, NULL}, {"iesen", 0, NULL}, {"aron", 0, NULL},
+    {"ieron", 0, NULL}, {"ado", 0, NULL}, {"ido", 0, NULL}, {"ando", 0, NULL},
+    {"iendo", 0, NULL}, {"io", 0, NULL}, {"ar", 0, NULL}, {"er", 0, NULL},
+    {"ir", 0, NULL}, {"as", 0, NULL}, {"abas", 0, NULL}, {"adas", 0, NULL},
+    {"idas", 0, NULL}, {"ias", 0, NULL}, {"ieras", 0, NULL}, {"ases", 0, NULL},
+    {"ieses", 0, NULL}, {"is", 0, NULL}, {"ais", 0, NULL}, {"abais", 0, NULL},
+    {"iais", 0, NULL}, {"arais", 0, NULL}, {"ierais", 0, NULL}, {"aseis", 0, NULL},
+    {"ieseis", 0, NULL}, {"asteis", 0, NULL}, {"isteis", 0, NULL}, {"ados", 0, NULL},
+    {"idos", 0, NULL}, {"amos", 0, NULL}, {"abamos", 0, NULL}, {"iamos", 0, NULL},
+    {"imos", 0, NULL}, {"aramos", 0, NULL}, {"ieramos", 0, NULL},
+    {"iesemos", 0, NULL}, {"asemos", 0, NULL}, {NULL, 0, NULL}
+};
+
+// Paso 2b: el resto de las terminaciones verbales, dentro de RV
+static void spanishVerb(const char *w, size_t *n, size_t rv) {
+    const SuffixRule *rule = longestRule(w, *n, SPANISH_VERBS, rv);
+    if (!rule) return;
+    *n -= strlen(rule->suffix);
+    if (rule->rule == 1 && endsWith(w, *n, "gu")) (*n)--;
+}
+
+// Paso 3: vocal final residual en RV ("-os", "-a", "-o", "-e"; un "gu"
+// previo a la "e" pierde la "u" si está en RV)
+static void spanishResidual(const char *w, size_t *n, size_t rv) {
+    if (deleteIn(w, n, "os", rv) || deleteIn(w, n, "a", rv) || deleteIn(w, n, "o", rv)) return;
+    if (deleteIn(w, n, "e", rv) && endsWith(w, *n, "gu") && *n - 1 >= rv) (*n)--;
+}
+
+size_t stemSpanish(char *w, size_t n) {
+    size_t rv = spanishRV(w, n);
+    size_t r1 = regionAfter(w, n, 0, isVowelEs);
+    size_t r2 = regionAfter(w, n, r1, isVowelEs);
+
+    n = spanishPronoun(w, n, rv);
+    if (!spanishStandardSuffix(w, &n, r1, r2) && !spanishYVerb(w, &n, rv)) {
+        spanishVerb(w, &n, rv);
+    }
+    spanishResidual(w, &n, rv);
+    w[n] = '\0';
+    return n;
+}
+
+// ============================================================================
+// Inglés (Porter2)
+// ============================================================================
+
+// La "y" que hace de consonante se marca como 'Y' mientras se trabaja
+static int isVowelEn(char c) {
+    return c == 'a' || c == 'e' || c == 'i' || c == 'o' || c == 'u' || c == 'y';
+}
+
+// Sílaba corta al final: consonante-vocal-consonante (la última no es w, x
+// ni Y) o, en una palabra de dos letras, vocal-consonante
+static int endsInShortSyllable(const char *w, size_t n) {
+    if (n == 2) return isVowelEn(w[0]) && !isVowelEn(w[1]);
+    if (n < 3) return 0;
+    char last = w[n - 1];
+    return !isVowelEn(w[n - 3]) && isVowelEn(w[n - 2]) && !isVowelEn(last) &&
+           last != 'w' && last != 'x' && last != 'Y';
+}
+
+static int hasVowel(const char *w, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        if (isVowelEn(w[i])) return 1;
+    }
+    return 0;
+}
+
+// Palabras con forma fija (se devuelven tal cual o con su raíz)
+static const char *const ENGLISH_EXCEPTIONS[][2] = {
+    {"skis", "ski"}, {"skies", "sky"}, {"dying", "die"}, {"lying", "lie"},
+    {"tying", "tie"}, {"idly", "idl"}, {"gently", "gentl"}, {"ugly", "ugli"},
+    {"early", "earli"}, {"only", "onli"}, {"singly", "singl"}, {"sky", "sky"},
+    {"news", "news"}, {"howe", "howe"}, {"atlas", "atlas"}, {"cosmos", "cosmos"},
+    {"bias", "bias"}, {"andes", "andes"}
+};
+
+// Invariantes tras el paso 1a
+static const char *const ENGLISH_INVARIANTS[] = {
+    "inning", "outing", "canning", "herring", "earring", "proceed", "exceed", "succeed"
+};
+
+enum {
+    EN_SSES = 1,   // sses -> ss
+    EN_IES,        // ied/ies -> i (o ie si queda una sola letra)
+    EN_S,          // s se borra si antes hay una vocal no contigua
+    EN_EED,        // eed/eedly -> ee en R1
+    EN_ED,         // ed/edly/ing/ingly se borran si antes hay una vocal
+    EN_OGI,        // ogi -> og tras "l"
+    EN_LI,         // li se borra tras c, d, e, g, h, k, m, n, r o t
+    EN_R2,         // Solo si el sufijo está en R2
+    EN_ION         // ion se borra en R2 tras "s" o "t"
+};
+
+static const SuffixRule ENGLISH_STEP1A[] = {
+    {"sses", EN_SSES, NULL}, {"ied", EN_IES, NULL}, {"ies", EN_IES, NULL},
+    {"s", EN_S, NULL}, {"us", 0, NULL}, {"ss", 0, NULL}, {NULL, 0, NULL}
+};
+
+static const SuffixRule ENGLISH_STEP1B[] = {
+    {"eed", EN_EED, NULL}, {"eedly", EN_EED, NULL}, {"ed", EN_ED, NULL},
+    {"edly", EN_ED, NULL}, {"ing", EN_ED, NULL}, {"ingly", EN_ED, NULL},
+    {NULL, 0, NULL}
+};
+
+static const SuffixRule ENGLISH_STEP2[] = {
+    {"tional", 0, "tion"}, {"enci", 0, "ence"}, {"anci", 0, "ance"},
+    {"abli", 0, "able"}, {"entli", 0, "ent"}, {"izer", 0, "ize"},
+    {"ization", 0, "ize"}, {"ational", 0, "ate"}, {"ation", 0, "ate"},
+    {"ator", 0, "ate"}, {"alism", 0, "al"}, {"aliti", 0, "al"}, {"alli", 0, "al"},
+    {"fulness", 0, "ful"}, {"ousli", 0, "ous"}, {"ousness", 0, "ous"},
+    {"iveness", 0, "ive"}, {"iviti", 0, "ive"}, {"biliti", 0, "ble"},
+    {"bli", 0, "ble"}, {"ogi", EN_OGI, "og"}, {"fulli", 0, "ful"},
+    {"lessli", 0, "less"}, {"li", EN_LI, ""}, {NULL, 0, NULL}
+};
+
+static const SuffixRule ENGLISH_STEP3[] = {
+    {"tional", 0, "tion"}, {"ational", 0, "ate"}, {"alize", 0, "al"},
+    {"icate", 0, "ic"}, {"iciti", 0, "ic"}, {"ical", 0, "ic"}, {"ful", 0, ""},
+    {"ness", 0, ""}, {"ative", EN_R2, ""}, {NULL, 0, NULL}
+};
+
+static const SuffixRule ENGLISH_STEP4[] = {
+    {"al", 0, NULL}, {"ance", 0, NULL}, {"ence", 0, NULL}, {"er", 0, NULL},
+    {"ic", 0, NULL}, {"able", 0, NULL}, {"ible", 0, NULL}, {"ant", 0, NULL},
+    {"ement", 0, NULL}, {"ment", 0, NULL}, {"ent", 0, NULL}, {"ism", 0, NULL},
+    {"ate", 0, NULL}, {"iti", 0, NULL}, {"ous", 0, NULL}, {"ive", 0, NULL},
+    {"ize", 0, NULL}, {"ion", EN_ION, NULL}, {NULL, 0, NULL}
+};
+
+static void englishStep1a(char *w, size_t *n) {
+    const SuffixRule *rule = longestRule(w, *n, ENGLISH_STEP1A, 0);
+    if (!rule) return;
+    size_t start = *n - strlen(rule->suffix);
+    if (rule->rule == EN_SSES) {
+        *n -= 2;
+    } else if (rule->rule == EN_IES) {
+        *n = replaceFrom(w, start, start > 1 ? "i" : "ie");
+    } else if (rule->rule == EN_S && start >= 2 && hasVowel(w, start - 1)) {
+        *n = start;
+    }
+}
+
+static void englishStep1b(char *w, size_t *n, size_t r1) {
+    const SuffixRule *rule = longestRule(w, *n, ENGLISH_STEP1B, 0);
+    if (!rule) return;
+    size_t start = *n - strlen(rule->suffix);
+    if (rule->rule == EN_EED) {
+        if (start >= r1) *n = replaceFrom(w, start, "ee");
+        return;
+    }
+    if (!hasVowel(w, start)) return;
+
+    *n = start;
+    if (endsWith(w, *n, "at") || endsWith(w, *n, "bl") || endsWith(w, *n, "iz")) {
+        w[(*n)++] = 'e';
+    } else if (*n >= 2 && w[*n - 1] == w[*n - 2] && strchr("bdfgmnprt", w[*n - 1])) {
+        (*n)--;
+    } else if (endsInShortSyllable(w, *n) && r1 >= *n) {
+        w[(*n)++] = 'e';
+    }
+}
+
+// Aplica la regla más larga de la lista si su sufijo está en la región
+static void englishReplace(char *w, size_t *n, const SuffixRule *rules, size_t r1, size_t r2) {
+    const SuffixRule *rule = longestRule(w, *n, rules, 0);
+    if (!rule) return;
+    size_t start = *n - strlen(rule->suffix);
+    if (start < r1) return;
+    if (rule->rule == EN_R2 && start < r2) return;
+    if (rule->rule == EN_OGI && (start == 0 || w[start - 1] != 'l')) return;
+    if (rule->rule == EN_LI && (start == 0 || !strchr("cdeghkmnrt", w[start - 1]))) return;
+    *n = replaceFrom(w, start, rule->replacement);
+}
+
+static void englishStep4(const char *w, size_t *n, size_t r2) {
+    const SuffixRule *rule = longestRule(w, *n, ENGLISH_STEP4, 0);
+    if (!rule) return;
+    size_t start = *n - strlen(rule->suffix);
+    if (start < r2) return;
+    if (rule->rule == EN_ION && (start == 0 || (w[start - 1] != 's' && w[start - 1] != 't'))) return;
+    *n = start;
+}
+
+static void englishStep5(const char *w, size_t *n, size_t r1, size_t r2) {
+    if (*n == 0) return;
+    size_t start = *n - 1;
+    if (w[start] == 'e') {
+        if (start >= r2 || (start >= r1 && !endsInShortSyllable(w, start))) *n = start;
+    } else if (w[start] == 'l') {
+        if (start >= r2 && start > 0 && w[start - 1] == 'l') *n = start;
+    }
+}
+
+static size_t finishEnglish(char *w, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        if (w[i] == 'Y') w[i] = 'y';
+    }
+    w[n] = '\0';
+    return n;
+}
+
+size_t stemEnglish(char *w, size_t n) {
+    if (n <= 2) return n;
+    for (size_t i = 0; i < sizeof(ENGLISH_EXCEPTIONS) / sizeof(ENGLISH_EXCEPTIONS[0]); i++) {
+        if (strlen(ENGLISH_EXCEPTIONS[i][0]) == n && memcmp(w, ENGLISH_EXCEPTIONS[i][0], n) == 0) {
+            return finishEnglish(w, replaceFrom(w, 0, ENGLISH_EXCEPTIONS[i][1]));
+        }
+    }
+
+    // Preludio: "y" inicial o tras vocal es consonante
+    if (w[0] == 'y') w[0] = 'Y';
+    for (size_t i = 1; i < n; i++) {
+        if (w[i] == 'y' && isVowelEn(w[i - 1])) w[i] = 'Y';
+    }
+
+    // R1 empieza tras estos prefijos aunque la regla general diga otra cosa
+    size_t r1;
+    if (n >= 5 && (memcmp(w, "gener", 5) == 0 || memcmp(w, "arsen", 5) == 0)) {
+        r1 = 5;
+    } else if (n >= 6 && memcmp(w, "commun", 6) == 0) {
+        r1 = 6;
+    } else {
+        r1 = regionAfter(w, n, 0, isVowelEn);
+    }
+    size_t r2 = regionAfter(w, n, r1, isVowelEn);
+
+    englishStep1a(w, &n);
+    for (size_t i = 0; i < sizeof(ENGLISH_INVARIANTS) / sizeof(ENGLISH_INVARIANTS[0]); i++) {
+        if (strlen(ENGLISH_INVARIANTS[i]) == n && memcmp(w, ENGLISH_INVARIANTS[i], n) == 0) {
+            return finishEnglish(w, n);
+        }
+    }
+    englishStep1b(w, &n, r1);
+
+    // Paso 1c: "y" final tras consonante (que no sea la primera letra) -> "i"
+    if (n > 2 && (w[n - 1] == 'y' || w[n - 1] == 'Y') && !isVowelEn(w[n - 2])) w[n - 1] = 'i';
+
+    englishReplace(w, &n, ENGLISH_STEP2, r1, r2);
+    englishReplace(w, &n, ENGLISH_STEP3, r1, r2);
+    englishStep4(w, &n, r2);
+    englishStep5(w, &n, r1, r2);
+    return finishEnglish(w, n);
+}
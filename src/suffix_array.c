@@ -0,0 +1,489 @@
+// Diego Galindo, Francisco Mercado
+#define _POSIX_C_SOURCE 200809L
+#include "suffix_array.h"
+#include "cli.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+//SA-IS (Nong, Zhang y Chan): se clasifica cada sufijo como S o L, se
+//ordenan los sufijos LMS por induccion, se nombran sus subcadenas y, si hay
+//nombres repetidos, se resuelve recursivamente el texto reducido.
+//en el nivel 0 el texto son bytes y el centinela (menor que todo) es
+//virtual: chr(n - 1) = 0 y cada byte vale b + 1, sin copiar el texto.
+//en la recursion el texto reducido es de enteros (cs == 4).
+
+#define tget(i) ((t[(i) >> 3] >> ((i) & 7)) & 1)
+#define tset(i, b) (t[(i) >> 3] = (unsigned char)((b) ? (t[(i) >> 3] | (1u << ((i) & 7))) \
+                                                      : (t[(i) >> 3] & ~(1u << ((i) & 7)))))
+#define chr(i) (cs == 4 ? ((const int32_t*)s)[i] \
+                        : ((i) == n - 1 ? 0 : (int32_t)((const unsigned char*)s)[i] + 1))
+#define isLMS(i) ((i) > 0 && tget(i) && !tget((i) - 1))
+
+//inicio (end = 0) o fin (end = 1) de cada cubeta
+static void getBuckets(const void *s, int32_t *bkt, int32_t n, int32_t K, int cs, int end) {
+    int32_t sum = 0;
+    for (int32_t i = 0; i <= K; i++) bkt[i] = 0;
+    for (int32_t i = 0; i < n; i++) bkt[chr(i)]++;
+    for (int32_t i = 0; i <= K; i++) {
+        sum += bkt[i];
+        bkt[i] = end ? sum : sum - bkt[i];
+    }
+}
+
+//induce los sufijos L de izquierda a derecha
+static void induceL(const unsigned char *t, int32_t *SA, const void *s, int32_t *bkt,
+                    int32_t n, int32_t K, int cs) {
+    getBuckets(s, bkt, n, K, cs, 0);
+    for (int32_t i = 0; i < n; i++) {
+        int32_t j = SA[i] - 1;
+        if (j >= 0 && !tget(j)) SA[bkt[chr(j)]++] = j;
+    }
+}
+
+//induce los sufijos S de derecha a izquierda
+static void induceS(const unsigned char *t, int32_t *SA, const void *s, int32_t *bkt,
+                    int32_t n, int32_t K, int cs) {
+    getBuckets(s, bkt, n, K, cs, 1);
+    for (int32_t i = n - 1; i >= 0; i--) {
+        int32_t j = SA[i] - 1;
+        if (j >= 0 && tget(j)) SA[--bkt[chr(j)]] = j;
+    }
+}
+
+//s[n - 1] es el centinela unico y menor; el alfabeto es 0..K
+static int sais(const void *s, int32_t *SA, int32_t n, int32_t K, int cs) {
+    unsigned char *t = calloc((size_t)n / 8 + 1, 1);
+    int32_t *bkt = malloc(((size_t)K + 1) * sizeof(int32_t));
+    if (!t || !bkt) {
+        free(t);
+        free(bkt);
+        return -1;
+    }
+
+    //tipos: el centinela es S y el anterior L
+    tset(n - 1, 1);
+    if (n >= 2) tset(n - 2, 0);
+    for (int32_t i = n - 3; i >= 0; i--) {
+        int32_t a = chr(i), b = chr(i + 1);
+        tset(i, a < b || (a == b && tget(i + 1)));
+    }
+
+    //etapa 1: ordenar las subcadenas LMS
+    getBuckets(s, bkt, n, K, cs, 1);
+    for (int32_t i = 0; i < n; i++) SA[i] = -1;
+    for (int32_t i = 1; i < n; i++) {
+        if (isLMS(i)) SA[--bkt[chr(i)]] = i;
+    }
+    induceL(t, SA, s, bkt, n, K, cs);
+    induceS(t, SA, s, bkt, n, K, cs);
+
+    //compactar las LMS ordenadas al inicio de SA
+    int32_t n1 = 0;
+    for (int32_t i = 0; i < n; i++) {
+        if (isLMS(SA[i])) SA[n1++] = SA[i];
+    }
+
+    //nombrar las subcadenas LMS; dos LMS distan al menos 2, asi que pos / 2
+    //no choca
+    for (int32_t i = n1; i < n; i++) SA[i] = -1;
+    int32_t name = 0, prev = -1;
+    for (int32_t i = 0; i < n1; i++) {
+        int32_t pos = SA[i];
+        int diff = 0;
+        for (int32_t d = 0; d < n; d++) {
+            if (prev == -1 || chr(pos + d) != chr(prev + d) || tget(pos + d) != tget(prev + d)) {
+                diff = 1;
+                break;
+            }
+            if (d > 0 && (isLMS(pos + d) || isLMS(prev + d))) break;
+        }
+        if (diff) {
+            name++;
+            prev = pos;
+        }
+        SA[n1 + pos / 2] = name - 1;
+    }
+    for (int32_t i = n - 1, j = n - 1; i >= n1; i--) {
+        if (SA[i] >= 0) SA[j--] = SA[i];
+    }
+
+    //etapa 2: ordenar el texto reducido (recursion si hay nombres repetidos)
+    int32_t *SA1 = SA, *s1 = SA + n - n1;
+    if (name < n1) {
+        if (sais(s1, SA1, n1, name - 1, 4) != 0) {
+            free(t);
+            free(bkt);
+            return -1;
+        }
+    } else {
+        for (int32_t i = 0; i < n1; i++) SA1[s1[i]] = i;
+    }
+
+    //etapa 3: colocar las LMS en orden e inducir el resto
+    getBuckets(s, bkt, n, K, cs, 1);
+    for (int32_t i = 1, j = 0; i < n; i++) {
+        if (isLMS(i)) s1[j++] = i;
+    }
+    for (int32_t i = 0; i < n1; i++) SA1[i] = s1[SA1[i]];
+    for (int32_t i = n1; i < n; i++) SA[i] = -1;
+    for (int32_t i = n1 - 1; i >= 0; i--) {
+        int32_t j = SA[i];
+        SA[i] = -1;
+        SA[--bkt[chr(j)]] = j;
+    }
+    induceL(t, SA, s, bkt, n, K, cs);
+    induceS(t, SA, s, bkt, n, K, cs);
+
+    free(t);
+    free(bkt);
+    return 0;
+}
+
+int buildSuffixArray(const unsigned char *text, size_t n, int32_t *SA) {
+    if (!text || !SA || n == 0 || n > SA_MAX_TEXT) return -1;
+    //SA tiene n + 1 lugares: el centinela queda primero y se descarta
+    if (sais(text, SA, (int32_t)n + 1, 256, 1) != 0) return -1;
+    memmove(SA, SA + 1, n * sizeof(int32_t));
+    return 0;
+}
+
+//phi[SA[i]] = SA[i - 1]; el LCP permutado (PLCP) baja a lo sumo 1 por
+//posicion del texto, asi que el calculo es lineal
+int buildLCPArray(const unsigned char *text, size_t n, const int32_t *SA, int32_t *LCP) {
+    if (!text || !SA || !LCP || n == 0) return -1;
+    int32_t *phi = malloc(n * sizeof(int32_t));
+    if (!phi) return -1;
+
+    phi[SA[0]] = -1;
+    for (size_t i = 1; i < n; i++) phi[SA[i]] = SA[i - 1];
+
+    //phi se reemplaza por PLCP en su lugar
+    size_t l = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (phi[i] < 0) {
+            phi[i] = 0;
+            l = 0;
+            continue;
+        }
+        size_t j = (size_t)phi[i];
+        while (i + l < n && j + l < n && text[i + l] == text[j + l]) l++;
+        phi[i] = (int32_t)l;
+        if (l > 0) l--;
+    }
+    for (size_t i = 0; i < n; i++) LCP[i] = phi[SA[i]];
+    free(phi);
+    return 0;
+}
+
+// ============================================================================
+// archivo .sa
+// ============================================================================
+
+static void putLE32(unsigned char *p, uint32_t v) {
+    p[0] = (unsigned char)v;
+    p[1] = (unsigned char)(v >> 8);
+    p[2] = (unsigned char)(v >> 16);
+    p[3] = (unsigned char)(v >> 24);
+}
+
+static uint32_t getLE32(const unsigned char *p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static void putLE64(unsigned char *p, uint64_t v) {
+    putLE32(p, (uint32_t)v);
+    putLE32(p + 4, (uint32_t)(v >> 32));
+}
+
+static uint64_t getLE64(const unsigned char *p) {
+    return (uint64_t)getLE32(p) | ((uint64_t)getLE32(p + 4) << 32);
+}
+
+static double elapsedMs(const struct timespec *a, const struct timespec *b) {
+    return (double)(b->tv_sec - a->tv_sec) * 1e3 + (double)(b->tv_nsec - a->tv_nsec) / 1e6;
+}
+
+//escribe un arreglo como u32 little-endian por tramos
+static int writeArray(FILE *file, const int32_t *values, size_t n) {
+    unsigned char buffer[65536];
+    size_t used = 0;
+    for (size_t i = 0; i < n; i++) {
+        putLE32(buffer + used, (uint32_t)values[i]);
+        used += 4;
+        if (used == sizeof(buffer) || i + 1 == n) {
+            if (fwrite(buffer, 1, used, file) != used) return -1;
+            used = 0;
+        }
+    }
+    return 0;
+}
+
+//mapea un archivo completo en solo lectura
+static void* mapFile(const char *path, size_t *size, struct stat *st) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return NULL;
+    if (fstat(fd, st) != 0 || st->st_size <= 0) {
+        close(fd);
+        return NULL;
+    }
+    *size = (size_t)st->st_size;
+    void *map = mmap(NULL, *size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    return map == MAP_FAILED ? NULL : map;
+}
+
+int buildSuffixArrayFile(const char *filename) {
+    size_t n;
+    struct stat st;
+    const unsigned char *text = mapFile(filename, &n, &st);
+    if (!text) {
+        fprintf(stderr, "sa-build: no se pudo leer %s: %s\n", filename,
+                errno ? strerror(errno) : "archivo vacío");
+        return -1;
+    }
+    if (n > SA_MAX_TEXT) {
+        fprintf(stderr, "sa-build: %s supera el máximo de %u bytes\n", filename, SA_MAX_TEXT);
+        munmap((void*)text, n);
+        return -1;
+    }
+
+    int32_t *SA = malloc((n + 1) * sizeof(int32_t));
+    int32_t *LCP = malloc(n * sizeof(int32_t));
+    if (!SA || !LCP) {
+        printError("sa-build: memoria insuficiente");
+        free(SA);
+        free(LCP);
+        munmap((void*)text, n);
+        return -1;
+    }
+
+    struct timespec t0, t1, t2;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    int failed = buildSuffixArray(text, n, SA) != 0;
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    if (!failed) failed = buildLCPArray(text, n, SA, LCP) != 0;
+    clock_gettime(CLOCK_MONOTONIC, &t2);
+
+    //se escribe a un temporal y se renombra: los lectores nunca ven un .sa a medias
+    char path[1024], tmp_path[1100];
+    snprintf(path, sizeof(path), "%s%s", filename, SA_FILE_SUFFIX);
+    snprintf(tmp_path, sizeof(tmp_path), "%s.tmp.%ld", path, (long)getpid());
+    FILE *file = failed ? NULL : fopen(tmp_path, "wb");
+    if (file) {
+        unsigned char header[SA_HEADER_SIZE] = {0};
+        putLE32(header, SA_FILE_MAGIC);
+        putLE32(header + 4, SA_FILE_VERSION);
+        putLE64(header + 8, (uint64_t)n);
+        putLE64(header + 16, (uint64_t)(int64_t)st.st_mtime);
+        failed = fwrite(header, 1, SA_HEADER_SIZE, file) != SA_HEADER_SIZE ||
+                 writeArray(file, SA, n) != 0 || writeArray(file, LCP, n) != 0;
+        if (fclose(file) != 0) failed = 1;
+        if (!failed && rename(tmp_path, path) != 0) failed = 1;
+        if (failed) unlink(tmp_path);
+    } else {
+        failed = 1;
+    }
+    free(SA);
+    free(LCP);
+    munmap((void*)text, n);
+
+    if (failed) {
+        fprintf(stderr, "sa-build: error al construir o escribir %s\n", path);
+        return -1;
+    }
+    printf("[SA] %s: %zu bytes\n", filename, n);
+    printf("[SA] SA-IS: %.2f ms, LCP: %.2f ms\n", elapsedMs(&t0, &t1), elapsedMs(&t1, &t2));
+    printf("[SA] Guardado en %s (%zu bytes)\n", path, SA_HEADER_SIZE + 8 * n);
+
+    SuffixIndex index;
+    if (openSuffixIndex(filename, &index) == 0) {
+        printSuffixStats(&index);
+        closeSuffixIndex(&index);
+    }
+    return 0;
+}
+
+int openSuffixIndex(const char *filename, SuffixIndex *index) {
+    memset(index, 0, sizeof(*index));
+    struct stat text_st, sa_st;
+    index->text_map = mapFile(filename, &index->text_map_size, &text_st);
+    if (!index->text_map) {
+        fprintf(stderr, "sa-search: no se pudo leer %s\n", filename);
+        return -1;
+    }
+
+    char path[1024];
+    snprintf(path, sizeof(path), "%s%s", filename, SA_FILE_SUFFIX);
+    index->sa_map = mapFile(path, &index->sa_map_size, &sa_st);
+    const unsigned char *raw = index->sa_map;
+    size_t n = index->text_map_size;
+    if (!raw || index->sa_map_size != SA_HEADER_SIZE + 8 * n ||
+        getLE32(raw) != SA_FILE_MAGIC || getLE32(raw + 4) != SA_FILE_VERSION ||
+        getLE64(raw + 8) != (uint64_t)n ||
+        (int64_t)getLE64(raw + 16) != (int64_t)text_st.st_mtime) {
+        fprintf(stderr, "sa-search: %s falta o no corresponde al texto actual; "
+                "ejecuta sa-build %s\n", path, filename);
+        closeSuffixIndex(index);
+        return -1;
+    }
+
+    index->text = index->text_map;
+    index->n = n;
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    //el header mide 32 bytes: los arreglos quedan alineados a 4
+    index->SA = (const uint32_t*)(raw + SA_HEADER_SIZE);
+    index->LCP = index->SA + n;
+#else
+    index->converted = malloc(2 * n * sizeof(uint32_t));
+    if (!index->converted) {
+        closeSuffixIndex(index);
+        return -1;
+    }
+    for (size_t i = 0; i < 2 * n; i++) {
+        index->converted[i] = getLE32(raw + SA_HEADER_SIZE + 4 * i);
+    }
+    index->SA = index->converted;
+    index->LCP = index->converted + n;
+#endif
+    return 0;
+}
+
+void closeSuffixIndex(SuffixIndex *index) {
+    if (!index) return;
+    if (index->text_map) munmap(index->text_map, index->text_map_size);
+    if (index->sa_map) munmap(index->sa_map, index->sa_map_size);
+    free(index->converted);
+    memset(index, 0, sizeof(*index));
+}
+
+// ============================================================================
+// busqueda
+// ============================================================================
+
+//compara el sufijo pos con pat en sus primeros M bytes (0: pat es prefijo).
+//el .sa no se recorre al abrirlo: una entrada fuera del texto (archivo
+//danado) se trata como mayor que todo en lugar de leer fuera del mapeo
+static int compareSuffix(const SuffixIndex *index, size_t pos, const char *pat, size_t M) {
+    if (pos >= index->n) return 1;
+    size_t len = index->n - pos;
+    int c = memcmp(index->text + pos, pat, len < M ? len : M);
+    if (c != 0) return c;
+    return len < M ? -1 : 0;
+}
+
+void suffixRange(const SuffixIndex *index, const char *pat, size_t M,
+                 size_t *lo, size_t *hi) {
+    //primer sufijo >= pat
+    size_t a = 0, b = index->n;
+    while (a < b) {
+        size_t mid = a + (b - a) / 2;
+        if (compareSuffix(index, index->SA[mid], pat, M) < 0) a = mid + 1;
+        else b = mid;
+    }
+    *lo = a;
+    //primer sufijo > pat (ya no lo tiene de prefijo)
+    b = index->n;
+    while (a < b) {
+        size_t mid = a + (b - a) / 2;
+        if (compareSuffix(index, index->SA[mid], pat, M) <= 0) a = mid + 1;
+        else b = mid;
+    }
+    *hi = a;
+}
+
+static int compareU32(const void *a, const void *b) {
+    uint32_t x = *(const uint32_t*)a, y = *(const uint32_t*)b;
+    return (x > y) - (x < y);
+}
+
+size_t searchSuffixArray(const SuffixIndex *index, const char *pattern, SearchMode mode) {
+    if (!index || !pattern || pattern[0] == '\0') {
+        printError("sa-search: patrón vacío");
+        return 0;
+    }
+    size_t M = strlen(pattern), lo, hi;
+    struct timespec t0, t1;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    suffixRange(index, pattern, M, &lo, &hi);
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    size_t matches = hi - lo;
+
+    //solo se validan las entradas que se van a informar
+    for (size_t i = lo; mode != SEARCH_COUNT && i < hi; i++) {
+        if (index->SA[i] >= index->n) {
+            printError("sa-search: el .sa está dañado (posición fuera del texto); ejecuta sa-build");
+            return 0;
+        }
+    }
+
+    if (mode == SEARCH_COUNT || matches == 0) {
+        printMatchCount(matches, "sa-search");
+    } else if (mode == SEARCH_FIRST) {
+        uint32_t first = index->SA[lo];
+        for (size_t i = lo + 1; i < hi; i++) {
+            if (index->SA[i] < first) first = index->SA[i];
+        }
+        printMatch(first, "sa-search");
+    } else {
+        //el rango de SA esta en orden lexicografico: se ordena por posicion
+        uint32_t *positions = malloc(matches * sizeof(uint32_t));
+        if (!positions) {
+            printError("sa-search: memoria insuficiente");
+            return 0;
+        }
+        memcpy(positions, index->SA + lo, matches * sizeof(uint32_t));
+        qsort(positions, matches, sizeof(uint32_t), compareU32);
+        for (size_t i = 0; i < matches; i++) {
+            char pos[32];
+            sprintf(pos, "%u", positions[i]);
+            const char *cells[] = { "sa-search", pos };
+            printTableRow(cells, 2);
+        }
+        printTableFooter(2);
+        free(positions);
+    }
+    printf("[SA] Rango [%zu, %zu) de %zu sufijos en %.3f ms\n", lo, hi, index->n,
+           elapsedMs(&t0, &t1));
+    return matches;
+}
+
+void printSuffixStats(const SuffixIndex *index) {
+    uint64_t sum = 0;
+    uint32_t best = 0;
+    size_t best_at = 0;
+    for (size_t i = 1; i < index->n; i++) {
+        //acotado al largo de ambos sufijos: un .sa danado no lee fuera del texto
+        uint32_t lcp = index->LCP[i];
+        uint32_t a = index->SA[i - 1], b = index->SA[i];
+        if (a >= index->n || b >= index->n) lcp = 0;
+        else if (lcp > index->n - (a > b ? a : b)) lcp = (uint32_t)(index->n - (a > b ? a : b));
+        sum += lcp;
+        if (lcp > best) {
+            best = lcp;
+            best_at = i;
+        }
+    }
+    uint64_t n = index->n;
+    printf("[SA] LCP medio: %.2f\n", n > 1 ? (double)sum / (double)(n - 1) : 0.0);
+    printf("[SA] Subcadenas distintas: %llu\n",
+           (unsigned long long)(n * (n + 1) / 2 - sum));
+    printf("[SA] Subcadena repetida más larga: %u bytes", best);
+    if (best == 0) {
+        printf("\n");
+        return;
+    }
+
+    //se muestra hasta 60 bytes, con los no imprimibles como '.'
+    const unsigned char *s = index->text + index->SA[best_at];
+    size_t shown = best < 60 ? best : 60;
+    printf(" en las posiciones %u y %u: \"", index->SA[best_at - 1], index->SA[best_at]);
+    for (size_t i = 0; i < shown; i++) putchar(s[i] >= 32 && s[i] < 127 ? s[i] : '.');
+    printf("%s\"\n", shown < best ? "..." : "");
+}
@@ -0,0 +1,163 @@
+// Diego Galindo, Francisco Mercado
+#include "term_ids.h"
+#include <stdlib.h>
+#include <string.h>
+
+static uint32_t hashBytes(const char *s, size_t len) {
+    uint32_t hash = 2166136261u;  // FNV-1a
+    for (size_t i = 0; i < len; i++) {
+        hash ^= (unsigned char)s[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+int initTermDictionary(TermDictionary *dict, size_t initial_capacity) {
+    memset(dict, 0, sizeof(*dict));
+    if (initial_capacity < 16) initial_capacity = 16;
+    size_t slot_capacity = 32;
+    while (slot_capacity < initial_capacity * 2) slot_capacity *= 2;
+
+    dict->terms = malloc(initial_capacity * sizeof(char*));
+    dict->slots = calloc(slot_capacity, sizeof(uint32_t));
+    if (!dict->terms || !dict->slots) {
+        free(dict->terms);
+        free(dict->slots);
+        memset(dict, 0, sizeof(*dict));
+        return -1;
+    }
+    dict->capacity = initial_capacity;
+    dict->slot_capacity = slot_capacity;
+    return 0;
+}
+
+void freeTermDictionary(TermDictionary *dict) {
+    if (!dict) return;
+    for (size_t i = 0; i < dict->count; i++) free(dict->terms[i]);
+    free(dict->terms);
+    free(dict->slots);
+    memset(dict, 0, sizeof(*dict));
+}
+
+// Slot del término o el slot libre donde iría
+static size_t findSlot(const TermDictionary *dict, const char *term, size_t len) {
+    size_t mask = dict->slot_capacity - 1;
+    size_t slot = hashBytes(term, len) & mask;
+    while (dict->slots[slot]) {
+        const char *candidate = dict->terms[dict->slots[slot] - 1];
+        if (strncmp(candidate, term, len) == 0 && candidate[len] == '\0') break;
+        slot = (slot + 1) & mask;
+    }
+    return slot;
+}
+
+static int growSlots(TermDictionary *dict) {
+    size_t capacity = dict->slot_capacity * 2;
+    uint32_t *slots = calloc(capacity, sizeof(uint32_t));
+    if (!slots) return -1;
+    for (size_t id = 0; id < dict->count; id++) {
+        size_t slot = hashBytes(dict->terms[id], strlen(dict->terms[id])) & (capacity - 1);
+        while (slots[slot]) slot = (slot + 1) & (capacity - 1);
+        slots[slot] = (uint32_t)id + 1;
+    }
+    free(dict->slots);
+    dict->slots = slots;
+    dict->slot_capacity = capacity;
+    return 0;
+}
+
+uint32_t internTerm(TermDictionary *dict, const char *term, size_t len) {
+    if (!dict || !term) return TERM_ID_NONE;
+    size_t slot = findSlot(dict, term, len);
+    if (dict->slots[slot]) return dict->slots[slot] - 1;
+    if (dict->count >= TERM_ID_NONE - 1) return TERM_ID_NONE;
+
+    // Factor de carga máximo del 50%
+    if ((dict->count + 1) * 2 > dict->slot_capacity) {
+        if (growSlots(dict) != 0) return TERM_ID_NONE;
+        slot = findSlot(dict, term, len);
+    }
+    if (dict->count == dict->capacity) {
+        size_t capacity = dict->capacity * 2;
+        char **grown = realloc(dict->terms, capacity * sizeof(char*));
+        if (!grown) return TERM_ID_NONE;
+        dict->terms = grown;
+        dict->capacity = capacity;
+    }
+
+    char *copy = malloc(len + 1);
+    if (!copy) return TERM_ID_NONE;
+    memcpy(copy, term, len);
+    copy[len] = '\0';
+
+    uint32_t id = (uint32_t)dict->count++;
+    dict->terms[id] = copy;
+    dict->slots[slot] = id + 1;
+    return id;
+}
+
+uint32_t lookupTerm(const TermDictionary *dict, const char *term) {
+    if (!dict || !term || !dict->slots) return TERM_ID_NONE;
+    size_t slot = findSlot(dict, term, strlen(term));
+    return dict->slots[slot] ? dict->slots[slot] - 1 : TERM_ID_NONE;
+}
+
+static int compareIds(const void *a, const void *b) {
+    uint32_t x = *(const uint32_t*)a, y = *(const uint32_t*)b;
+    return (x > y) - (x < y);
+}
+
+int buildTermVector(const uint32_t *token_ids, size_t count, TermVector *vector) {
+    memset(vector, 0, sizeof(*vector));
+    uint32_t *sorted = malloc((count + 1) * sizeof(uint32_t));
+    if (!sorted) return -1;
+    size_t n = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (token_ids[i] != TERM_ID_NONE) sorted[n++] = token_ids[i];
+    }
+    qsort(sorted, n, sizeof(uint32_t), compareIds);
+
+    // Se agrupa sobre el mismo arreglo: ids únicos al frente, conteos aparte
+    uint32_t *counts = malloc((n + 1) * sizeof(uint32_t));
+    if (!counts) {
+        free(sorted);
+        return -1;
+    }
+    size_t length = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (length > 0 && sorted[length - 1] == sorted[i]) {
+            counts[length - 1]++;
+        } else {
+            sorted[length] = sorted[i];
+            counts[length++] = 1;
+        }
+    }
+    vector->ids = sorted;
+    vector->counts = counts;
+    vector->length = length;
+    vector->total = n;
+    return 0;
+}
+
+void sortTermVector(TermVector *vector) {
+    uint32_t (*pairs)[2] = malloc((vector->length + 1) * sizeof(*pairs));
+    if (!pairs) return;
+    for (size_t i = 0; i < vector->length; i++) {
+        pairs[i][0] = vector->ids[i];
+        pairs[i][1] = vector->counts[i];
+    }
+    // compareIds mira el primer campo del par: el id
+    qsort(pairs, vector->length, sizeof(*pairs), compareIds);
+    for (size_t i = 0; i < vector->length; i++) {
+        vector->ids[i] = pairs[i][0];
+        vector->counts[i] = pairs[i][1];
+    }
+    free(pairs);
+}
+
+void freeTermVector(TermVector *vector) {
+    if (!vector) return;
+    free(vector->ids);
+    free(vector->counts);
+    memset(vector, 0, sizeof(*vector));
+}
@@ -0,0 +1,110 @@
+// Diego Galindo, Francisco Mercado
+#define _POSIX_C_SOURCE 200809L
+#include "term_query.h"
+#include "utils.h"
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Minúsculas y solo alfanuméricos (como limpiar_palabra), conservando los
+// comodines si se piden
+static char* normalizeTermText(const char *text, int keep_wildcards) {
+    char *copy = strdup(text);
+    if (!copy) return NULL;
+    convertir_a_minusculas(copy);
+    size_t j = 0;
+    for (size_t i = 0; copy[i]; i++) {
+        unsigned char c = (unsigned char)copy[i];
+        if (isalnum(c) || (keep_wildcards && (c == '*' || c == '?'))) copy[j++] = (char)c;
+    }
+    copy[j] = '\0';
+    return copy;
+}
+
+int parseTermPattern(const char *pattern, TermQuery *query) {
+    memset(query, 0, sizeof(*query));
+    if (!pattern) return -1;
+    query->pattern = normalizeTermText(pattern, 1);
+    if (!query->pattern) return -1;
+
+    size_t literal_len = strcspn(query->pattern, "*?");
+    query->literal = strndup(query->pattern, literal_len);
+    if (!query->literal) {
+        freeTermQuery(query);
+        return -1;
+    }
+    query->literal_len = literal_len;
+
+    // "algorit*" no necesita el comparador de comodines
+    const char *rest = query->pattern + literal_len;
+    query->kind = strcmp(rest, "*") == 0 ? TERM_QUERY_PREFIX : TERM_QUERY_WILDCARD;
+    return 0;
+}
+
+int parseTermRange(const char *low, const char *high, TermQuery *query) {
+    memset(query, 0, sizeof(*query));
+    if (!low || !high) return -1;
+    query->kind = TERM_QUERY_RANGE;
+    query->pattern = normalizeTermText(low, 0);
+    query->high = normalizeTermText(high, 0);
+    query->literal = strdup("");
+    if (!query->pattern || !query->high || !query->literal) {
+        freeTermQuery(query);
+        return -1;
+    }
+    return 0;
+}
+
+void freeTermQuery(TermQuery *query) {
+    if (!query) return;
+    free(query->pattern);
+    free(query->high);
+    free(query->literal);
+    memset(query, 0, sizeof(*query));
+}
+
+const char* termQueryStart(const TermQuery *query) {
+    return query->kind == TERM_QUERY_RANGE ? query->pattern : query->literal;
+}
+
+int termQueryPastEnd(const TermQuery *query, const char *term) {
+    if (query->kind == TERM_QUERY_RANGE) {
+        return query->high[0] && strcmp(term, query->high) > 0;
+    }
+    // Los términos con el prefijo literal son contiguos; el primero que no
+    // lo tiene y es mayor cierra la región
+    return strncmp(term, query->literal, query->literal_len) > 0;
+}
+
+// * y ? con retroceso al último *: lineal en la práctica
+static int wildcardMatch(const char *pattern, const char *text) {
+    const char *star = NULL, *resume = NULL;
+    while (*text) {
+        if (*pattern == '?' || (*pattern != '*' && *pattern == *text)) {
+            pattern++;
+            text++;
+        } else if (*pattern == '*') {
+            star = pattern++;
+            resume = text;
+        } else if (star) {
+            pattern = star + 1;
+            text = ++resume;
+        } else {
+            return 0;
+        }
+    }
+    while (*pattern == '*') pattern++;
+    return *pattern == '\0';
+}
+
+int termQueryMatches(const TermQuery *query, const char *term) {
+    switch (query->kind) {
+        case TERM_QUERY_PREFIX:
+            return strncmp(term, query->literal, query->literal_len) == 0;
+        case TERM_QUERY_RANGE:
+            return strcmp(term, query->pattern) >= 0 && !termQueryPastEnd(query, term);
+        case TERM_QUERY_WILDCARD:
+            return wildcardMatch(query->pattern, term);
+    }
+    return 0;
+}
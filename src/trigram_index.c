@@ -0,0 +1,412 @@
+// Diego Galindo, Francisco Mercado
+#define _POSIX_C_SOURCE 200809L
+#include "trigram_index.h"
+#include "utils.h"
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/types.h>
+
+#define TRIGRAM_SPACE (1u << 24)
+
+static void trigramPath(const char *index_path, char *out, size_t size) {
+    snprintf(out, size, "%s%s", index_path, TRIGRAM_INDEX_SUFFIX);
+}
+
+static inline uint32_t trigramAt(const unsigned char *p) {
+    return ((uint32_t)p[0] << 16) | ((uint32_t)p[1] << 8) | p[2];
+}
+
+static int compareU64(const void *a, const void *b) {
+    uint64_t x = *(const uint64_t*)a, y = *(const uint64_t*)b;
+    return (x > y) - (x < y);
+}
+
+static int compareU32(const void *a, const void *b) {
+    uint32_t x = *(const uint32_t*)a, y = *(const uint32_t*)b;
+    return (x > y) - (x < y);
+}
+
+static int writeU32(FILE *file, uint32_t value) {
+    unsigned char raw[4] = { (unsigned char)value, (unsigned char)(value >> 8),
+                             (unsigned char)(value >> 16), (unsigned char)(value >> 24) };
+    return fwrite(raw, 1, 4, file) != 4;
+}
+
+static int writeU64(FILE *file, uint64_t value) {
+    return writeU32(file, (uint32_t)value) || writeU32(file, (uint32_t)(value >> 32));
+}
+
+static int readU32(FILE *file, uint32_t *value) {
+    unsigned char raw[4];
+    if (fread(raw, 1, 4, file) != 4) return -1;
+    *value = (uint32_t)raw[0] | ((uint32_t)raw[1] << 8) |
+             ((uint32_t)raw[2] << 16) | ((uint32_t)raw[3] << 24);
+    return 0;
+}
+
+static size_t varintSize(uint32_t v) {
+    size_t n = 1;
+    while (v >= 0x80) {
+        v >>= 7;
+        n++;
+    }
+    return n;
+}
+
+static int writeVarint(FILE *file, uint32_t v) {
+    while (v >= 0x80) {
+        if (putc((int)((v & 0x7F) | 0x80), file) == EOF) return -1;
+        v >>= 7;
+    }
+    return putc((int)v, file) == EOF ? -1 : 0;
+}
+
+static int readVarint(FILE *file, uint32_t *value) {
+    uint32_t v = 0;
+    for (int shift = 0; shift < 35; shift += 7) {
+        int byte = getc(file);
+        if (byte == EOF) return -1;
+        v |= (uint32_t)(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) {
+            *value = v;
+            return 0;
+        }
+    }
+    return -1;
+}
+
+// ============================================================================
+// Construcción
+// ============================================================================
+
+int initTrigramBuilder(TrigramBuilder *builder) {
+    memset(builder, 0, sizeof(*builder));
+    builder->seen = calloc(TRIGRAM_SPACE / 8, 1);
+    return builder->seen ? 0 : -1;
+}
+
+void freeTrigramBuilder(TrigramBuilder *builder) {
+    if (!builder) return;
+    free(builder->pairs);
+    free(builder->docs);
+    free(builder->seen);
+    memset(builder, 0, sizeof(*builder));
+}
+
+static int pushPair(TrigramBuilder *builder, uint32_t trigram, uint32_t doc_id) {
+    if (builder->count == builder->capacity) {
+        size_t capacity = builder->capacity ? builder->capacity * 2 : 65536;
+        uint64_t *grown = realloc(builder->pairs, capacity * sizeof(uint64_t));
+        if (!grown) return -1;
+        builder->pairs = grown;
+        builder->capacity = capacity;
+    }
+    builder->pairs[builder->count++] = ((uint64_t)trigram << 32) | doc_id;
+    return 0;
+}
+
+static int pushDoc(TrigramBuilder *builder, uint32_t doc_id) {
+    if (builder->doc_count == builder->doc_capacity) {
+        size_t capacity = builder->doc_capacity ? builder->doc_capacity * 2 : 256;
+        uint32_t *grown = realloc(builder->docs, capacity * sizeof(uint32_t));
+        if (!grown) return -1;
+        builder->docs = grown;
+        builder->doc_capacity = capacity;
+    }
+    builder->docs[builder->doc_count++] = doc_id;
+    return 0;
+}
+
+int addTrigramText(TrigramBuilder *builder, uint32_t doc_id, const char *text, size_t len) {
+    if (!builder || !builder->seen || !text) return -1;
+    if (pushDoc(builder, doc_id) != 0) return -1;
+
+    // Un par por trigrama distinto del documento; el bitmap se limpia
+    // recorriendo solo los pares recién añadidos
+    const unsigned char *bytes = (const unsigned char*)text;
+    size_t first = builder->count;
+    int result = 0;
+    for (size_t i = 0; i + 3 <= len && result == 0; i++) {
+        uint32_t trigram = trigramAt(bytes + i);
+        uint8_t bit = (uint8_t)(1u << (trigram & 7));
+        if (builder->seen[trigram >> 3] & bit) continue;
+        result = pushPair(builder, trigram, doc_id);
+        if (result == 0) builder->seen[trigram >> 3] |= bit;
+    }
+    for (size_t i = first; i < builder->count; i++) {
+        builder->seen[(builder->pairs[i] >> 32) >> 3] = 0;
+    }
+    return result;
+}
+
+int addTrigramFile(TrigramBuilder *builder, uint32_t doc_id, const char *path) {
+    char *text = loadFile(path);
+    if (!text) return -1;
+    // Mismo largo que usa grep (hasta el primer byte nulo)
+    int result = addTrigramText(builder, doc_id, text, strlen(text));
+    free(text);
+    return result;
+}
+
+int loadTrigramBuilder(TrigramBuilder *builder, const char *index_path) {
+    char path[1024];
+    trigramPath(index_path, path, sizeof(path));
+    FILE *file = fopen(path, "rb");
+    if (!file) return errno == ENOENT ? 1 : -1;
+
+    uint32_t magic, version, doc_count, count;
+    int failed = readU32(file, &magic) || readU32(file, &version) ||
+                 readU32(file, &doc_count) || readU32(file, &count) ||
+                 magic != TRIGRAM_INDEX_MAGIC || version != TRIGRAM_INDEX_VERSION;
+    for (uint32_t i = 0; i < doc_count && !failed; i++) {
+        uint32_t doc_id;
+        failed = readU32(file, &doc_id) || pushDoc(builder, doc_id);
+    }
+
+    // La tabla precede a las listas, que van en el mismo orden
+    uint32_t *trigrams = failed ? NULL : malloc(((size_t)count + 1) * 2 * sizeof(uint32_t));
+    if (!trigrams) failed = 1;
+    for (uint32_t i = 0; i < count && !failed; i++) {
+        unsigned char offset[8];
+        failed = readU32(file, &trigrams[2 * i]) || readU32(file, &trigrams[2 * i + 1]) ||
+                 fread(offset, 1, 8, file) != 8;
+    }
+    for (uint32_t i = 0; i < count && !failed; i++) {
+        uint32_t doc_id = 0;
+        for (uint32_t k = 0; k < trigrams[2 * i + 1] && !failed; k++) {
+            uint32_t delta;
+            failed = readVarint(file, &delta) ||
+                     pushPair(builder, trigrams[2 * i], doc_id += delta);
+        }
+    }
+    free(trigrams);
+    fclose(file);
+    if (failed) fprintf(stderr, "%s: índice de trigramas dañado\n", path);
+    return failed ? -1 : 0;
+}
+
+int saveTrigramIndex(TrigramBuilder *builder, const char *index_path) {
+    if (!builder || !index_path) return -1;
+
+    // Pares ordenados por trigrama y doc_id, sin repetidos
+    qsort(builder->pairs, builder->count, sizeof(uint64_t), compareU64);
+    size_t unique = 0;
+    for (size_t i = 0; i < builder->count; i++) {
+        if (unique == 0 || builder->pairs[unique - 1] != builder->pairs[i]) {
+            builder->pairs[unique++] = builder->pairs[i];
+        }
+    }
+    builder->count = unique;
+    qsort(builder->docs, builder->doc_count, sizeof(uint32_t), compareU32);
+    size_t doc_count = 0;
+    for (size_t i = 0; i < builder->doc_count; i++) {
+        if (doc_count == 0 || builder->docs[doc_count - 1] != builder->docs[i]) {
+            builder->docs[doc_count++] = builder->docs[i];
+        }
+    }
+    builder->doc_count = doc_count;
+
+    size_t trigram_count = 0;
+    for (size_t i = 0; i < builder->count; i++) {
+        if (i == 0 || (builder->pairs[i] >> 32) != (builder->pairs[i - 1] >> 32)) trigram_count++;
+    }
+
+    char path[1024], tmp_path[1100];
+    trigramPath(index_path, path, sizeof(path));
+    snprintf(tmp_path, sizeof(tmp_path), "%s.tmp.%ld", path, (long)getpid());
+    FILE *file = fopen(tmp_path, "wb");
+    if (!file) {
+        perror("saveTrigramIndex: Error al abrir archivo");
+        return -1;
+    }
+
+    int failed = writeU32(file, TRIGRAM_INDEX_MAGIC) || writeU32(file, TRIGRAM_INDEX_VERSION) ||
+                 writeU32(file, (uint32_t)builder->doc_count) ||
+                 writeU32(file, (uint32_t)trigram_count);
+    for (size_t i = 0; i < builder->doc_count && !failed; i++) {
+        failed = writeU32(file, builder->docs[i]);
+    }
+
+    // Tabla: el offset de cada lista sale de los tamaños de las anteriores
+    uint64_t offset = 0;
+    for (size_t i = 0; i < builder->count && !failed;) {
+        uint32_t trigram = (uint32_t)(builder->pairs[i] >> 32);
+        uint32_t frequency = 0;
+        uint64_t start = offset;
+        uint32_t prev = 0;
+        for (; i < builder->count && (uint32_t)(builder->pairs[i] >> 32) == trigram; i++) {
+            uint32_t doc_id = (uint32_t)builder->pairs[i];
+            offset += varintSize(doc_id - prev);
+            prev = doc_id;
+            frequency++;
+        }
+        failed = writeU32(file, trigram) || writeU32(file, frequency) || writeU64(file, start);
+    }
+    for (size_t i = 0; i < builder->count && !failed; i++) {
+        uint32_t doc_id = (uint32_t)builder->pairs[i];
+        int first = i == 0 || (builder->pairs[i] >> 32) != (builder->pairs[i - 1] >> 32);
+        failed = writeVarint(file, first ? doc_id : doc_id - (uint32_t)builder->pairs[i - 1]);
+    }
+
+    if (fclose(file) != 0) failed = 1;
+    if (failed || rename(tmp_path, path) != 0) {
+        fprintf(stderr, "saveTrigramIndex: Error al escribir %s\n", path);
+        unlink(tmp_path);
+        return -1;
+    }
+    printf("Índice de trigramas: %zu trigramas, %zu documentos (%s)\n",
+           trigram_count, builder->doc_count, path);
+    return 0;
+}
+
+int removeTrigramIndex(const char *index_path) {
+    char path[1024];
+    trigramPath(index_path, path, sizeof(path));
+    return (unlink(path) != 0 && errno != ENOENT) ? -1 : 0;
+}
+
+// ============================================================================
+// Consulta
+// ============================================================================
+
+TrigramIndex* openTrigramIndex(const char *index_path) {
+    char path[1024];
+    trigramPath(index_path, path, sizeof(path));
+    FILE *file = fopen(path, "rb");
+    if (!file) return NULL;
+
+    TrigramIndex *trigrams = calloc(1, sizeof(TrigramIndex));
+    uint32_t magic, version, doc_count, count;
+    int failed = !trigrams || readU32(file, &magic) || readU32(file, &version) ||
+                 readU32(file, &doc_count) || readU32(file, &count) ||
+                 magic != TRIGRAM_INDEX_MAGIC || version != TRIGRAM_INDEX_VERSION;
+    if (!failed) {
+        trigrams->file = file;
+        trigrams->docs = malloc(((size_t)doc_count + 1) * sizeof(uint32_t));
+        trigrams->entries = malloc(((size_t)count + 1) * sizeof(TrigramEntry));
+        failed = !trigrams->docs || !trigrams->entries;
+    }
+    for (uint32_t i = 0; i < doc_count && !failed; i++) {
+        failed = readU32(file, &trigrams->docs[i]);
+    }
+    for (uint32_t i = 0; i < count && !failed; i++) {
+        TrigramEntry *entry = &trigrams->entries[i];
+        uint32_t low = 0, high = 0;
+        failed = readU32(file, &entry->trigram) || readU32(file, &entry->doc_frequency) ||
+                 readU32(file, &low) || readU32(file, &high);
+        entry->offset = (uint64_t)low | ((uint64_t)high << 32);
+    }
+    if (failed) {
+        fprintf(stderr, "%s: índice de trigramas no válido, se ignora\n", path);
+        if (trigrams) trigrams->file = NULL;
+        closeTrigramIndex(trigrams);
+        fclose(file);
+        return NULL;
+    }
+    trigrams->doc_count = doc_count;
+    trigrams->count = count;
+    trigrams->postings_offset = (uint64_t)ftello(file);
+    return trigrams;
+}
+
+void closeTrigramIndex(TrigramIndex *trigrams) {
+    if (!trigrams) return;
+    if (trigrams->file) fclose(trigrams->file);
+    free(trigrams->docs);
+    free(trigrams->entries);
+    free(trigrams);
+}
+
+static const TrigramEntry* findTrigram(const TrigramIndex *trigrams, uint32_t trigram) {
+    size_t low = 0, high = trigrams->count;
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        if (trigrams->entries[mid].trigram < trigram) low = mid + 1;
+        else high = mid;
+    }
+    if (low < trigrams->count && trigrams->entries[low].trigram == trigram) {
+        return &trigrams->entries[low];
+    }
+    return NULL;
+}
+
+static int compareFrequency(const void *a, const void *b) {
+    const TrigramEntry *x = *(const TrigramEntry *const *)a;
+    const TrigramEntry *y = *(const TrigramEntry *const *)b;
+    return (x->doc_frequency > y->doc_frequency) - (x->doc_frequency < y->doc_frequency);
+}
+
+// Deja en docs[0..*count) los que también están en la lista de entry
+static int intersectList(TrigramIndex *trigrams, const TrigramEntry *entry,
+                         uint32_t *docs, size_t *count) {
+    if (fseeko(trigrams->file, (off_t)(trigrams->postings_offset + entry->offset), SEEK_SET) != 0) {
+        return -1;
+    }
+    size_t kept = 0, i = 0;
+    uint32_t doc_id = 0;
+    for (uint32_t k = 0; k < entry->doc_frequency && i < *count; k++) {
+        uint32_t delta;
+        if (readVarint(trigrams->file, &delta) != 0) return -1;
+        doc_id += delta;
+        while (i < *count && docs[i] < doc_id) i++;
+        if (i < *count && docs[i] == doc_id) docs[kept++] = docs[i++];
+    }
+    *count = kept;
+    return 0;
+}
+
+int trigramCandidates(TrigramIndex *trigrams, const char *pattern,
+                      unsigned char *candidate, size_t id_limit) {
+    size_t len = strlen(pattern);
+    if (!trigrams || len < 3) return -1;
+
+    // Trigramas del patrón; si alguno no aparece en la colección, ningún
+    // documento cubierto puede contenerlo
+    size_t pattern_count = len - 2;
+    const TrigramEntry **entries = malloc(pattern_count * sizeof(TrigramEntry*));
+    uint32_t *docs = malloc((trigrams->doc_count + 1) * sizeof(uint32_t));
+    if (!entries || !docs) {
+        free(entries);
+        free(docs);
+        return -1;
+    }
+    size_t used = 0;
+    int missing = 0;
+    for (size_t i = 0; i < pattern_count && !missing; i++) {
+        const TrigramEntry *entry = findTrigram(trigrams, trigramAt((const unsigned char*)pattern + i));
+        if (!entry) missing = 1;
+        else entries[used++] = entry;
+    }
+
+    // Se intersecta empezando por las listas más cortas; los trigramas
+    // repetidos del patrón quedan juntos y se saltan
+    size_t count = 0;
+    int result = 0;
+    if (!missing) {
+        qsort(entries, used, sizeof(TrigramEntry*), compareFrequency);
+        memcpy(docs, trigrams->docs, trigrams->doc_count * sizeof(uint32_t));
+        count = trigrams->doc_count;
+        for (size_t i = 0; i < used && count > 0 && result == 0; i++) {
+            if (i > 0 && entries[i] == entries[i - 1]) continue;
+            result = intersectList(trigrams, entries[i], docs, &count);
+        }
+    }
+    free(entries);
+    if (result != 0) {
+        free(docs);
+        return -1;
+    }
+
+    // Los documentos no cubiertos (añadidos sin trigramas) siguen siendo candidatos
+    memset(candidate, 1, id_limit);
+    for (size_t i = 0; i < trigrams->doc_count; i++) {
+        if (trigrams->docs[i] < id_limit) candidate[trigrams->docs[i]] = 0;
+    }
+    for (size_t i = 0; i < count; i++) {
+        if (docs[i] < id_limit) candidate[docs[i]] = 1;
+    }
+    free(docs);
+    return 0;
+}
@@ -1,302 +1,222 @@
 // Diego Galindo, Francisco Mercado
 #include "utils.h"
+#include "unicode_tables.h"
+#include "html_stripper.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
+#include <stdint.h>
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
 
-// Estructura para mapeos Unicode case-folding
+// Normalización Unicode en una sola pasada, dirigida por las tablas generadas
+// (unicode_tables.h). Cada code-point se decodifica una vez y atraviesa
+// composición NFC -> case-folding -> descomposición NFD -> quitar diacríticos
+// sin reescanear el texto por cada entrada de tabla.
+
+// Decodifica un code-point UTF-8; devuelve su longitud en bytes o 0 si la
+// secuencia es inválida (el byte se copia tal cual)
+static size_t decode_utf8(const unsigned char* s, size_t avail, uint32_t* cp) {
+    unsigned char c = s[0];
+    if (c < 0x80) { *cp = c; return 1; }
+    if ((c & 0xE0) == 0xC0 && avail >= 2 && (s[1] & 0xC0) == 0x80) {
+        *cp = ((uint32_t)(c & 0x1F) << 6) | (s[1] & 0x3F);
+        return 2;
+    }
+    if ((c & 0xF0) == 0xE0 && avail >= 3 && (s[1] & 0xC0) == 0x80 && (s[2] & 0xC0) == 0x80) {
+        *cp = ((uint32_t)(c & 0x0F) << 12) | ((uint32_t)(s[1] & 0x3F) << 6) | (s[2] & 0x3F);
+        return 3;
+    }
+    if ((c & 0xF8) == 0xF0 && avail >= 4 && (s[1] & 0xC0) == 0x80 &&
+        (s[2] & 0xC0) == 0x80 && (s[3] & 0xC0) == 0x80) {
+        *cp = ((uint32_t)(c & 0x07) << 18) | ((uint32_t)(s[1] & 0x3F) << 12) |
+              ((uint32_t)(s[2] & 0x3F) << 6) | (s[3] & 0x3F);
+        return 4;
+    }
+    return 0;
+}
+
+static size_t encode_utf8(uint32_t cp, char* out) {
+    if (cp < 0x80) { out[0] = (char)cp; return 1; }
+    if (cp < 0x800) {
+        out[0] = (char)(0xC0 | (cp >> 6));
+        out[1] = (char)(0x80 | (cp & 0x3F));
+        return 2;
+    }
+    if (cp < 0x10000) {
+        out[0] = (char)(0xE0 | (cp >> 12));
+        out[1] = (char)(0x80 | ((cp >> 6) & 0x3F));
+        out[2] = (char)(0x80 | (cp & 0x3F));
+        return 3;
+    }
+    out[0] = (char)(0xF0 | (cp >> 18));
+    out[1] = (char)(0x80 | ((cp >> 12) & 0x3F));
+    out[2] = (char)(0x80 | ((cp >> 6) & 0x3F));
+    out[3] = (char)(0x80 | (cp & 0x3F));
+    return 4;
+}
+
+// Búsqueda binaria de (base, marca) en la tabla de composiciones
+static uint32_t compose_pair(uint32_t base, uint32_t mark) {
+    size_t lo = 0, hi = unorm_composition_count;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        const UnormComposition* c = &unorm_compositions[mid];
+        if (c->base == base && c->mark == mark) return c->composed;
+        if (c->base < base || (c->base == base && c->mark < mark)) lo = mid + 1;
+        else hi = mid;
+    }
+    return 0;
+}
+
+// Búfer de salida que crece según haga falta
 typedef struct {
-    const char* from;
-    const char* to;
-} UnicodeMapping;
-
-// Tabla extendida de case-folding Unicode
-static const UnicodeMapping case_folding_table[] = {
-    // Latín básico extendido
-    {"A", "a"}, {"B", "b"}, {"C", "c"}, {"D", "d"}, {"E", "e"}, {"F", "f"}, 
-    {"G", "g"}, {"H", "h"}, {"I", "i"}, {"J", "j"}, {"K", "k"}, {"L", "l"},
-    {"M", "m"}, {"N", "n"}, {"O", "o"}, {"P", "p"}, {"Q", "q"}, {"R", "r"},
-    {"S", "s"}, {"T", "t"}, {"U", "u"}, {"V", "v"}, {"W", "w"}, {"X", "x"},
-    {"Y", "y"}, {"Z", "z"},
-    
-    // Casos especiales Unicode
-    {"İ", "i̇"},  // I turca con punto
-    {"I", "ı"},   // I sin punto -> ı (en contexto turco)
-    {"ß", "ss"},  // Eszett alemana
-    {"ſ", "s"},   // S larga
-    {"ﬀ", "ff"}, {"ﬁ", "fi"}, {"ﬂ", "fl"}, {"ﬃ", "ffi"}, {"ﬄ", "ffl"}, // Ligaduras
-    
-    // Letras con diacríticos - Español/Latinoamérica
-    {"Á", "á"}, {"À", "à"}, {"Â", "â"}, {"Ä", "ä"}, {"Ã", "ã"}, {"Å", "å"},
-    {"É", "é"}, {"È", "è"}, {"Ê", "ê"}, {"Ë", "ë"}, 
-    {"Í", "í"}, {"Ì", "ì"}, {"Î", "î"}, {"Ï", "ï"},
-    {"Ó", "ó"}, {"Ò", "ò"}, {"Ô", "ô"}, {"Ö", "ö"}, {"Õ", "õ"}, {"Ø", "ø"},
-    {"Ú", "ú"}, {"Ù", "ù"}, {"Û", "û"}, {"Ü", "ü"},
-    {"Ñ", "ñ"}, {"Ç", "ç"},
-    
-    // Caracteres adicionales para países de habla inglesa
-    {"Æ", "æ"}, {"Œ", "œ"}, {"Þ", "þ"}, {"Ð", "ð"},
-    
-    // Cirílico básico
-    {"А", "а"}, {"Б", "б"}, {"В", "в"}, {"Г", "г"}, {"Д", "д"}, {"Е", "е"},
-    {"Ё", "ё"}, {"Ж", "ж"}, {"З", "з"}, {"И", "и"}, {"Й", "й"}, {"К", "к"},
-    {"Л", "л"}, {"М", "м"}, {"Н", "н"}, {"О", "о"}, {"П", "п"}, {"Р", "р"},
-    {"С", "с"}, {"Т", "т"}, {"У", "у"}, {"Ф", "ф"}, {"Х", "х"}, {"Ц", "ц"},
-    {"Ч", "ч"}, {"Ш", "ш"}, {"Щ", "щ"}, {"Ъ", "ъ"}, {"Ы", "ы"}, {"Ь", "ь"},
-    {"Э", "э"}, {"Ю", "ю"}, {"Я", "я"},
-    
-    {NULL, NULL} // Terminador
-};
-
-// Tabla de normalización canónica (NFD -> NFC)
-static const UnicodeMapping canonical_normalization[] = {
-    // Formas descompuestas -> precompuestas
-    {"a\xCC\x81", "á"}, {"a\xCC\x80", "à"}, {"a\xCC\x82", "â"}, {"a\xCC\x84", "ā"},
-    {"a\xCC\x88", "ä"}, {"a\xCC\x83", "ã"}, {"a\xCC\x8A", "å"},
-    {"e\xCC\x81", "é"}, {"e\xCC\x80", "è"}, {"e\xCC\x82", "ê"}, {"e\xCC\x88", "ë"},
-    {"i\xCC\x81", "í"}, {"i\xCC\x80", "ì"}, {"i\xCC\x82", "î"}, {"i\xCC\x88", "ï"},
-    {"o\xCC\x81", "ó"}, {"o\xCC\x80", "ò"}, {"o\xCC\x82", "ô"}, {"o\xCC\x88", "ö"},
-    {"o\xCC\x83", "õ"}, {"o\xCC\x84", "ō"},
-    {"u\xCC\x81", "ú"}, {"u\xCC\x80", "ù"}, {"u\xCC\x82", "û"}, {"u\xCC\x88", "ü"},
-    {"n\xCC\x83", "ñ"}, {"c\xCC\xA7", "ç"},
-    
-    // Formas precompuestas -> descompuestas (NFD)
-    {"á", "a\xCC\x81"}, {"à", "a\xCC\x80"}, {"â", "a\xCC\x82"}, {"ä", "a\xCC\x88"},
-    {"ã", "a\xCC\x83"}, {"å", "a\xCC\x8A"},
-    {"é", "e\xCC\x81"}, {"è", "e\xCC\x80"}, {"ê", "e\xCC\x82"}, {"ë", "e\xCC\x88"},
-    {"í", "i\xCC\x81"}, {"ì", "i\xCC\x80"}, {"î", "i\xCC\x82"}, {"ï", "i\xCC\x88"},
-    {"ó", "o\xCC\x81"}, {"ò", "o\xCC\x80"}, {"ô", "o\xCC\x82"}, {"ö", "o\xCC\x88"},
-    {"õ", "o\xCC\x83"},
-    {"ú", "u\xCC\x81"}, {"ù", "u\xCC\x80"}, {"û", "u\xCC\x82"}, {"ü", "u\xCC\x88"},
-    {"ñ", "n\xCC\x83"}, {"ç", "c\xCC\xA7"},
-    
-    {NULL, NULL}
-};
-
-// Tabla de eliminación de diacríticos
-static const UnicodeMapping diacritic_removal[] = {
-    // Vocales con diacríticos -> vocales base
-    {"á", "a"}, {"à", "a"}, {"â", "a"}, {"ä", "a"}, {"ã", "a"}, {"å", "a"}, {"ā", "a"},
-    {"Á", "A"}, {"À", "A"}, {"Â", "A"}, {"Ä", "A"}, {"Ã", "A"}, {"Å", "A"}, {"Ā", "A"},
-    {"é", "e"}, {"è", "e"}, {"ê", "e"}, {"ë", "e"}, {"ē", "e"}, {"ė", "e"}, {"ę", "e"},
-    {"É", "E"}, {"È", "E"}, {"Ê", "E"}, {"Ë", "E"}, {"Ē", "E"}, {"Ė", "E"}, {"Ę", "E"},
-    {"í", "i"}, {"ì", "i"}, {"î", "i"}, {"ï", "i"}, {"ī", "i"}, {"į", "i"},
-    {"Í", "I"}, {"Ì", "I"}, {"Î", "I"}, {"Ï", "I"}, {"Ī", "I"}, {"Į", "I"},
-    {"ó", "o"}, {"ò", "o"}, {"ô", "o"}, {"ö", "o"}, {"õ", "o"}, {"ø", "o"}, {"ō", "o"}, {"ő", "o"},
-    {"Ó", "O"}, {"Ò", "O"}, {"Ô", "O"}, {"Ö", "O"}, {"Õ", "O"}, {"Ø", "O"}, {"Ō", "O"}, {"Ő", "O"},
-    {"ú", "u"}, {"ù", "u"}, {"û", "u"}, {"ü", "u"}, {"ū", "u"}, {"ů", "u"}, {"ų", "u"}, {"ű", "u"},
-    {"Ú", "U"}, {"Ù", "U"}, {"Û", "U"}, {"Ü", "U"}, {"Ū", "U"}, {"Ů", "U"}, {"Ų", "U"}, {"Ű", "U"},
-    {"ý", "y"}, {"ÿ", "y"}, {"ȳ", "y"},
-    {"Ý", "Y"}, {"Ÿ", "Y"}, {"Ȳ", "Y"},
-    
-    // Consonantes con diacríticos
-    {"ñ", "n"}, {"Ñ", "N"},
-    {"ç", "c"}, {"Ç", "C"}, {"ć", "c"}, {"č", "c"}, {"ċ", "c"}, {"ĉ", "c"},
-    {"Ć", "C"}, {"Č", "C"}, {"Ċ", "C"}, {"Ĉ", "C"},
-    {"ł", "l"}, {"Ł", "L"}, {"ľ", "l"}, {"ĺ", "l"}, {"ļ", "l"},
-    {"Ľ", "L"}, {"Ĺ", "L"}, {"Ļ", "L"},
-    {"ř", "r"}, {"ŕ", "r"}, {"ŗ", "r"},
-    {"Ř", "R"}, {"Ŕ", "R"}, {"Ŗ", "R"},
-    {"ś", "s"}, {"š", "s"}, {"ş", "s"}, {"ș", "s"},
-    {"Ś", "S"}, {"Š", "S"}, {"Ş", "S"}, {"Ș", "S"},
-    {"ť", "t"}, {"ţ", "t"}, {"ț", "t"},
-    {"Ť", "T"}, {"Ţ", "T"}, {"Ț", "T"},
-    {"ź", "z"}, {"ž", "z"}, {"ż", "z"},
-    {"Ź", "Z"}, {"Ž", "Z"}, {"Ż", "Z"},
-    {"ğ", "g"}, {"Ğ", "G"},
-    {"đ", "d"}, {"Đ", "D"},
-    
-    // Formas descompuestas (base + combinando)
-    {"a\xCC\x81", "a"}, {"a\xCC\x80", "a"}, {"a\xCC\x82", "a"}, {"a\xCC\x88", "a"},
-    {"a\xCC\x83", "a"}, {"a\xCC\x8A", "a"},
-    {"e\xCC\x81", "e"}, {"e\xCC\x80", "e"}, {"e\xCC\x82", "e"}, {"e\xCC\x88", "e"},
-    {"i\xCC\x81", "i"}, {"i\xCC\x80", "i"}, {"i\xCC\x82", "i"}, {"i\xCC\x88", "i"},
-    {"o\xCC\x81", "o"}, {"o\xCC\x80", "o"}, {"o\xCC\x82", "o"}, {"o\xCC\x88", "o"},
-    {"o\xCC\x83", "o"},
-    {"u\xCC\x81", "u"}, {"u\xCC\x80", "u"}, {"u\xCC\x82", "u"}, {"u\xCC\x88", "u"},
-    {"n\xCC\x83", "n"}, {"c\xCC\xA7", "c"},
-    
-    {NULL, NULL}
-};
+    char* data;
+    size_t len;
+    size_t cap;
+} NormBuffer;
 
-// Función auxiliar para buscar y reemplazar en tablas
-static int apply_mapping_table(char* str, const UnicodeMapping* table) {
-    if (!str || !table) return 0;
-    
-    int changes = 0;
-    size_t len = strlen(str);
-    char* temp = malloc(len * 4 + 1); // Buffer temporal más grande para expansiones
-    if (!temp) return 0;
-    
-    size_t out_pos = 0;
-    size_t in_pos = 0;
-    
-    while (in_pos < len) {
-        int found = 0;
-        
-        // Buscar coincidencias en la tabla
-        for (int i = 0; table[i].from != NULL; i++) {
-            size_t from_len = strlen(table[i].from);
-            if (in_pos + from_len <= len && 
-                memcmp(str + in_pos, table[i].from, from_len) == 0) {
-                
-                // Encontrada coincidencia, aplicar reemplazo
-                size_t to_len = strlen(table[i].to);
-                memcpy(temp + out_pos, table[i].to, to_len);
-                out_pos += to_len;
-                in_pos += from_len;
-                changes++;
-                found = 1;
-                break;
-            }
-        }
-        
-        if (!found) {
-            // No hay coincidencia, copiar carácter original
-            temp[out_pos++] = str[in_pos++];
+static int norm_reserve(NormBuffer* b, size_t extra) {
+    if (b->len + extra < b->cap) return 1;
+    size_t cap = b->cap * 2 + extra + 1;
+    char* grown = realloc(b->data, cap);
+    if (!grown) return 0;
+    b->data = grown;
+    b->cap = cap;
+    return 1;
+}
+
+// Última etapa: quitar diacríticos y emitir
+static void emit_stripped(NormBuffer* b, uint32_t cp, unsigned flags) {
+    if (flags & UNORM_STRIP_DIACRITICS) {
+        const UnormRecord* r = unorm_lookup(cp);
+        if (r->flags & UNORM_COMBINING) return;
+        if (r->strip_len) {
+            for (size_t i = 0; i < r->strip_len; i++)
+                b->len += encode_utf8(unorm_pool[r->strip + i], b->data + b->len);
+            return;
         }
     }
-    
-    temp[out_pos] = '\0';
-    
-    // Copiar resultado de vuelta si hay cambios
-    if (changes > 0) {
-        strcpy(str, temp);
+    b->len += encode_utf8(cp, b->data + b->len);
+}
+
+static void emit_decomposed(NormBuffer* b, uint32_t cp, unsigned flags) {
+    if (flags & UNORM_NFD) {
+        const UnormRecord* r = unorm_lookup(cp);
+        if (r->nfd_len) {
+            for (size_t i = 0; i < r->nfd_len; i++)
+                emit_stripped(b, unorm_pool[r->nfd + i], flags);
+            return;
+        }
     }
-    
-    free(temp);
-    return changes;
+    emit_stripped(b, cp, flags);
 }
 
-// Case-folding Unicode avanzado
-void unicode_case_fold(char* str) {
-    if (!str) return;
-    
-    // Aplicar case-folding Unicode
-    apply_mapping_table(str, case_folding_table);
-    
-    // Fallback a tolower para caracteres ASCII no cubiertos
-    for (size_t i = 0; str[i]; i++) {
-        if ((unsigned char)str[i] < 128) {
-            str[i] = (char)tolower((unsigned char)str[i]);
+static void emit_folded(NormBuffer* b, uint32_t cp, unsigned flags) {
+    if (flags & UNORM_CASEFOLD) {
+        const UnormRecord* r = unorm_lookup(cp);
+        if (r->fold_len) {
+            for (size_t i = 0; i < r->fold_len; i++)
+                emit_decomposed(b, unorm_pool[r->fold + i], flags);
+            return;
         }
     }
+    emit_decomposed(b, cp, flags);
 }
 
+char* unicode_normalize_alloc(const char* in, size_t len, unsigned flags, size_t* out_len) {
+    if (!in) return NULL;
+    // NFC y NFD son excluyentes; si se piden ambas gana NFD
+    if (flags & UNORM_NFD) flags &= ~(unsigned)UNORM_NFC;
 
-void unicode_normalize(char* str, unicode_normalization_form form) {
-    if (!str) return;
-    
-    if (form == UNICODE_NFC) {
-        // Convertir formas descompuestas a precompuestas
-        // Primero aplicamos las formas NFD->NFC
-        for (int i = 0; canonical_normalization[i].from != NULL; i++) {
-            if (strstr(canonical_normalization[i].from, "\xCC")) {
-                // Es una forma descompuesta, convertir a precompuesta
-                char* pos = str;
-                while ((pos = strstr(pos, canonical_normalization[i].from)) != NULL) {
-                    size_t from_len = strlen(canonical_normalization[i].from);
-                    size_t to_len = strlen(canonical_normalization[i].to);
-                    
-                    if (to_len <= from_len) {
-                        memcpy(pos, canonical_normalization[i].to, to_len);
-                        memmove(pos + to_len, pos + from_len, 
-                               strlen(pos + from_len) + 1);
-                    }
-                    pos += to_len;
-                }
-            }
+    NormBuffer b = { malloc(len + len / 2 + 16), 0, len + len / 2 + 16 };
+    if (!b.data) return NULL;
+
+    const unsigned char* s = (const unsigned char*)in;
+    size_t i = 0;
+    while (i < len) {
+        // Máximo por code-point: 3 (fold) x 2 (nfd) code-points de 4 bytes
+        if (!norm_reserve(&b, 32)) {
+            free(b.data);
+            return NULL;
         }
-    } else if (form == UNICODE_NFD) {
-        // Convertir formas precompuestas a descompuestas
-        for (int i = 0; canonical_normalization[i].from != NULL; i++) {
-            if (!strstr(canonical_normalization[i].from, "\xCC")) {
-                // Es una forma precompuesta, convertir a descompuesta
-                char* temp = malloc(strlen(str) * 3 + 1);
-                if (!temp) return;
-                
-                strcpy(temp, str);
-                char* pos = temp;
-                char* out = str;
-                size_t out_pos = 0;
-                
-                while (*pos) {
-                    int found = 0;
-                    for (int j = 0; canonical_normalization[j].from != NULL; j++) {
-                        if (!strstr(canonical_normalization[j].from, "\xCC")) {
-                            size_t from_len = strlen(canonical_normalization[j].from);
-                            if (memcmp(pos, canonical_normalization[j].from, from_len) == 0) {
-                                size_t to_len = strlen(canonical_normalization[j].to);
-                                memcpy(out + out_pos, canonical_normalization[j].to, to_len);
-                                out_pos += to_len;
-                                pos += from_len;
-                                found = 1;
-                                break;
-                            }
-                        }
-                    }
-                    if (!found) {
-                        out[out_pos++] = *pos++;
-                    }
-                }
-                out[out_pos] = '\0';
-                free(temp);
+        unsigned char c = s[i];
+        // Camino rápido ASCII: sin composición posible si no sigue una marca
+        if (c < 0x80 && (i + 1 >= len || s[i + 1] < 0x80 || !(flags & UNORM_NFC))) {
+            b.data[b.len++] = (flags & UNORM_CASEFOLD && c >= 'A' && c <= 'Z') ? (char)(c + 32) : (char)c;
+            i++;
+            continue;
+        }
+
+        uint32_t cp;
+        size_t n = decode_utf8(s + i, len - i, &cp);
+        if (n == 0) {
+            b.data[b.len++] = (char)c;
+            i++;
+            continue;
+        }
+        i += n;
+
+        // NFC: compone con las marcas siguientes mientras exista la pareja
+        if (flags & UNORM_NFC) {
+            uint32_t mark;
+            size_t m;
+            while (i < len && (m = decode_utf8(s + i, len - i, &mark)) > 0 &&
+                   (unorm_lookup(mark)->flags & UNORM_COMBINING)) {
+                uint32_t composed = compose_pair(cp, mark);
+                if (!composed) break;
+                cp = composed;
+                i += m;
             }
         }
+        emit_folded(&b, cp, flags);
     }
+    b.data[b.len] = '\0';
+    if (out_len) *out_len = b.len;
+    return b.data;
 }
 
-// 3. Eliminación de diacríticos (con flag opcional)
-void remove_diacritics(char* str, int enable_removal) {
-    if (!str || !enable_removal) return;
-    
-    apply_mapping_table(str, diacritic_removal);
-    
-    // Eliminar marcas diacríticas combinadas restantes (rango Unicode 0300-036F)
-    char* temp = malloc(strlen(str) + 1);
-    if (!temp) return;
-    
-    size_t out_pos = 0;
-    size_t in_pos = 0;
+// Aplica la normalización y copia el resultado de vuelta en str. Si la salida
+// crece más allá del tamaño original se trunca en un límite de code-point.
+static void normalize_in_place(char* str, unsigned flags) {
     size_t len = strlen(str);
-    
-    while (in_pos < len) {
-        unsigned char c1 = (unsigned char)str[in_pos];
-        
-        // Detectar secuencias UTF-8 de marcas combinadas
-        if (c1 == 0xCC && in_pos + 1 < len) {
-            unsigned char c2 = (unsigned char)str[in_pos + 1];
-            if (c2 >= 0x80 && c2 <= 0xBF) {
-                // Es una marca diacrítica combinada, omitir
-                in_pos += 2;
-                continue;
-            }
-        } else if (c1 == 0xCD && in_pos + 1 < len) {
-            unsigned char c2 = (unsigned char)str[in_pos + 1];
-            if (c2 >= 0x80 && c2 <= 0xAF) {
-                // Es una marca diacrítica combinada, omitir
-                in_pos += 2;
-                continue;
-            }
-        }
-        
-        temp[out_pos++] = str[in_pos++];
+    size_t out_len;
+    char* out = unicode_normalize_alloc(str, len, flags, &out_len);
+    if (!out) return;
+    if (out_len > len) {
+        out_len = len;
+        while (out_len > 0 && ((unsigned char)out[out_len] & 0xC0) == 0x80) out_len--;
     }
-    
-    temp[out_pos] = '\0';
-    strcpy(str, temp);
-    free(temp);
+    memcpy(str, out, out_len);
+    str[out_len] = '\0';
+    free(out);
+}
+
+// Case-folding Unicode avanzado
+void unicode_case_fold(char* str) {
+    if (!str) return;
+    normalize_in_place(str, UNORM_CASEFOLD);
+}
+
+void unicode_normalize(char* str, unicode_normalization_form form) {
+    if (!str) return;
+    normalize_in_place(str, form == UNICODE_NFD ? UNORM_NFD : UNORM_NFC);
+}
+
+// Eliminación de diacríticos (con flag opcional)
+void remove_diacritics(char* str, int enable_removal) {
+    if (!str || !enable_removal) return;
+    normalize_in_place(str, UNORM_STRIP_DIACRITICS);
 }
 
 // Función combinada que aplica todas las normalizaciones
 void unicode_normalize_full(char* str, int remove_diacritics_flag) {
     if (!str) return;
-    
-    unicode_normalize(str, UNICODE_NFC);
-    unicode_case_fold(str);
-    remove_diacritics(str, remove_diacritics_flag);
-    
+    unsigned flags = UNORM_NFC | UNORM_CASEFOLD;
+    if (remove_diacritics_flag) flags |= UNORM_STRIP_DIACRITICS;
+    normalize_in_place(str, flags);
     squeezeSpaces(str);
 }
 
@@ -355,15 +275,125 @@ char* loadFile(const char* filename) {
     return buffer;
 }
 
+// FNV-1a de 64 bits sobre el contenido del archivo, leído por bloques
+int hashFile(const char* filename, uint64_t* hash) {
+    FILE* fp = fopen(filename, "rb");
+    if (!fp) return -1;
+    
+    uint64_t h = 1469598103934665603ULL;
+    unsigned char chunk[65536];
+    size_t n;
+    while ((n = fread(chunk, 1, sizeof(chunk), fp)) > 0) {
+        for (size_t i = 0; i < n; i++) {
+            h ^= chunk[i];
+            h *= 1099511628211ULL;
+        }
+    }
+    int failed = ferror(fp);
+    fclose(fp);
+    if (failed) return -1;
+    
+    *hash = h;
+    return 0;
+}
+
+// Caminos rápidos SIMD para texto ASCII: se procesan bloques de 16 (SSE2) o
+// 32 (AVX2) bytes en registro y solo los bloques con bytes >= 0x80 o que
+// requieren filtrar caen al tratamiento byte a byte. El locale es "C", así
+// que tolower/isalnum solo afectan a bytes ASCII.
+#if defined(__AVX2__)
+#define UTILS_SIMD 1
+#define VBLOCK 32
+typedef __m256i vblock;
+static inline vblock vload(const char* p) { return _mm256_loadu_si256((const __m256i*)p); }
+static inline void vstore(char* p, vblock v) { _mm256_storeu_si256((__m256i*)p, v); }
+static inline uint32_t vmask(vblock v) { return (uint32_t)_mm256_movemask_epi8(v); }
+static inline vblock vset(char c) { return _mm256_set1_epi8(c); }
+static inline vblock veq(vblock a, vblock b) { return _mm256_cmpeq_epi8(a, b); }
+static inline vblock vgt(vblock a, vblock b) { return _mm256_cmpgt_epi8(a, b); }
+static inline vblock vand(vblock a, vblock b) { return _mm256_and_si256(a, b); }
+static inline vblock vor(vblock a, vblock b) { return _mm256_or_si256(a, b); }
+static inline vblock vadd(vblock a, vblock b) { return _mm256_add_epi8(a, b); }
+#define VFULL 0xFFFFFFFFu
+#elif defined(__SSE2__)
+#define UTILS_SIMD 1
+#define VBLOCK 16
+typedef __m128i vblock;
+static inline vblock vload(const char* p) { return _mm_loadu_si128((const __m128i*)p); }
+static inline void vstore(char* p, vblock v) { _mm_storeu_si128((__m128i*)p, v); }
+static inline uint32_t vmask(vblock v) { return (uint32_t)_mm_movemask_epi8(v); }
+static inline vblock vset(char c) { return _mm_set1_epi8(c); }
+static inline vblock veq(vblock a, vblock b) { return _mm_cmpeq_epi8(a, b); }
+static inline vblock vgt(vblock a, vblock b) { return _mm_cmpgt_epi8(a, b); }
+static inline vblock vand(vblock a, vblock b) { return _mm_and_si128(a, b); }
+static inline vblock vor(vblock a, vblock b) { return _mm_or_si128(a, b); }
+static inline vblock vadd(vblock a, vblock b) { return _mm_add_epi8(a, b); }
+#define VFULL 0xFFFFu
+#endif
+
+#ifdef UTILS_SIMD
+// Máscara de bytes en [lo, hi]; la comparación es con signo, así que los
+// bytes >= 0x80 (negativos) nunca caen en rangos ASCII
+static inline vblock vrange(vblock v, char lo, char hi) {
+    return vand(vgt(v, vset((char)(lo - 1))), vgt(vset((char)(hi + 1)), v));
+}
+
+// Suma 0x20 a las mayúsculas A-Z
+static inline vblock vlower(vblock v) {
+    return vadd(v, vand(vrange(v, 'A', 'Z'), vset(0x20)));
+}
+
+static inline vblock vwhitespace(vblock v) {
+    return vor(vor(veq(v, vset(' ')), veq(v, vset('\n'))),
+               vor(veq(v, vset('\t')), veq(v, vset('\r'))));
+}
+#endif
+
 void toLowerInPlace(char* s) {
-    for (size_t i = 0; s[i]; i++)
+    size_t len = strlen(s);
+    size_t i = 0;
+#ifdef UTILS_SIMD
+    // tolower no cambia bytes >= 0x80, así que todos los bloques son válidos
+    for (; i + VBLOCK <= len; i += VBLOCK)
+        vstore(s + i, vlower(vload(s + i)));
+#endif
+    for (; i < len; i++)
         s[i] = (char)tolower((unsigned char)s[i]);
 }
 
 void squeezeSpaces(char* s) {
+    size_t len = strlen(s);
     size_t i = 0, o = 0;
     int in_space = 0;
-    while (s[i]) {
+#ifdef UTILS_SIMD
+    for (; i + VBLOCK <= len; i += VBLOCK) {
+        vblock v = vload(s + i);
+        uint32_t ws = vmask(vwhitespace(v));
+        uint32_t spaces = vmask(veq(v, vset(' ')));
+        // Bloque que no cambia: solo espacios simples, ninguno precedido por
+        // otro blanco (incluido el último byte del bloque anterior)
+        if (ws == spaces && (ws & ((ws << 1) | (uint32_t)in_space)) == 0) {
+            vstore(s + o, v);
+            o += VBLOCK;
+            in_space = (ws >> (VBLOCK - 1)) & 1;
+            continue;
+        }
+        char block[VBLOCK];
+        vstore(block, v);
+        for (size_t k = 0; k < VBLOCK; k++) {
+            if (ws & (1u << k)) {
+                if (!in_space) {
+                    s[o++] = ' ';
+                    in_space = 1;
+                }
+            } else {
+                in_space = 0;
+                s[o++] = block[k];
+            }
+        }
+    }
+#endif
+    while (i < len) {
         if (s[i] == ' ' || s[i] == '\n' || s[i] == '\t' || s[i] == '\r') {
             if (!in_space) {
                 s[o++] = ' ';
@@ -379,48 +409,86 @@ void squeezeSpaces(char* s) {
     s[o] = '\0';
 }
 
+// Paso escalar de convertir_a_minusculas: procesa el carácter en i (una
+// secuencia UTF-8 completa si empieza en 0xC3) y devuelve el siguiente índice
+static inline size_t minusculaEscalar(char *palabra, size_t i, size_t *j) {
+    unsigned char c = palabra[i];
+    if (c == 0xC3) { 
+        unsigned char c2 = palabra[i+1];
+        if (c2) {
+            i++;
+            switch(c2) {
+                case 0xA1: case 0xA0: case 0xA4: case 0xA2: case 0xA3: case 0xA5: 
+                    palabra[(*j)++] = 'a'; break;
+                case 0xA9: case 0xA8: case 0xAB: case 0xAA: 
+                    palabra[(*j)++] = 'e'; break;
+                case 0xAD: case 0xAC: case 0xAF: case 0xAE: 
+                    palabra[(*j)++] = 'i'; break;
+                case 0xB3: case 0xB2: case 0xB6: case 0xB4: case 0xB5: 
+                    palabra[(*j)++] = 'o'; break;
+                case 0xBA: case 0xB9: case 0xBC: case 0xBB: 
+                    palabra[(*j)++] = 'u'; break;
+                case 0xB1: 
+                    palabra[(*j)++] = 'n'; break;
+                default: 
+                    break;
+            }
+        }
+        return i + 1;
+    }
+    if (c < 128) palabra[(*j)++] = (char)tolower(c);
+    return i + 1;
+}
+
 void convertir_a_minusculas(char *palabra) {
-    int j = 0;
-    for (int i = 0; palabra[i]; ) {
-        unsigned char c = palabra[i];
-        if (c == 0xC3) { 
-            unsigned char c2 = palabra[i+1];
-            if (c2) {
-                i++;
-                switch(c2) {
-                    case 0xA1: case 0xA0: case 0xA4: case 0xA2: case 0xA3: case 0xA5: 
-                        palabra[j++] = 'a'; break;
-                    case 0xA9: case 0xA8: case 0xAB: case 0xAA: 
-                        palabra[j++] = 'e'; break;
-                    case 0xAD: case 0xAC: case 0xAF: case 0xAE: 
-                        palabra[j++] = 'i'; break;
-                    case 0xB3: case 0xB2: case 0xB6: case 0xB4: case 0xB5: 
-                        palabra[j++] = 'o'; break;
-                    case 0xBA: case 0xB9: case 0xBC: case 0xBB: 
-                        palabra[j++] = 'u'; break;
-                    case 0xB1: 
-                        palabra[j++] = 'n'; break;
-                    default: 
-                        i++;
-                        continue;
-                }
-                i++;
-            } else {
-                i++;
+    size_t len = strlen(palabra);
+    size_t i = 0, j = 0;
+    while (i < len) {
+#ifdef UTILS_SIMD
+        if (len - i >= VBLOCK) {
+            vblock v = vload(palabra + i);
+            if (vmask(v) == 0) {
+                // Bloque ASCII: minúsculas en registro (j <= i, ya leído)
+                vstore(palabra + j, vlower(v));
+                i += VBLOCK;
+                j += VBLOCK;
+                continue;
             }
-        } else if (c >= 128) { 
-            i++;
-        } else { 
-            palabra[j++] = tolower(c);
-            i++;
+            size_t end = i + VBLOCK;
+            while (i < end && i < len) i = minusculaEscalar(palabra, i, &j);
+            continue;
         }
+#endif
+        i = minusculaEscalar(palabra, i, &j);
     }
     palabra[j] = '\0';
 }
 
 void limpiar_palabra(char *palabra) {
-    int j = 0;
-    for (int i = 0; palabra[i]; i++) {
+    size_t len = strlen(palabra);
+    size_t i = 0, j = 0;
+#ifdef UTILS_SIMD
+    for (; i + VBLOCK <= len; i += VBLOCK) {
+        vblock v = vload(palabra + i);
+        // Se conservan letras, dígitos y espacios (isalnum en locale "C")
+        vblock keep = vor(vor(vrange(v, 'a', 'z'), vrange(v, 'A', 'Z')),
+                          vor(vrange(v, '0', '9'), veq(v, vset(' '))));
+        uint32_t mask = vmask(keep);
+        if (mask == VFULL) {
+            vstore(palabra + j, v);
+            j += VBLOCK;
+            continue;
+        }
+        // Compacta solo los bytes marcados
+        char block[VBLOCK];
+        vstore(block, v);
+        while (mask) {
+            palabra[j++] = block[__builtin_ctz(mask)];
+            mask &= mask - 1;
+        }
+    }
+#endif
+    for (; i < len; i++) {
         unsigned char c = palabra[i];
         if (isalnum(c) || c == ' ') {
             palabra[j++] = c;
@@ -429,103 +497,45 @@ void limpiar_palabra(char *palabra) {
     palabra[j] = '\0';
 }
 
-static void decodeEntity(const char* start, char** output) {
-    if (*start == '#') {
-        start++;
-        int base = 10;
-        if (*start == 'x' || *start == 'X') {
-            start++;
-            base = 16;
-        }
-        
-        char* end;
-        long code = strtol(start, &end, base);
-        
-        if (*end == ';' && code != 0) {
-            if (code < 0x80) {
-                *(*output)++ = (char)code;
-            } else if (code < 0x800) {
-                *(*output)++ = 0xC0 | (code >> 6);
-                *(*output)++ = 0x80 | (code & 0x3F);
-            } else if (code < 0x10000) {
-                *(*output)++ = 0xE0 | (code >> 12);
-                *(*output)++ = 0x80 | ((code >> 6) & 0x3F);
-                *(*output)++ = 0x80 | (code & 0x3F);
-            } else {
-                *(*output)++ = 0xF0 | (code >> 18);
-                *(*output)++ = 0x80 | ((code >> 12) & 0x3F);
-                *(*output)++ = 0x80 | ((code >> 6) & 0x3F);
-                *(*output)++ = 0x80 | (code & 0x3F);
-            }
-            return;
-        }
-    } else {
-        const char *entity = start;
-        size_t len = strcspn(start, ";");
-        
-        if (strncmp(entity, "amp", len) == 0) *(*output)++ = '&';
-        else if (strncmp(entity, "lt", len) == 0) *(*output)++ = '<';
-        else if (strncmp(entity, "gt", len) == 0) *(*output)++ = '>';
-        else if (strncmp(entity, "quot", len) == 0) *(*output)++ = '"';
-        else if (strncmp(entity, "apos", len) == 0) *(*output)++ = '\'';
-        else if (strncmp(entity, "nbsp", len) == 0) *(*output)++ = ' ';
-        else if (strncmp(entity, "copy", len) == 0) { *(*output)++ = 0xC2; *(*output)++ = 0xA9; }
-        else {
-            *(*output)++ = '&';
-            while (*start && *start != ';') *(*output)++ = *start++;
-            if (*start == ';') *(*output)++ = ';';
+// Acumula la salida del stripper en un búfer que crece según haga falta
+typedef struct {
+    char* data;
+    size_t len;
+    size_t cap;
+    int failed;
+} StripBuffer;
+
+static void appendStripped(const char* text, size_t len, void* ctx) {
+    StripBuffer* b = ctx;
+    if (b->failed) return;
+    if (b->len + len + 1 > b->cap) {
+        size_t cap = (b->len + len + 1) * 2;
+        char* grown = realloc(b->data, cap);
+        if (!grown) {
+            b->failed = 1;
             return;
         }
+        b->data = grown;
+        b->cap = cap;
     }
-    while (*start && *start != ';') start++;
+    memcpy(b->data + b->len, text, len);
+    b->len += len;
 }
 
 char* stripHTML(const char* html) {
     size_t len = strlen(html);
-    char* output = malloc(len + 1);
-    if (!output) return NULL;
-
-    char* out = output;
-    int in_tag = 0;
-    int in_comment = 0;
-    int in_script = 0;
-
-    for (size_t i = 0; i < len; i++) {
-        if (!in_tag && !in_comment && !in_script) {
-            if (html[i] == '<') {
-                if (i + 4 < len && strncmp(html + i, "<!--", 4) == 0) {
-                    in_comment = 1;
-                    i += 3;
-                } else if (i + 7 < len && strncmp(html + i, "<script", 7) == 0) {
-                    in_script = 1;
-                    i += 6;
-                } else {
-                    in_tag = 1;
-                }
-            } else if (html[i] == '&') {
-                const char* start = html + i + 1;
-                decodeEntity(start, &out);
-                while (html[i] != ';' && html[i] != '\0') i++;
-            } else {
-                *out++ = html[i];
-            }
-        } else if (in_comment) {
-            if (i + 3 < len && strncmp(html + i, "-->", 3) == 0) {
-                in_comment = 0;
-                i += 2;
-            }
-        } else if (in_script) {
-            if (i + 9 < len && strncmp(html + i, "</script>", 9) == 0) {
-                in_script = 0;
-                i += 8;
-            }
-        } else if (in_tag) {
-            if (html[i] == '>') {
-                in_tag = 0;
-            }
-        }
+    StripBuffer b = { malloc(len + 1), 0, len + 1, 0 };
+    if (!b.data) return NULL;
+
+    HtmlStripper stripper;
+    initHTMLStripper(&stripper, appendStripped, &b);
+    feedHTMLStripper(&stripper, html, len);
+    finishHTMLStripper(&stripper);
+
+    if (b.failed) {
+        free(b.data);
+        return NULL;
     }
-    
-    *out = '\0';
-    return output;
-}
\ No newline at end of file
+    b.data[b.len] = '\0';
+    return b.data;
+}
@@ -10,7 +10,7 @@ OUTPUT="$ROOT/results/benchmark.csv"
 mkdir -p "$(dirname "$OUTPUT")"
 
 # Algoritmos
-ALGS=( kmp bm shiftand )
+ALGS=( kmp kmp_dfa bm shiftand )
 
 # Corpus de prueba
 CORPORA=(
@@ -75,4 +75,10 @@ for corpus in "${CORPORA[@]}"; do
   done
 done
 
+# --------------------------------------------------------------------------
+# Calibración del algoritmo auto (umbrales medidos en esta máquina)
+# --------------------------------------------------------------------------
+echo "-- Calibrando planificador (auto)"
+"$CMD" calibrate "$ROOT/docs/corpus/sample_1m.txt" "$ROOT/results/planner.conf"
+
 echo "=== Benchmark completado. Resultados en $OUTPUT ==="
\ No newline at end of file
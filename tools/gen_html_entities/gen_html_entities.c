@@ -0,0 +1,182 @@
+// Diego Galindo, Francisco Mercado
+// Generador de la tabla de entidades HTML5 (se ejecuta al compilar).
+// Lee entities.txt y construye un hash perfecto hash-and-displace: las
+// claves se reparten en buckets con htmlEntityHash(nombre, 0) y, de mayor a
+// menor bucket, se busca un desplazamiento que ubique todas sus claves en
+// ranuras libres. Uso: gen_html_entities entities.txt > html_entities.c
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "html_entities.h"
+
+#define MAX_ENTITIES 4096
+
+typedef struct {
+    char name[HTML_ENTITY_MAX_NAME + 1];
+    char utf8[16];
+    size_t utf8_len;
+    uint32_t bucket;
+} Entry;
+
+static Entry entries[MAX_ENTITIES];
+static size_t entry_count = 0;
+
+static size_t encodeUTF8(uint32_t cp, char *out) {
+    if (cp < 0x80) { out[0] = (char)cp; return 1; }
+    if (cp < 0x800) {
+        out[0] = (char)(0xC0 | (cp >> 6));
+        out[1] = (char)(0x80 | (cp & 0x3F));
+        return 2;
+    }
+    if (cp < 0x10000) {
+        out[0] = (char)(0xE0 | (cp >> 12));
+        out[1] = (char)(0x80 | ((cp >> 6) & 0x3F));
+        out[2] = (char)(0x80 | (cp & 0x3F));
+        return 3;
+    }
+    out[0] = (char)(0xF0 | (cp >> 18));
+    out[1] = (char)(0x80 | ((cp >> 12) & 0x3F));
+    out[2] = (char)(0x80 | ((cp >> 6) & 0x3F));
+    out[3] = (char)(0x80 | (cp & 0x3F));
+    return 4;
+}
+
+// Escribe una cadena como literal C con escapes octales para bytes no ASCII
+static void printLiteral(const char *s, size_t len) {
+    putchar('"');
+    for (size_t i = 0; i < len; i++) {
+        unsigned char c = (unsigned char)s[i];
+        if (c == '"' || c == '\\') printf("\\%c", c);
+        else if (c < 0x20 || c >= 0x7F) printf("\\%03o", c);
+        else putchar(c);
+    }
+    putchar('"');
+}
+
+static size_t bucket_count, slot_count;
+static size_t *bucket_order;
+static size_t *bucket_size;
+
+static int compareBuckets(const void *a, const void *b) {
+    size_t x = *(const size_t*)a, y = *(const size_t*)b;
+    if (bucket_size[x] != bucket_size[y]) return bucket_size[x] > bucket_size[y] ? -1 : 1;
+    return x < y ? -1 : (x > y);
+}
+
+int main(int argc, char *argv[]) {
+    if (argc < 2) {
+        fprintf(stderr, "Uso: %s <entities.txt>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    FILE *in = fopen(argv[1], "r");
+    if (!in) {
+        perror("gen_html_entities: no se pudo abrir la lista de entidades");
+        return EXIT_FAILURE;
+    }
+
+    char line[256];
+    while (fgets(line, sizeof(line), in)) {
+        if (line[0] == '#' || line[0] == '\n') continue;
+        char *name = strtok(line, " \n");
+        if (!name) continue;
+        if (strlen(name) > HTML_ENTITY_MAX_NAME || entry_count == MAX_ENTITIES) {
+            fprintf(stderr, "gen_html_entities: entrada inválida '%s'\n", name);
+            fclose(in);
+            return EXIT_FAILURE;
+        }
+        Entry *e = &entries[entry_count++];
+        strcpy(e->name, name);
+        e->utf8_len = 0;
+        char *hex;
+        while ((hex = strtok(NULL, " \n")) != NULL) {
+            e->utf8_len += encodeUTF8((uint32_t)strtoul(hex, NULL, 16), e->utf8 + e->utf8_len);
+        }
+    }
+    fclose(in);
+
+    // Aproximadamente 4 claves por bucket y un 10% de ranuras de holgura
+    bucket_count = entry_count / 4 + 1;
+    slot_count = entry_count + entry_count / 10 + 1;
+
+    bucket_size = calloc(bucket_count, sizeof(size_t));
+    bucket_order = malloc(bucket_count * sizeof(size_t));
+    uint16_t *disp = calloc(bucket_count, sizeof(uint16_t));
+    long *slot_of = malloc(slot_count * sizeof(long));
+    if (!bucket_size || !bucket_order || !disp || !slot_of) {
+        fprintf(stderr, "gen_html_entities: malloc falló\n");
+        return EXIT_FAILURE;
+    }
+    for (size_t s = 0; s < slot_count; s++) slot_of[s] = -1;
+
+    for (size_t i = 0; i < entry_count; i++) {
+        entries[i].bucket = htmlEntityHash(entries[i].name, strlen(entries[i].name), 0) % bucket_count;
+        bucket_size[entries[i].bucket]++;
+    }
+    for (size_t b = 0; b < bucket_count; b++) bucket_order[b] = b;
+    qsort(bucket_order, bucket_count, sizeof(size_t), compareBuckets);
+
+    size_t members[64];
+    size_t slots[64];
+    for (size_t k = 0; k < bucket_count; k++) {
+        size_t b = bucket_order[k];
+        if (bucket_size[b] == 0) break;
+        size_t n = 0;
+        for (size_t i = 0; i < entry_count && n < 64; i++) {
+            if (entries[i].bucket == b) members[n++] = i;
+        }
+        uint32_t d;
+        for (d = 1; d < 65536; d++) {
+            size_t placed;
+            for (placed = 0; placed < n; placed++) {
+                const char *name = entries[members[placed]].name;
+                size_t s = htmlEntityHash(name, strlen(name), d) % slot_count;
+                if (slot_of[s] != -1) break;
+                size_t j;
+                for (j = 0; j < placed && slots[j] != s; j++);
+                if (j < placed) break;
+                slots[placed] = s;
+            }
+            if (placed == n) break;
+        }
+        if (d == 65536) {
+            fprintf(stderr, "gen_html_entities: no se encontró desplazamiento para el bucket %zu\n", b);
+            return EXIT_FAILURE;
+        }
+        disp[b] = (uint16_t)d;
+        for (size_t j = 0; j < n; j++) slot_of[slots[j]] = (long)members[j];
+    }
+
+    printf("// Archivo generado por tools/gen_html_entities; no editar.\n");
+    printf("#include \"html_entities.h\"\n\n");
+
+    printf("const size_t html_entity_bucket_count = %zu;\n", bucket_count);
+    printf("const size_t html_entity_slot_count = %zu;\n\n", slot_count);
+
+    printf("const uint16_t html_entity_disp[%zu] = {", bucket_count);
+    for (size_t b = 0; b < bucket_count; b++) printf("%s%u,", (b % 12) ? " " : "\n    ", disp[b]);
+    printf("\n};\n\n");
+
+    printf("const HtmlEntity html_entity_slots[%zu] = {\n", slot_count);
+    for (size_t s = 0; s < slot_count; s++) {
+        if (slot_of[s] < 0) {
+            printf("    { NULL, NULL, 0, 0 },\n");
+            continue;
+        }
+        const Entry *e = &entries[slot_of[s]];
+        printf("    { ");
+        printLiteral(e->name, strlen(e->name));
+        printf(", ");
+        printLiteral(e->utf8, e->utf8_len);
+        printf(", %zu, %zu },\n", strlen(e->name), e->utf8_len);
+    }
+    printf("};\n");
+
+    fprintf(stderr, "gen_html_entities: %zu entidades, %zu buckets, %zu ranuras\n",
+            entry_count, bucket_count, slot_count);
+    free(bucket_size);
+    free(bucket_order);
+    free(disp);
+    free(slot_of);
+    return 0;
+}
@@ -0,0 +1,273 @@
+// Diego Galindo, Francisco Mercado
+// Generador de las tablas de normalización Unicode (se ejecuta al compilar).
+// Toma las tablas de mapeo UTF-8 -> UTF-8 de este archivo y emite un trie de
+// dos niveles indexado por code-point (BMP) con los mapeos de case-folding,
+// descomposición NFD y eliminación de diacríticos, más la tabla ordenada de
+// composiciones para NFC. Uso: gen_unicode_tables > unicode_tables.c
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+typedef struct {
+    const char* from;
+    const char* to;
+} UnicodeMapping;
+
+// Case-folding (las mayúsculas ASCII se generan en main)
+static const UnicodeMapping case_folding_table[] = {
+    // Casos especiales Unicode
+    {"İ", "i̇"},  // I turca con punto
+    {"ß", "ss"},  // Eszett alemana
+    {"ſ", "s"},   // S larga
+    {"ﬀ", "ff"}, {"ﬁ", "fi"}, {"ﬂ", "fl"}, {"ﬃ", "ffi"}, {"ﬄ", "ffl"}, // Ligaduras
+
+    // Letras con diacríticos - Español/Latinoamérica
+    {"Á", "á"}, {"À", "à"}, {"Â", "â"}, {"Ä", "ä"}, {"Ã", "ã"}, {"Å", "å"},
+    {"É", "é"}, {"È", "è"}, {"Ê", "ê"}, {"Ë", "ë"},
+    {"Í", "í"}, {"Ì", "ì"}, {"Î", "î"}, {"Ï", "ï"},
+    {"Ó", "ó"}, {"Ò", "ò"}, {"Ô", "ô"}, {"Ö", "ö"}, {"Õ", "õ"}, {"Ø", "ø"},
+    {"Ú", "ú"}, {"Ù", "ù"}, {"Û", "û"}, {"Ü", "ü"},
+    {"Ñ", "ñ"}, {"Ç", "ç"},
+
+    // Caracteres adicionales para países de habla inglesa
+    {"Æ", "æ"}, {"Œ", "œ"}, {"Þ", "þ"}, {"Ð", "ð"},
+
+    // Cirílico básico
+    {"А", "а"}, {"Б", "б"}, {"В", "в"}, {"Г", "г"}, {"Д", "д"}, {"Е", "е"},
+    {"Ё", "ё"}, {"Ж", "ж"}, {"З", "з"}, {"И", "и"}, {"Й", "й"}, {"К", "к"},
+    {"Л", "л"}, {"М", "м"}, {"Н", "н"}, {"О", "о"}, {"П", "п"}, {"Р", "р"},
+    {"С", "с"}, {"Т", "т"}, {"У", "у"}, {"Ф", "ф"}, {"Х", "х"}, {"Ц", "ц"},
+    {"Ч", "ч"}, {"Ш", "ш"}, {"Щ", "щ"}, {"Ъ", "ъ"}, {"Ы", "ы"}, {"Ь", "ь"},
+    {"Э", "э"}, {"Ю", "ю"}, {"Я", "я"},
+
+    {NULL, NULL}
+};
+
+// Descomposición canónica (NFD); las composiciones NFC son su inversa
+static const UnicodeMapping canonical_decomposition[] = {
+    {"á", "a\xCC\x81"}, {"à", "a\xCC\x80"}, {"â", "a\xCC\x82"}, {"ä", "a\xCC\x88"},
+    {"ã", "a\xCC\x83"}, {"å", "a\xCC\x8A"}, {"ā", "a\xCC\x84"},
+    {"é", "e\xCC\x81"}, {"è", "e\xCC\x80"}, {"ê", "e\xCC\x82"}, {"ë", "e\xCC\x88"},
+    {"í", "i\xCC\x81"}, {"ì", "i\xCC\x80"}, {"î", "i\xCC\x82"}, {"ï", "i\xCC\x88"},
+    {"ó", "o\xCC\x81"}, {"ò", "o\xCC\x80"}, {"ô", "o\xCC\x82"}, {"ö", "o\xCC\x88"},
+    {"õ", "o\xCC\x83"}, {"ō", "o\xCC\x84"},
+    {"ú", "u\xCC\x81"}, {"ù", "u\xCC\x80"}, {"û", "u\xCC\x82"}, {"ü", "u\xCC\x88"},
+    {"ñ", "n\xCC\x83"}, {"ç", "c\xCC\xA7"},
+
+    {"Á", "A\xCC\x81"}, {"À", "A\xCC\x80"}, {"Â", "A\xCC\x82"}, {"Ä", "A\xCC\x88"},
+    {"Ã", "A\xCC\x83"}, {"Å", "A\xCC\x8A"},
+    {"É", "E\xCC\x81"}, {"È", "E\xCC\x80"}, {"Ê", "E\xCC\x82"}, {"Ë", "E\xCC\x88"},
+    {"Í", "I\xCC\x81"}, {"Ì", "I\xCC\x80"}, {"Î", "I\xCC\x82"}, {"Ï", "I\xCC\x88"},
+    {"Ó", "O\xCC\x81"}, {"Ò", "O\xCC\x80"}, {"Ô", "O\xCC\x82"}, {"Ö", "O\xCC\x88"},
+    {"Õ", "O\xCC\x83"},
+    {"Ú", "U\xCC\x81"}, {"Ù", "U\xCC\x80"}, {"Û", "U\xCC\x82"}, {"Ü", "U\xCC\x88"},
+    {"Ñ", "N\xCC\x83"}, {"Ç", "C\xCC\xA7"},
+
+    {NULL, NULL}
+};
+
+// Eliminación de diacríticos (las marcas combinadas U+0300-U+036F se
+// eliminan por bandera, así que las formas descompuestas no necesitan entrada)
+static const UnicodeMapping diacritic_removal[] = {
+    // Vocales con diacríticos -> vocales base
+    {"á", "a"}, {"à", "a"}, {"â", "a"}, {"ä", "a"}, {"ã", "a"}, {"å", "a"}, {"ā", "a"},
+    {"Á", "A"}, {"À", "A"}, {"Â", "A"}, {"Ä", "A"}, {"Ã", "A"}, {"Å", "A"}, {"Ā", "A"},
+    {"é", "e"}, {"è", "e"}, {"ê", "e"}, {"ë", "e"}, {"ē", "e"}, {"ė", "e"}, {"ę", "e"},
+    {"É", "E"}, {"È", "E"}, {"Ê", "E"}, {"Ë", "E"}, {"Ē", "E"}, {"Ė", "E"}, {"Ę", "E"},
+    {"í", "i"}, {"ì", "i"}, {"î", "i"}, {"ï", "i"}, {"ī", "i"}, {"į", "i"},
+    {"Í", "I"}, {"Ì", "I"}, {"Î", "I"}, {"Ï", "I"}, {"Ī", "I"}, {"Į", "I"},
+    {"ó", "o"}, {"ò", "o"}, {"ô", "o"}, {"ö", "o"}, {"õ", "o"}, {"ø", "o"}, {"ō", "o"}, {"ő", "o"},
+    {"Ó", "O"}, {"Ò", "O"}, {"Ô", "O"}, {"Ö", "O"}, {"Õ", "O"}, {"Ø", "O"}, {"Ō", "O"}, {"Ő", "O"},
+    {"ú", "u"}, {"ù", "u"}, {"û", "u"}, {"ü", "u"}, {"ū", "u"}, {"ů", "u"}, {"ų", "u"}, {"ű", "u"},
+    {"Ú", "U"}, {"Ù", "U"}, {"Û", "U"}, {"Ü", "U"}, {"Ū", "U"}, {"Ů", "U"}, {"Ų", "U"}, {"Ű", "U"},
+    {"ý", "y"}, {"ÿ", "y"}, {"ȳ", "y"},
+    {"Ý", "Y"}, {"Ÿ", "Y"}, {"Ȳ", "Y"},
+
+    // Consonantes con diacríticos
+    {"ñ", "n"}, {"Ñ", "N"},
+    {"ç", "c"}, {"Ç", "C"}, {"ć", "c"}, {"č", "c"}, {"ċ", "c"}, {"ĉ", "c"},
+    {"Ć", "C"}, {"Č", "C"}, {"Ċ", "C"}, {"Ĉ", "C"},
+    {"ł", "l"}, {"Ł", "L"}, {"ľ", "l"}, {"ĺ", "l"}, {"ļ", "l"},
+    {"Ľ", "L"}, {"Ĺ", "L"}, {"Ļ", "L"},
+    {"ř", "r"}, {"ŕ", "r"}, {"ŗ", "r"},
+    {"Ř", "R"}, {"Ŕ", "R"}, {"Ŗ", "R"},
+    {"ś", "s"}, {"š", "s"}, {"ş", "s"}, {"ș", "s"},
+    {"Ś", "S"}, {"Š", "S"}, {"Ş", "S"}, {"Ș", "S"},
+    {"ť", "t"}, {"ţ", "t"}, {"ț", "t"},
+    {"Ť", "T"}, {"Ţ", "T"}, {"Ț", "T"},
+    {"ź", "z"}, {"ž", "z"}, {"ż", "z"},
+    {"Ź", "Z"}, {"Ž", "Z"}, {"Ż", "Z"},
+    {"ğ", "g"}, {"Ğ", "G"},
+    {"đ", "d"}, {"Đ", "D"},
+
+    {NULL, NULL}
+};
+
+#define MAX_SEQ 4
+#define BMP_SIZE 0x10000
+
+typedef struct {
+    uint8_t len;
+    uint32_t cp[MAX_SEQ];
+} Sequence;
+
+// Registro por code-point (debe coincidir con UnormRecord en unicode_tables.h)
+typedef struct {
+    uint16_t fold, strip, nfd;          // Offsets en el pool
+    uint8_t fold_len, strip_len, nfd_len;
+    uint8_t flags;
+} Record;
+
+typedef struct {
+    uint32_t base, mark, composed;
+} Composition;
+
+static Sequence fold_map[BMP_SIZE], strip_map[BMP_SIZE], nfd_map[BMP_SIZE];
+
+static size_t decode(const char* s, uint32_t* out, size_t max) {
+    const unsigned char* p = (const unsigned char*)s;
+    size_t n = 0;
+    while (*p && n < max) {
+        uint32_t cp;
+        if (*p < 0x80) { cp = *p++; }
+        else if ((*p & 0xE0) == 0xC0) { cp = ((p[0] & 0x1Fu) << 6) | (p[1] & 0x3Fu); p += 2; }
+        else if ((*p & 0xF0) == 0xE0) { cp = ((p[0] & 0x0Fu) << 12) | ((p[1] & 0x3Fu) << 6) | (p[2] & 0x3Fu); p += 3; }
+        else { cp = ((p[0] & 0x07u) << 18) | ((p[1] & 0x3Fu) << 12) | ((p[2] & 0x3Fu) << 6) | (p[3] & 0x3Fu); p += 4; }
+        out[n++] = cp;
+    }
+    return n;
+}
+
+static void loadTable(const UnicodeMapping* table, Sequence* map) {
+    for (size_t i = 0; table[i].from; i++) {
+        uint32_t from[MAX_SEQ];
+        if (decode(table[i].from, from, MAX_SEQ) != 1 || from[0] >= BMP_SIZE) {
+            fprintf(stderr, "gen_unicode_tables: entrada inválida '%s'\n", table[i].from);
+            exit(EXIT_FAILURE);
+        }
+        Sequence* seq = &map[from[0]];
+        seq->len = (uint8_t)decode(table[i].to, seq->cp, MAX_SEQ);
+    }
+}
+
+// Pool de code-points compartido por todos los mapeos
+static uint32_t pool[BMP_SIZE];
+static size_t pool_len = 1;  // Offset 0 reservado (sin mapeo)
+
+static uint16_t addToPool(const Sequence* seq) {
+    if (seq->len == 0) return 0;
+    // Reutiliza una secuencia idéntica si ya existe
+    for (size_t i = 1; i + seq->len <= pool_len; i++) {
+        if (memcmp(pool + i, seq->cp, seq->len * sizeof(uint32_t)) == 0) return (uint16_t)i;
+    }
+    memcpy(pool + pool_len, seq->cp, seq->len * sizeof(uint32_t));
+    pool_len += seq->len;
+    return (uint16_t)(pool_len - seq->len);
+}
+
+static int sameRecord(const Record* a, const Record* b) {
+    return a->fold == b->fold && a->strip == b->strip && a->nfd == b->nfd &&
+           a->fold_len == b->fold_len && a->strip_len == b->strip_len &&
+           a->nfd_len == b->nfd_len && a->flags == b->flags;
+}
+
+static int compareCompositions(const void* a, const void* b) {
+    const Composition* x = a;
+    const Composition* y = b;
+    if (x->base != y->base) return x->base < y->base ? -1 : 1;
+    if (x->mark != y->mark) return x->mark < y->mark ? -1 : 1;
+    return 0;
+}
+
+int main(void) {
+    // Mayúsculas ASCII
+    for (uint32_t c = 'A'; c <= 'Z'; c++) {
+        fold_map[c].len = 1;
+        fold_map[c].cp[0] = c + ('a' - 'A');
+    }
+    loadTable(case_folding_table, fold_map);
+    loadTable(canonical_decomposition, nfd_map);
+    loadTable(diacritic_removal, strip_map);
+
+    // Registros deduplicados (registro 0: sin mapeos)
+    static Record records[BMP_SIZE];
+    static uint16_t record_of[BMP_SIZE];
+    size_t record_count = 1;
+    for (uint32_t cp = 0; cp < BMP_SIZE; cp++) {
+        Record r = {0};
+        r.fold = addToPool(&fold_map[cp]);   r.fold_len = fold_map[cp].len;
+        r.strip = addToPool(&strip_map[cp]); r.strip_len = strip_map[cp].len;
+        r.nfd = addToPool(&nfd_map[cp]);     r.nfd_len = nfd_map[cp].len;
+        if (cp >= 0x0300 && cp <= 0x036F) r.flags |= 0x01;  // Marca combinada
+
+        size_t k;
+        for (k = 0; k < record_count; k++) {
+            if (sameRecord(&records[k], &r)) break;
+        }
+        if (k == record_count) records[record_count++] = r;
+        record_of[cp] = (uint16_t)k;
+    }
+
+    // Segundo nivel: bloques de 256 code-points deduplicados
+    static uint16_t blocks[256][256];
+    uint16_t stage1[256];
+    size_t block_count = 0;
+    for (size_t hi = 0; hi < 256; hi++) {
+        const uint16_t* block = record_of + hi * 256;
+        size_t b;
+        for (b = 0; b < block_count; b++) {
+            if (memcmp(blocks[b], block, sizeof(blocks[b])) == 0) break;
+        }
+        if (b == block_count) memcpy(blocks[block_count++], block, sizeof(blocks[0]));
+        stage1[hi] = (uint16_t)b;
+    }
+
+    // Composiciones NFC: inversa de las descomposiciones base + marca,
+    // ordenadas por (base, marca) para búsqueda binaria
+    static Composition compositions[BMP_SIZE];
+    size_t composition_count = 0;
+    for (uint32_t cp = 0; cp < BMP_SIZE; cp++) {
+        if (nfd_map[cp].len != 2) continue;
+        Composition c = { nfd_map[cp].cp[0], nfd_map[cp].cp[1], cp };
+        compositions[composition_count++] = c;
+    }
+    qsort(compositions, composition_count, sizeof(Composition), compareCompositions);
+
+    printf("// Archivo generado por tools/gen_unicode_tables; no editar.\n");
+    printf("#include \"unicode_tables.h\"\n\n");
+
+    printf("const uint16_t unorm_stage1[256] = {");
+    for (size_t i = 0; i < 256; i++) printf("%s%u,", (i % 16) ? " " : "\n    ", stage1[i]);
+    printf("\n};\n\n");
+
+    printf("const uint16_t unorm_stage2[%zu] = {", block_count * 256);
+    for (size_t b = 0; b < block_count; b++) {
+        for (size_t i = 0; i < 256; i++) printf("%s%u,", (i % 16) ? " " : "\n    ", blocks[b][i]);
+    }
+    printf("\n};\n\n");
+
+    printf("const UnormRecord unorm_records[%zu] = {\n", record_count);
+    for (size_t i = 0; i < record_count; i++) {
+        printf("    { %u, %u, %u, %u, %u, %u, %u },\n",
+               records[i].fold, records[i].strip, records[i].nfd,
+               records[i].fold_len, records[i].strip_len, records[i].nfd_len, records[i].flags);
+    }
+    printf("};\n\n");
+
+    printf("const uint32_t unorm_pool[%zu] = {", pool_len);
+    for (size_t i = 0; i < pool_len; i++) printf("%s0x%04X,", (i % 8) ? " " : "\n    ", pool[i]);
+    printf("\n};\n\n");
+
+    printf("const UnormComposition unorm_compositions[%zu] = {\n", composition_count);
+    for (size_t i = 0; i < composition_count; i++) {
+        printf("    { 0x%04X, 0x%04X, 0x%04X },\n",
+               compositions[i].base, compositions[i].mark, compositions[i].composed);
+    }
+    printf("};\n\n");
+    printf("const size_t unorm_composition_count = %zu;\n", composition_count);
+
+    fprintf(stderr, "gen_unicode_tables: %zu registros, %zu bloques, %zu code-points en pool, %zu composiciones\n",
+            record_count, block_count, pool_len, composition_count);
+    return 0;
+}